@@ -0,0 +1,257 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include "RealtimeChecker.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace threadbare::bench
+{
+
+// Command-line matrix shared by the engine benchmarks:
+//   --rates=44100,48000   sample rates to sweep
+//   --blocks=64,512       block sizes to sweep
+//   --seconds=5           timed audio per configuration
+//   --warmup=0.5          untimed audio rendered first (fills tails, caches)
+//   --preset=<name>       restrict to one factory preset
+//   --output=<file>       write the JSON report to a file instead of stdout
+//   --stress              worst-case control traffic instead of steady state:
+//                         automation sweeps, preset switches and transport
+//                         events cycling through every preset (see the
+//                         engine harnesses); one "stress" row per config
+struct MatrixOptions
+{
+    std::vector<double> sampleRates { 44100.0, 48000.0, 88200.0, 96000.0, 176400.0, 192000.0 };
+    std::vector<int> blockSizes { 16, 32, 64, 128, 256, 512, 1024, 2048, 4096 };
+    double seconds = 5.0;
+    double warmupSeconds = 0.5;
+    juce::String presetFilter;
+    juce::File outputFile;
+    bool stress = false;
+
+    bool includesPreset(const juce::String& name) const
+    {
+        return presetFilter.isEmpty() || presetFilter == name;
+    }
+};
+
+inline MatrixOptions parseMatrixOptions(const juce::ArgumentList& args)
+{
+    MatrixOptions options;
+
+    const auto listFor = [&args](const juce::String& option)
+    {
+        return juce::StringArray::fromTokens(args.getValueForOption(option), ",", "");
+    };
+
+    if (args.containsOption("--rates"))
+    {
+        options.sampleRates.clear();
+        for (const auto& token : listFor("--rates"))
+            options.sampleRates.push_back(token.getDoubleValue());
+    }
+    if (args.containsOption("--blocks"))
+    {
+        options.blockSizes.clear();
+        for (const auto& token : listFor("--blocks"))
+            options.blockSizes.push_back(token.getIntValue());
+    }
+    if (args.containsOption("--seconds"))
+        options.seconds = args.getValueForOption("--seconds").getDoubleValue();
+    if (args.containsOption("--warmup"))
+        options.warmupSeconds = args.getValueForOption("--warmup").getDoubleValue();
+    if (args.containsOption("--preset"))
+        options.presetFilter = args.getValueForOption("--preset");
+    if (args.containsOption("--output"))
+        options.outputFile = juce::File::getCurrentWorkingDirectory().getChildFile(args.getValueForOption("--output"));
+    options.stress = args.containsOption("--stress");
+
+    const auto invalidRate = [](double rate) { return rate <= 0.0; };
+    const auto invalidBlock = [](int block) { return block <= 0; };
+    options.sampleRates.erase(std::remove_if(options.sampleRates.begin(), options.sampleRates.end(), invalidRate),
+                              options.sampleRates.end());
+    options.blockSizes.erase(std::remove_if(options.blockSizes.begin(), options.blockSizes.end(), invalidBlock),
+                             options.blockSizes.end());
+    options.seconds = std::max(options.seconds, 0.01);
+    options.warmupSeconds = std::max(options.warmupSeconds, 0.0);
+    return options;
+}
+
+struct Measurement
+{
+    std::int64_t samples = 0;
+    std::int64_t blocks = 0;
+    double totalNs = 0.0;
+    double worstBlockNs = 0.0;
+    float outputPeak = 0.0f;
+    bool outputFinite = true;
+    std::vector<double> blockNs;   // every timed block, in render order
+
+    // Nearest-rank percentile of the block times (fraction in 0-1).
+    double blockPercentileNs(double fraction) const
+    {
+        if (blockNs.empty())
+            return 0.0;
+
+        auto sorted = blockNs;
+        const auto rank = static_cast<std::size_t>(std::ceil(fraction * static_cast<double>(sorted.size())));
+        const auto index = std::clamp<std::size_t>(rank, 1, sorted.size()) - 1;
+        std::nth_element(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(index), sorted.end());
+        return sorted[index];
+    }
+};
+
+// Renders warmup + timed audio in blockSize chunks. Only processBlock is
+// timed: fillBlock(blockIndex, numSamples) stages input/MIDI beforehand and
+// outputPeak() reads the rendered block afterwards (NaN/inf is flagged).
+// processBlock also runs as a real-time scope for THREADBARE_RT_CHECK builds.
+template <typename FillBlock, typename ProcessBlock, typename OutputPeak>
+Measurement measure(double sampleRate, int blockSize, const MatrixOptions& options,
+                    FillBlock&& fillBlock, ProcessBlock&& processBlock, OutputPeak&& outputPeak)
+{
+    using Clock = std::chrono::steady_clock;
+
+    const auto blocksFor = [&](double seconds)
+    {
+        return static_cast<std::int64_t>(std::ceil(seconds * sampleRate / static_cast<double>(blockSize)));
+    };
+
+    const auto warmupBlocks = blocksFor(options.warmupSeconds);
+    const auto timedBlocks = std::max<std::int64_t>(1, blocksFor(options.seconds));
+
+    Measurement result;
+    result.blockNs.reserve(static_cast<std::size_t>(timedBlocks));
+    std::int64_t blockIndex = 0;
+
+    for (std::int64_t i = 0; i < warmupBlocks; ++i, ++blockIndex)
+    {
+        fillBlock(blockIndex, blockSize);
+        const threadbare::core::rtcheck::ScopedRealtime realtime;
+        processBlock(blockSize);
+    }
+
+    for (std::int64_t i = 0; i < timedBlocks; ++i, ++blockIndex)
+    {
+        fillBlock(blockIndex, blockSize);
+
+        Clock::time_point start, end;
+        {
+            const threadbare::core::rtcheck::ScopedRealtime realtime;
+            start = Clock::now();
+            processBlock(blockSize);
+            end = Clock::now();
+        }
+
+        const float peak = outputPeak(blockSize);
+
+        const double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        result.totalNs += ns;
+        result.blockNs.push_back(ns);
+        result.worstBlockNs = std::max(result.worstBlockNs, ns);
+        if (std::isfinite(peak))
+            result.outputPeak = std::max(result.outputPeak, peak);
+        else
+            result.outputFinite = false;
+    }
+
+    result.blocks = timedBlocks;
+    result.samples = timedBlocks * blockSize;
+    return result;
+}
+
+inline float peakOf(const float* data, int numSamples) noexcept
+{
+    float peak = 0.0f;
+    for (int i = 0; i < numSamples; ++i)
+        peak = std::max(peak, std::abs(data[i]));
+    return peak;
+}
+
+// One result row. realtimeFactor is processing time over audio time (the
+// share of one core the engine needs; < 1 keeps up). worstBlockBudget is the
+// slowest block against its own deadline; the p99/p99.9 block times show
+// whether that was a one-off or a recurring spike.
+inline juce::var makeResult(const juce::String& preset, double sampleRate, int blockSize, const Measurement& m)
+{
+    const double audioNs = static_cast<double>(m.samples) / sampleRate * 1.0e9;
+    const double blockBudgetNs = static_cast<double>(blockSize) / sampleRate * 1.0e9;
+
+    auto* row = new juce::DynamicObject();
+    row->setProperty("preset", preset);
+    row->setProperty("sampleRate", sampleRate);
+    row->setProperty("blockSize", blockSize);
+    row->setProperty("blocks", static_cast<juce::int64>(m.blocks));
+    row->setProperty("nsPerSample", m.totalNs / static_cast<double>(m.samples));
+    row->setProperty("realtimeFactor", m.totalNs / audioNs);
+    row->setProperty("worstBlockMs", m.worstBlockNs * 1.0e-6);
+    row->setProperty("worstBlockBudget", m.worstBlockNs / blockBudgetNs);
+    row->setProperty("p99BlockMs", m.blockPercentileNs(0.99) * 1.0e-6);
+    row->setProperty("p999BlockMs", m.blockPercentileNs(0.999) * 1.0e-6);
+    row->setProperty("p999BlockBudget", m.blockPercentileNs(0.999) / blockBudgetNs);
+    row->setProperty("outputPeak", m.outputPeak);
+    row->setProperty("outputFinite", m.outputFinite);
+    return juce::var(row);
+}
+
+// Prints to stdout when outputFile is unset. Returns a process exit code.
+inline int writeJson(const juce::var& report, const juce::File& outputFile)
+{
+    const auto json = juce::JSON::toString(report);
+
+    if (outputFile == juce::File())
+    {
+        std::cout << json << std::endl;
+        return 0;
+    }
+
+    if (!outputFile.replaceWithText(json))
+    {
+        std::cerr << "Could not write " << outputFile.getFullPathName() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+inline juce::String buildType()
+{
+   #if JUCE_DEBUG
+    return "debug";
+   #else
+    return "release";
+   #endif
+}
+
+// Present only in THREADBARE_RT_CHECK builds; offending stacks go to stderr.
+inline void addRealtimeCheck(juce::DynamicObject& report)
+{
+    if constexpr (threadbare::core::rtcheck::kEnabled)
+    {
+        auto* check = new juce::DynamicObject();
+        check->setProperty("violations", static_cast<juce::int64>(threadbare::core::rtcheck::violationCount()));
+        check->setProperty("sites", static_cast<juce::int64>(threadbare::core::rtcheck::siteCount()));
+        report.setProperty("rtCheck", juce::var(check));
+    }
+}
+
+inline int writeReport(const juce::String& engine, const MatrixOptions& options,
+                       const juce::DynamicObject::Ptr& config, const juce::Array<juce::var>& results)
+{
+    auto* report = new juce::DynamicObject();
+    report->setProperty("engine", engine);
+    report->setProperty("build", buildType());
+    report->setProperty("mode", options.stress ? "stress" : "steady");
+    report->setProperty("seconds", options.seconds);
+    report->setProperty("warmupSeconds", options.warmupSeconds);
+    if (config != nullptr)
+        report->setProperty("config", juce::var(config.get()));
+    report->setProperty("results", results);
+    addRealtimeCheck(*report);
+
+    return writeJson(juce::var(report), options.outputFile);
+}
+
+} // namespace threadbare::bench
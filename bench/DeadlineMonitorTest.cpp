@@ -0,0 +1,138 @@
+// threadbare_test_deadline: drives DeadlineMonitor with synthetic block
+// timings and checks the governor's load pressure. Host scheduling patterns
+// that are not load (a period split into sub-blocks, render-ahead bursts after
+// idle gaps) must stay well under Unravel's engage threshold, while sustained
+// load and real overruns must still cross it.
+// Exits with 1 when a check fails.
+
+#include <juce_core/juce_core.h>
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <string>
+
+#include "DeadlineMonitor.h"
+
+namespace
+{
+using threadbare::core::DeadlineMonitor;
+
+constexpr double kSampleRate = 48000.0;
+constexpr int kPeriod = 512;
+
+// Matches Governor::kEngageLoad in UnravelTuning.h.
+constexpr float kEngageLoad = 0.70f;
+
+// A fake audio clock in high-resolution ticks; each block is recorded as
+// having taken `load` of its own duration.
+struct Clock
+{
+    juce::int64 now = 1;
+
+    juce::int64 ticksFor(double seconds) const
+    {
+        return static_cast<juce::int64>(seconds * static_cast<double>(juce::Time::getHighResolutionTicksPerSecond()));
+    }
+
+    void block(DeadlineMonitor& monitor, int numSamples, float load)
+    {
+        const double seconds = static_cast<double>(numSamples) / kSampleRate;
+        const auto start = now;
+        now += ticksFor(seconds * static_cast<double>(load));
+        monitor.record(start, now, numSamples, kSampleRate);
+    }
+
+    void idle(double seconds) { now += ticksFor(seconds); }
+
+    // Waits until the next period boundary after a callback that started at `start`.
+    void until(juce::int64 start, int numSamples)
+    {
+        now = std::max(now, start + ticksFor(static_cast<double>(numSamples) / kSampleRate));
+    }
+};
+
+// Runs `pattern` 100 times and returns the highest pressure seen.
+float peakPressure(const std::function<void(DeadlineMonitor&, Clock&)>& pattern)
+{
+    DeadlineMonitor monitor;
+    Clock clock;
+    float peak = 0.0f;
+    for (int i = 0; i < 100; ++i)
+    {
+        pattern(monitor, clock);
+        peak = std::max(peak, monitor.getPressure());
+    }
+    return peak;
+}
+
+int failures = 0;
+
+void check(const char* name, float pressure, bool expectEngaged)
+{
+    const bool engaged = pressure > kEngageLoad;
+    const bool passed = engaged == expectEngaged;
+    if (!passed)
+        ++failures;
+    std::cout << (passed ? "PASS " : "FAIL ") << name << ": peak pressure " << pressure
+              << (expectEngaged ? " (expected above " : " (expected at or below ") << kEngageLoad << ")\n";
+}
+} // namespace
+
+int main()
+{
+    constexpr float kLoad = 0.30f;
+
+    // Reference: one callback per period.
+    check("steady", peakPressure([](DeadlineMonitor& monitor, Clock& clock) {
+        const auto start = clock.now;
+        clock.block(monitor, kPeriod, kLoad);
+        clock.until(start, kPeriod);
+    }), false);
+
+    // A host splitting each period at an automation point: two calls back to
+    // back, then nothing until the next period. Judged by arrival times, the
+    // call after the gap looks most of a block late.
+    for (const int split : { 32, 128, 256, 384, 480 })
+    {
+        const auto name = "sub-block splits at " + std::to_string(split);
+        check(name.c_str(), peakPressure([split](DeadlineMonitor& monitor, Clock& clock) {
+            const auto start = clock.now;
+            clock.block(monitor, split, kLoad);
+            clock.block(monitor, kPeriod - split, kLoad);
+            clock.until(start, kPeriod);
+        }), false);
+    }
+
+    // A host rendering ahead: a burst of periods back to back, then idle until
+    // the wall clock catches up. Judged by arrival times, the first call after
+    // the idle gap looks several blocks late.
+    for (const int burst : { 2, 3, 4, 8 })
+    {
+        const auto name = "render-ahead bursts of " + std::to_string(burst);
+        check(name.c_str(), peakPressure([burst](DeadlineMonitor& monitor, Clock& clock) {
+            const auto start = clock.now;
+            for (int i = 0; i < burst; ++i)
+                clock.block(monitor, kPeriod, kLoad);
+            clock.until(start, kPeriod * burst);
+        }), false);
+    }
+
+    // The governor must still react to real load...
+    check("sustained load", peakPressure([](DeadlineMonitor& monitor, Clock& clock) {
+        const auto start = clock.now;
+        clock.block(monitor, kPeriod, 0.85f);
+        clock.until(start, kPeriod);
+    }), true);
+
+    // ...and to a single overrun in an otherwise light stream.
+    {
+        DeadlineMonitor monitor;
+        Clock clock;
+        for (int i = 0; i < 50; ++i)
+            clock.block(monitor, kPeriod, kLoad);
+        clock.block(monitor, kPeriod, 1.2f);
+        check("overrun", monitor.getPressure(), true);
+    }
+
+    return failures == 0 ? 0 : 1;
+}
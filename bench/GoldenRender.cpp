@@ -0,0 +1,616 @@
+// threadbare_golden: renders fixed stimulus through every factory preset of
+// both engines, plus one run of each headless processor cycling through its
+// presets (preset "processor"), and compares the results with stored
+// references.
+//   --record             (re)write the references instead of comparing
+//   --refs=<dir>         reference directory (default: bench/golden)
+//   --engine=unravel|waver   only one engine
+//   --preset=<name>      only one preset
+//   --require=exact|null|spectral   tier every case must reach (default null)
+//   --null-db=-100       residual level (dB re reference energy) for "null"
+//   --spectral-db=1.0    max third-octave band deviation for "spectral"
+//   --output=<file>      write the JSON report to a file instead of stdout
+// Exits with 1 when a case misses its tier or has no reference.
+//
+// Renders are fixed at 48 kHz in 256-sample blocks with fixed seeds, so two
+// builds of the same code agree bit for bit on the same machine. Compiler or
+// CPU changes (FMA contraction, libm) can move the last bits; the null and
+// spectral tiers cover those, and SIMD or approximation work should still
+// null to -100 dB unless it changes the sound on purpose.
+
+#include <juce_dsp/juce_dsp.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <numbers>
+#include <span>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "NoiseSource.h"
+#include "ProcessorHarness.h"
+#include "UnravelHarness.h"
+#include "WaverHarness.h"
+
+namespace
+{
+constexpr double kSampleRate = 48000.0;
+constexpr int kBlockSize = 256;
+constexpr std::uint32_t kWaverSeed = 0x5EEDu;
+constexpr int kWaverOversamplingStages = 1;
+
+// Reference file: "TBGR", version, sample rate, channel count, frame count,
+// then interleaved little-endian float32 frames.
+constexpr int kFileVersion = 1;
+
+struct Render
+{
+    std::vector<float> left, right;
+};
+
+enum class Tier
+{
+    exact = 0,
+    null = 1,
+    spectral = 2,
+    failed = 3
+};
+
+const char* tierName(Tier tier)
+{
+    switch (tier)
+    {
+        case Tier::exact:    return "exact";
+        case Tier::null:     return "null";
+        case Tier::spectral: return "spectral";
+        case Tier::failed:
+        default:             return "failed";
+    }
+}
+
+Tier tierFromName(const juce::String& name)
+{
+    if (name == "exact")
+        return Tier::exact;
+    if (name == "spectral")
+        return Tier::spectral;
+    return Tier::null;
+}
+
+// ---------------------------------------------------------------------------
+// Stimulus
+// ---------------------------------------------------------------------------
+using InputFill = std::function<void(std::int64_t frame, float& left, float& right)>;
+
+struct AudioStimulus
+{
+    const char* name;
+    double seconds;
+    InputFill fill;
+};
+
+std::vector<AudioStimulus> unravelStimuli()
+{
+    std::vector<AudioStimulus> stimuli;
+
+    // Unit impulses: left at 0 s, right at 0.5 s.
+    stimuli.push_back({ "impulses", 2.0,
+                        [](std::int64_t frame, float& left, float& right)
+                        {
+                            left = frame == 0 ? 1.0f : 0.0f;
+                            right = frame == static_cast<std::int64_t>(0.5 * kSampleRate) ? 1.0f : 0.0f;
+                        } });
+
+    // Two 100 ms white noise bursts (seeded), then silence for the tail.
+    auto rng = std::make_shared<std::uint32_t>(0x60D1u);
+    stimuli.push_back({ "noiseBursts", 2.0,
+                        [rng](std::int64_t frame, float& left, float& right)
+                        {
+                            if (frame == 0)
+                                *rng = 0x60D1u;
+                            const auto t = static_cast<double>(frame) / kSampleRate;
+                            const bool inBurst = t < 0.1 || (t >= 0.6 && t < 0.7);
+                            if (!inBurst)
+                            {
+                                left = right = 0.0f;
+                                return;
+                            }
+                            *rng = threadbare::core::nextLcg(*rng);
+                            left = 0.5f * threadbare::core::lcgToBipolar(*rng);
+                            *rng = threadbare::core::nextLcg(*rng);
+                            right = 0.5f * threadbare::core::lcgToBipolar(*rng);
+                        } });
+
+    auto material = std::make_shared<threadbare::bench::ProgramMaterial>(kSampleRate);
+    stimuli.push_back({ "program", 4.0,
+                        [material](std::int64_t frame, float& left, float& right)
+                        {
+                            material->copyTo(frame, &left, &right, 1);
+                        } });
+    return stimuli;
+}
+
+struct MidiStimulus
+{
+    const char* name;
+    double seconds;
+    std::vector<threadbare::bench::MidiPhrase::Event> events;
+};
+
+std::vector<MidiStimulus> waverStimuli()
+{
+    std::vector<MidiStimulus> stimuli;
+
+    // One note through attack, sustain and release.
+    MidiStimulus note { "note", 2.0, {} };
+    note.events.push_back({ 0, juce::MidiMessage::noteOn(1, 60, static_cast<juce::uint8>(100)) });
+    note.events.push_back({ static_cast<std::int64_t>(0.5 * kSampleRate), juce::MidiMessage::noteOff(1, 60) });
+    stimuli.push_back(std::move(note));
+
+    const threadbare::bench::MidiPhrase phrase(kSampleRate);
+    stimuli.push_back({ "phrase", 4.0, phrase.events });
+    return stimuli;
+}
+
+// ---------------------------------------------------------------------------
+// Rendering
+// ---------------------------------------------------------------------------
+std::int64_t framesFor(double seconds)
+{
+    return static_cast<std::int64_t>(seconds * kSampleRate);
+}
+
+Render renderUnravel(const threadbare::unravel::FactoryPreset& preset, const AudioStimulus& stimulus)
+{
+    const auto frames = framesFor(stimulus.seconds);
+    Render render;
+    render.left.resize(static_cast<std::size_t>(frames));
+    render.right.resize(static_cast<std::size_t>(frames));
+
+    for (std::int64_t i = 0; i < frames; ++i)
+        stimulus.fill(i, render.left[static_cast<std::size_t>(i)], render.right[static_cast<std::size_t>(i)]);
+
+    auto reverb = std::make_unique<threadbare::dsp::UnravelReverb>();
+    reverb->prepare({ kSampleRate, static_cast<juce::uint32>(kBlockSize), 2 });
+    reverb->reset();
+    auto state = threadbare::bench::stateForPreset(preset);
+
+    juce::ScopedNoDenormals noDenormals;
+    for (std::int64_t start = 0; start < frames; start += kBlockSize)
+    {
+        const auto n = static_cast<std::size_t>(std::min<std::int64_t>(kBlockSize, frames - start));
+        const auto offset = static_cast<std::size_t>(start);
+        const threadbare::core::rtcheck::ScopedRealtime realtime;
+        reverb->process(std::span<float>(render.left.data() + offset, n),
+                        std::span<float>(render.right.data() + offset, n), state);
+    }
+    return render;
+}
+
+Render renderWaver(const threadbare::waver::FactoryPreset& preset, const MidiStimulus& stimulus)
+{
+    const auto frames = framesFor(stimulus.seconds);
+    Render render;
+    render.left.assign(static_cast<std::size_t>(frames), 0.0f);
+    render.right.assign(static_cast<std::size_t>(frames), 0.0f);
+
+    const auto settings = threadbare::bench::settingsForPreset(preset);
+    auto engine = std::make_unique<threadbare::dsp::WaverEngine>();
+    engine->prepare({ kSampleRate, static_cast<juce::uint32>(kBlockSize), 2 }, kWaverSeed, kWaverOversamplingStages);
+    engine->reset();
+
+    juce::MidiBuffer midi;
+    juce::ScopedNoDenormals noDenormals;
+    for (std::int64_t start = 0; start < frames; start += kBlockSize)
+    {
+        const auto n = std::min<std::int64_t>(kBlockSize, frames - start);
+        midi.clear();
+        for (const auto& event : stimulus.events)
+        {
+            if (event.sample >= start && event.sample < start + n)
+                midi.addEvent(event.message, static_cast<int>(event.sample - start));
+        }
+
+        const auto offset = static_cast<std::size_t>(start);
+        const threadbare::core::rtcheck::ScopedRealtime realtime;
+        threadbare::bench::pushSettings(*engine, settings, false);
+        engine->process(std::span<float>(render.left.data() + offset, static_cast<std::size_t>(n)),
+                        std::span<float>(render.right.data() + offset, static_cast<std::size_t>(n)), midi);
+    }
+    return render;
+}
+
+// Processor runs: processBlock with the control traffic a session produces.
+// Every second the next factory preset is selected; in the second half of
+// each second the puck sweeps (Waver morphs on it), and the final second
+// renders offline (isNonRealtime). Waver's quality mode also cycles every 1.5 s.
+constexpr double kProcessorSlotSeconds = 1.0;
+
+struct ProcessorSchedule
+{
+    int numPrograms = 1;
+    std::int64_t slotLength = framesFor(kProcessorSlotSeconds);
+
+    std::int64_t frames() const { return slotLength * (numPrograms + 1); }
+
+    // Message-thread side of one block, applied before processBlock.
+    void apply(threadbare::core::ProcessorBase& processor, std::int64_t start) const
+    {
+        const auto slot = start / slotLength;
+        const auto inSlot = start - slot * slotLength;
+        if (inSlot == 0 && slot < numPrograms)
+            processor.setCurrentProgram(static_cast<int>(slot));
+        if (slot >= numPrograms)
+            processor.setNonRealtime(true);
+
+        if (inSlot >= slotLength / 2 && slot < numPrograms)
+        {
+            constexpr auto twoPi = 2.0 * std::numbers::pi;
+            const double t = static_cast<double>(start) / kSampleRate;
+            threadbare::bench::setParameter(processor, "puckX", static_cast<float>(std::sin(twoPi * 0.7 * t)));
+            threadbare::bench::setParameter(processor, "puckY", static_cast<float>(std::cos(twoPi * 0.45 * t)));
+        }
+    }
+};
+
+Render renderUnravelProcessor(const AudioStimulus& stimulus)
+{
+    auto processor = threadbare::bench::makeUnravelProcessor(kSampleRate, kBlockSize);
+    const ProcessorSchedule schedule { processor->getNumPrograms() };
+    const auto frames = schedule.frames();
+
+    Render render;
+    render.left.resize(static_cast<std::size_t>(frames));
+    render.right.resize(static_cast<std::size_t>(frames));
+    for (std::int64_t i = 0; i < frames; ++i)
+        stimulus.fill(i, render.left[static_cast<std::size_t>(i)], render.right[static_cast<std::size_t>(i)]);
+
+    juce::AudioBuffer<float> buffer(2, kBlockSize);
+    juce::MidiBuffer midi;
+    for (std::int64_t start = 0; start < frames; start += kBlockSize)
+    {
+        const auto n = static_cast<int>(std::min<std::int64_t>(kBlockSize, frames - start));
+        const auto offset = static_cast<std::size_t>(start);
+        schedule.apply(*processor, start);
+
+        buffer.setSize(2, n, false, false, true);
+        buffer.copyFrom(0, 0, render.left.data() + offset, n);
+        buffer.copyFrom(1, 0, render.right.data() + offset, n);
+        threadbare::bench::processBlock(*processor, buffer, midi);
+        std::copy_n(buffer.getReadPointer(0), n, render.left.data() + offset);
+        std::copy_n(buffer.getReadPointer(1), n, render.right.data() + offset);
+    }
+    return render;
+}
+
+Render renderWaverProcessor(const MidiStimulus& stimulus)
+{
+    auto processor = threadbare::bench::makeWaverProcessor(kSampleRate, kBlockSize, kWaverSeed);
+    const ProcessorSchedule schedule { processor->getNumPrograms() };
+    const auto frames = schedule.frames();
+
+    Render render;
+    render.left.assign(static_cast<std::size_t>(frames), 0.0f);
+    render.right.assign(static_cast<std::size_t>(frames), 0.0f);
+
+    // The stimulus loops for the whole run.
+    const auto loopLength = framesFor(stimulus.seconds);
+    constexpr std::array<float, 3> qualityCycle { 1.0f, 2.0f, 0.0f };
+    const auto qualityPeriod = framesFor(1.5);
+
+    juce::AudioBuffer<float> buffer(2, kBlockSize);
+    juce::MidiBuffer midi;
+    for (std::int64_t start = 0; start < frames; start += kBlockSize)
+    {
+        const auto n = static_cast<int>(std::min<std::int64_t>(kBlockSize, frames - start));
+        schedule.apply(*processor, start);
+        threadbare::bench::setParameter(*processor, "qualityMode",
+                                        qualityCycle[static_cast<std::size_t>((start / qualityPeriod) % 3)]);
+
+        midi.clear();
+        const auto loopStart = start % loopLength;
+        for (const auto& event : stimulus.events)
+        {
+            auto at = event.sample - loopStart;
+            if (at < 0)
+                at += loopLength;
+            if (at < n)
+                midi.addEvent(event.message, static_cast<int>(at));
+        }
+
+        buffer.setSize(2, n, false, false, true);
+        buffer.clear();
+        threadbare::bench::processBlock(*processor, buffer, midi);
+        const auto offset = static_cast<std::size_t>(start);
+        std::copy_n(buffer.getReadPointer(0), n, render.left.data() + offset);
+        std::copy_n(buffer.getReadPointer(1), n, render.right.data() + offset);
+    }
+    return render;
+}
+
+// ---------------------------------------------------------------------------
+// Reference files
+// ---------------------------------------------------------------------------
+juce::File referenceFile(const juce::File& dir, const char* engine, const juce::String& preset, const char* stimulus)
+{
+    const auto safePreset = preset.replaceCharacters(" /\\:", "____");
+    return dir.getChildFile(engine).getChildFile(safePreset + "__" + stimulus + ".f32");
+}
+
+bool writeReference(const juce::File& file, const Render& render)
+{
+    file.getParentDirectory().createDirectory();
+    file.deleteFile();
+    juce::FileOutputStream out(file);
+    if (!out.openedOk())
+        return false;
+
+    out.write("TBGR", 4);
+    out.writeInt(kFileVersion);
+    out.writeDouble(kSampleRate);
+    out.writeInt(2);
+    out.writeInt64(static_cast<juce::int64>(render.left.size()));
+    for (std::size_t i = 0; i < render.left.size(); ++i)
+    {
+        out.writeFloat(render.left[i]);
+        out.writeFloat(render.right[i]);
+    }
+    out.flush();
+    return out.getStatus().wasOk();
+}
+
+bool readReference(const juce::File& file, Render& render)
+{
+    juce::FileInputStream in(file);
+    if (!in.openedOk())
+        return false;
+
+    char magic[4] {};
+    if (in.read(magic, 4) != 4 || std::memcmp(magic, "TBGR", 4) != 0)
+        return false;
+    if (in.readInt() != kFileVersion || in.readDouble() != kSampleRate || in.readInt() != 2)
+        return false;
+
+    const auto frames = in.readInt64();
+    if (frames <= 0 || in.getNumBytesRemaining() != frames * 8)
+        return false;
+
+    render.left.resize(static_cast<std::size_t>(frames));
+    render.right.resize(static_cast<std::size_t>(frames));
+    for (std::size_t i = 0; i < render.left.size(); ++i)
+    {
+        render.left[i] = in.readFloat();
+        render.right[i] = in.readFloat();
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Comparison
+// ---------------------------------------------------------------------------
+struct Comparison
+{
+    bool exact = false;
+    double nullDb = 0.0;
+    double spectralDb = 0.0;
+};
+
+// Third-octave band energies (dB) of the mono sum, from Hann-windowed
+// 4096-point frames at 50 % overlap.
+std::vector<double> bandEnergiesDb(const Render& render)
+{
+    constexpr int kOrder = 12;
+    constexpr int kSize = 1 << kOrder;
+
+    std::vector<double> edges;
+    for (double f = 20.0; f < 20000.0; f *= std::pow(2.0, 1.0 / 3.0))
+        edges.push_back(f);
+    edges.push_back(20000.0);
+
+    std::vector<double> energy(edges.size() - 1, 0.0);
+    juce::dsp::FFT fft(kOrder);
+    juce::dsp::WindowingFunction<float> window(static_cast<std::size_t>(kSize), juce::dsp::WindowingFunction<float>::hann, false);
+    std::vector<float> frame(static_cast<std::size_t>(kSize) * 2);
+
+    const auto length = render.left.size();
+    for (std::size_t start = 0; start < length; start += kSize / 2)
+    {
+        std::fill(frame.begin(), frame.end(), 0.0f);
+        for (std::size_t i = 0; i < static_cast<std::size_t>(kSize) && start + i < length; ++i)
+            frame[i] = 0.5f * (render.left[start + i] + render.right[start + i]);
+        window.multiplyWithWindowingTable(frame.data(), static_cast<std::size_t>(kSize));
+        fft.performFrequencyOnlyForwardTransform(frame.data());
+
+        for (int bin = 1; bin < kSize / 2; ++bin)
+        {
+            const double hz = static_cast<double>(bin) * kSampleRate / kSize;
+            const auto band = std::upper_bound(edges.begin(), edges.end(), hz) - edges.begin() - 1;
+            if (band < 0 || band >= static_cast<std::ptrdiff_t>(energy.size()))
+                continue;
+            const double magnitude = frame[static_cast<std::size_t>(bin)];
+            energy[static_cast<std::size_t>(band)] += magnitude * magnitude;
+        }
+    }
+
+    for (auto& e : energy)
+        e = 10.0 * std::log10(e + 1.0e-30);
+    return energy;
+}
+
+Comparison compare(const Render& rendered, const Render& reference)
+{
+    Comparison result;
+    if (rendered.left.size() != reference.left.size())
+    {
+        result.nullDb = 0.0;
+        result.spectralDb = 999.0;
+        return result;
+    }
+
+    const auto bytes = rendered.left.size() * sizeof(float);
+    result.exact = std::memcmp(rendered.left.data(), reference.left.data(), bytes) == 0
+                && std::memcmp(rendered.right.data(), reference.right.data(), bytes) == 0;
+
+    double residual = 0.0;
+    double energy = 0.0;
+    for (std::size_t i = 0; i < rendered.left.size(); ++i)
+    {
+        const double dl = static_cast<double>(rendered.left[i]) - reference.left[i];
+        const double dr = static_cast<double>(rendered.right[i]) - reference.right[i];
+        residual += dl * dl + dr * dr;
+        energy += static_cast<double>(reference.left[i]) * reference.left[i]
+                + static_cast<double>(reference.right[i]) * reference.right[i];
+    }
+    result.nullDb = residual <= 0.0 ? -400.0 : 10.0 * std::log10(residual / std::max(energy, 1.0e-30));
+
+    // Bands more than 90 dB below the loudest reference band are noise floor.
+    const auto renderedBands = bandEnergiesDb(rendered);
+    const auto referenceBands = bandEnergiesDb(reference);
+    const double loudest = *std::max_element(referenceBands.begin(), referenceBands.end());
+    for (std::size_t band = 0; band < referenceBands.size(); ++band)
+    {
+        if (std::max(referenceBands[band], renderedBands[band]) < loudest - 90.0)
+            continue;
+        result.spectralDb = std::max(result.spectralDb, std::abs(renderedBands[band] - referenceBands[band]));
+    }
+    return result;
+}
+
+struct Tolerances
+{
+    Tier required = Tier::null;
+    double nullDb = -100.0;
+    double spectralDb = 1.0;
+};
+
+Tier tierOf(const Comparison& comparison, const Tolerances& tolerances)
+{
+    if (comparison.exact)
+        return Tier::exact;
+    if (comparison.nullDb <= tolerances.nullDb)
+        return Tier::null;
+    if (comparison.spectralDb <= tolerances.spectralDb)
+        return Tier::spectral;
+    return Tier::failed;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    // The processors' parameter trees need a MessageManager (see ProcessorHarness.h).
+    const juce::ScopedJuceInitialiser_GUI juceInitialiser;
+    const juce::ArgumentList args(argc, argv);
+    const auto optionOr = [&args](const char* option, const juce::String& fallback)
+    {
+        return args.containsOption(option) ? args.getValueForOption(option) : fallback;
+    };
+
+    const auto cwd = juce::File::getCurrentWorkingDirectory();
+    const bool record = args.containsOption("--record");
+    const auto refsDir = cwd.getChildFile(optionOr("--refs", "bench/golden"));
+    const auto engineFilter = optionOr("--engine", {});
+    const auto presetFilter = optionOr("--preset", {});
+    const auto outputFile = args.containsOption("--output") ? cwd.getChildFile(args.getValueForOption("--output")) : juce::File();
+
+    Tolerances tolerances;
+    tolerances.required = tierFromName(optionOr("--require", "null"));
+    tolerances.nullDb = optionOr("--null-db", "-100").getDoubleValue();
+    tolerances.spectralDb = optionOr("--spectral-db", "1.0").getDoubleValue();
+
+    juce::Array<juce::var> results;
+    bool failed = false;
+
+    const auto check = [&](const char* engine, const juce::String& preset, const char* stimulus, const Render& render)
+    {
+        const auto file = referenceFile(refsDir, engine, preset, stimulus);
+
+        auto* row = new juce::DynamicObject();
+        row->setProperty("engine", engine);
+        row->setProperty("preset", preset);
+        row->setProperty("stimulus", stimulus);
+
+        if (record)
+        {
+            const bool written = writeReference(file, render);
+            row->setProperty("status", written ? "recorded" : "writeFailed");
+            failed = failed || !written;
+        }
+        else
+        {
+            Render reference;
+            if (!readReference(file, reference))
+            {
+                row->setProperty("status", "missingReference");
+                failed = true;
+            }
+            else
+            {
+                const auto comparison = compare(render, reference);
+                const auto tier = tierOf(comparison, tolerances);
+                const bool pass = static_cast<int>(tier) <= static_cast<int>(tolerances.required);
+                row->setProperty("status", pass ? "pass" : "fail");
+                row->setProperty("tier", tierName(tier));
+                row->setProperty("nullDb", comparison.nullDb);
+                row->setProperty("spectralDb", comparison.spectralDb);
+                failed = failed || !pass;
+            }
+        }
+
+        results.add(juce::var(row));
+    };
+
+    const auto includes = [](const juce::String& filter, const juce::String& name)
+    {
+        return filter.isEmpty() || filter == name;
+    };
+
+    if (includes(engineFilter, "unravel"))
+    {
+        const auto stimuli = unravelStimuli();
+        for (const auto& preset : threadbare::unravel::getFactoryPresets())
+        {
+            if (!includes(presetFilter, preset.name))
+                continue;
+            for (const auto& stimulus : stimuli)
+                check("unravel", preset.name, stimulus.name, renderUnravel(preset, stimulus));
+        }
+        // The program loop only: the other stimuli are silent after 0.7 s.
+        if (includes(presetFilter, "processor"))
+            check("unravel", "processor", stimuli.back().name, renderUnravelProcessor(stimuli.back()));
+    }
+
+    if (includes(engineFilter, "waver"))
+    {
+        const auto stimuli = waverStimuli();
+        for (const auto& preset : threadbare::waver::getFactoryPresets())
+        {
+            if (!includes(presetFilter, preset.name))
+                continue;
+            for (const auto& stimulus : stimuli)
+                check("waver", preset.name, stimulus.name, renderWaver(preset, stimulus));
+        }
+        // The looping phrase only: the single note is over after 2 s.
+        if (includes(presetFilter, "processor"))
+            check("waver", "processor", stimuli.back().name, renderWaverProcessor(stimuli.back()));
+    }
+
+    auto* report = new juce::DynamicObject();
+    report->setProperty("engine", "golden");
+    report->setProperty("build", threadbare::bench::buildType());
+    report->setProperty("mode", record ? "record" : "verify");
+    report->setProperty("require", tierName(tolerances.required));
+    report->setProperty("nullDb", tolerances.nullDb);
+    report->setProperty("spectralDb", tolerances.spectralDb);
+    report->setProperty("results", results);
+    threadbare::bench::addRealtimeCheck(*report);
+
+    // A real-time violation in a checker build fails the run like a mismatch.
+    failed = failed || threadbare::core::rtcheck::violationCount() > 0;
+
+    const int written = threadbare::bench::writeJson(juce::var(report), outputFile);
+    return written != 0 ? written : (failed ? 1 : 0);
+}
@@ -0,0 +1,542 @@
+// threadbare_bench_primitives: per-kernel microbenchmarks for the Waver DSP
+// classes and the UnravelReverb stages, each over a small parameter sweep,
+// with cache-warm and cache-cold variants. Options:
+//   --filter=<text>      only kernels whose name contains text
+//   --rate=48000         sample rate every kernel is prepared at
+//   --samples=4096       samples per timed repetition
+//   --reps=25            timed repetitions per kernel (median is reported)
+//   --evict-mb=64        size of the buffer streamed to evict caches (cold)
+//   --baseline=<file>    earlier report to compare against
+//   --tolerance=0.1      median slowdown vs baseline that counts as a regression
+//   --output=<file>      write the JSON report to a file instead of stdout
+// Exits with 2 when a kernel regresses against the baseline.
+
+#include <juce_dsp/juce_dsp.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "DSP/ArpEngine.h"
+#include "DSP/BbdChorus.h"
+#include "DSP/MoogLadder.h"
+#include "DSP/NoiseFloor.h"
+#include "DSP/OrganEngine.h"
+#include "DSP/OtaFilter.h"
+#include "DSP/OuDrift.h"
+#include "DSP/Overdrive.h"
+#include "DSP/TapeSaturation.h"
+#include "DSP/ToyEngine.h"
+#include "DSP/UnravelReverb.h"
+#include "DSP/WaverLFO.h"
+#include "DSP/WowFlutter.h"
+#include "NoiseSource.h"
+
+namespace
+{
+namespace dsp = threadbare::dsp;
+
+// One kernel at one sweep point. stage() runs untimed before every timed
+// run() (refilling in-place buffers, re-arming state machines); both take
+// the repetition's sample count.
+struct Kernel
+{
+    juce::String name;
+    juce::String variant;
+    std::function<void(int)> stage;
+    std::function<void(int)> run;
+};
+
+// Shared stimulus and scratch. Kernels write their output to left/right so
+// the work can't be optimised away; the harness reads it after each run.
+struct Scratch
+{
+    std::vector<float> input;
+    std::vector<float> left, right;
+
+    explicit Scratch(int numSamples)
+    {
+        const auto n = static_cast<std::size_t>(numSamples);
+        input.resize(n);
+        left.resize(n);
+        right.resize(n);
+
+        // Band-limited-ish saw plus a little noise: exercises filters and
+        // saturators across their range without denormal tails.
+        std::uint32_t rng = 0xB3A7u;
+        float phase = 0.0f;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            phase += 110.0f / 48000.0f;
+            phase -= std::floor(phase);
+            rng = threadbare::core::nextLcg(rng);
+            input[i] = 0.6f * (2.0f * phase - 1.0f) + 0.1f * threadbare::core::lcgToBipolar(rng);
+        }
+    }
+
+    void loadStereo(int numSamples) noexcept
+    {
+        std::copy_n(input.begin(), numSamples, left.begin());
+        std::copy_n(input.begin(), numSamples, right.begin());
+    }
+};
+
+using KernelList = std::vector<Kernel>;
+
+juce::String labelFor(std::initializer_list<std::pair<const char*, float>> values)
+{
+    juce::StringArray parts;
+    for (const auto& [key, value] : values)
+        parts.add(juce::String(key) + "=" + juce::String(value, 2));
+    return parts.joinIntoString(",");
+}
+
+void addFilterKernels(KernelList& kernels, Scratch& scratch, double sampleRate, int maxSamples)
+{
+    for (const float cutoff : { 200.0f, 2000.0f, 12000.0f })
+    {
+        for (const float resonance : { 0.1f, 0.9f })
+        {
+            auto ota = std::make_shared<dsp::OtaFilter>();
+            ota->prepare(sampleRate);
+            ota->setCutoffHz(cutoff);
+            ota->setResonance(resonance);
+            kernels.push_back({ "OtaFilter", labelFor({ { "cutoff", cutoff }, { "res", resonance } }),
+                                [](int) {},
+                                [ota, &scratch](int n)
+                                {
+                                    for (int i = 0; i < n; ++i)
+                                        scratch.left[static_cast<std::size_t>(i)] = ota->process(scratch.input[static_cast<std::size_t>(i)]);
+                                } });
+
+            auto ladder = std::make_shared<dsp::MoogLadder>();
+            ladder->prepare({ sampleRate, static_cast<juce::uint32>(maxSamples), 1 });
+            ladder->setCutoffHz(cutoff);
+            ladder->setResonance(resonance);
+            kernels.push_back({ "MoogLadder", labelFor({ { "cutoff", cutoff }, { "res", resonance } }),
+                                [](int) {},
+                                [ladder, &scratch](int n)
+                                {
+                                    for (int i = 0; i < n; ++i)
+                                        scratch.left[static_cast<std::size_t>(i)] = ladder->process(scratch.input[static_cast<std::size_t>(i)]);
+                                } });
+        }
+    }
+}
+
+void addOscillatorKernels(KernelList& kernels, Scratch& scratch, double sampleRate)
+{
+    for (const float modIndex : { 0.1f, 0.8f })
+    {
+        for (const float feedback : { 0.0f, 0.6f })
+        {
+            auto toy = std::make_shared<dsp::ToyEngine>();
+            toy->prepare(sampleRate);
+            toy->setModIndex(modIndex);
+            toy->setFeedback(feedback);
+            for (int lane = 0; lane < dsp::ToyEngine::kLanes; ++lane)
+            {
+                const float hz = 110.0f * static_cast<float>(lane + 1);
+                toy->setLaneIncrement(lane, hz / static_cast<float>(sampleRate));
+                toy->setLaneEnvelope(lane, 0.8f);
+            }
+            kernels.push_back({ "ToyEngine", labelFor({ { "index", modIndex }, { "feedback", feedback }, { "lanes", 8.0f } }),
+                                [](int) {},
+                                [toy, &scratch](int n)
+                                {
+                                    for (int i = 0; i < n; ++i)
+                                    {
+                                        toy->process();
+                                        float sum = 0.0f;
+                                        for (int lane = 0; lane < dsp::ToyEngine::kLanes; ++lane)
+                                            sum += toy->getLaneOutput(lane);
+                                        scratch.left[static_cast<std::size_t>(i)] = sum;
+                                    }
+                                } });
+        }
+    }
+
+    for (const int numNotes : { 1, 4, 8 })
+    {
+        auto organ = std::make_shared<dsp::OrganEngine>();
+        organ->setDrawbars(8.0f, 6.0f, 4.0f, 3.0f);
+        organ->prepare(sampleRate);
+        for (int i = 0; i < numNotes; ++i)
+            organ->noteOn(48 + 5 * i);
+        kernels.push_back({ "OrganEngine", labelFor({ { "notes", static_cast<float>(numNotes) } }),
+                            [](int) {},
+                            [organ, &scratch](int n)
+                            {
+                                for (int i = 0; i < n; ++i)
+                                    scratch.left[static_cast<std::size_t>(i)] = organ->processSample();
+                            } });
+    }
+}
+
+void addPrintKernels(KernelList& kernels, Scratch& scratch, double sampleRate, int maxSamples)
+{
+    for (const auto mode : { dsp::BbdChorus::Mode::modeI, dsp::BbdChorus::Mode::modeII, dsp::BbdChorus::Mode::modeIPlusII })
+    {
+        auto chorus = std::make_shared<dsp::BbdChorus>();
+        chorus->prepare(sampleRate, static_cast<std::size_t>(maxSamples));
+        chorus->setMode(mode);
+        kernels.push_back({ "BbdChorus", labelFor({ { "mode", static_cast<float>(mode) } }),
+                            [&scratch](int n) { scratch.loadStereo(n); },
+                            [chorus, &scratch](int n) { chorus->process(scratch.left.data(), scratch.right.data(), n); } });
+    }
+
+    for (const float depth : { 0.2f, 1.0f })
+    {
+        for (const float age : { 0.0f, 1.0f })
+        {
+            auto wow = std::make_shared<dsp::WowFlutter>();
+            wow->prepare(sampleRate, static_cast<std::size_t>(maxSamples));
+            wow->setWowDepth(depth);
+            wow->setFlutterDepth(depth);
+            wow->setAge(age);
+            kernels.push_back({ "WowFlutter", labelFor({ { "depth", depth }, { "age", age } }),
+                                [&scratch](int n) { scratch.loadStereo(n); },
+                                [wow, &scratch](int n) { wow->process(scratch.left.data(), scratch.right.data(), n); } });
+        }
+    }
+
+    for (const float amount : { 0.1f, 0.9f })
+    {
+        auto drive = std::make_shared<dsp::Overdrive>();
+        drive->prepare(sampleRate);
+        drive->setGain(amount);
+        kernels.push_back({ "Overdrive", labelFor({ { "gain", amount } }),
+                            [&scratch](int n) { scratch.loadStereo(n); },
+                            [drive, &scratch](int n)
+                            {
+                                for (int i = 0; i < n; ++i)
+                                {
+                                    const auto index = static_cast<std::size_t>(i);
+                                    dsp::StereoFrame frame { scratch.left[index], scratch.right[index] };
+                                    drive->processSample(frame);
+                                    scratch.left[index] = frame[0];
+                                    scratch.right[index] = frame[1];
+                                }
+                            } });
+
+        auto tape = std::make_shared<dsp::TapeSaturation>();
+        tape->prepare(sampleRate);
+        tape->setDrive(amount);
+        kernels.push_back({ "TapeSaturation", labelFor({ { "drive", amount } }),
+                            [&scratch](int n) { scratch.loadStereo(n); },
+                            [tape, &scratch](int n)
+                            {
+                                for (int i = 0; i < n; ++i)
+                                {
+                                    const auto index = static_cast<std::size_t>(i);
+                                    dsp::StereoFrame frame { scratch.left[index], scratch.right[index] };
+                                    tape->processSample(frame);
+                                    scratch.left[index] = frame[0];
+                                    scratch.right[index] = frame[1];
+                                }
+                            } });
+    }
+
+    for (const float humHz : { 50.0f, 60.0f })
+    {
+        for (const float age : { 0.0f, 1.0f })
+        {
+            auto noise = std::make_shared<dsp::NoiseFloor>();
+            noise->prepare(sampleRate);
+            noise->setHissLevel(0.5f);
+            noise->setHumFreq(humHz);
+            noise->setAge(age);
+            kernels.push_back({ "NoiseFloor", labelFor({ { "hum", humHz }, { "age", age } }),
+                                [](int) {},
+                                [noise, &scratch](int n)
+                                {
+                                    for (int i = 0; i < n; ++i)
+                                        scratch.left[static_cast<std::size_t>(i)] = noise->processSample();
+                                } });
+        }
+    }
+}
+
+void addModulationKernels(KernelList& kernels, Scratch& scratch, double sampleRate)
+{
+    using Shape = dsp::WaverLFO::Shape;
+    for (const auto shape : { Shape::tri, Shape::sine, Shape::square, Shape::sampleHold })
+    {
+        auto lfo = std::make_shared<dsp::WaverLFO>();
+        lfo->prepare(sampleRate);
+        lfo->setRateHz(5.0f);
+        lfo->setShape(shape);
+        kernels.push_back({ "WaverLFO", labelFor({ { "shape", static_cast<float>(shape) } }),
+                            [](int) {},
+                            [lfo, &scratch](int n)
+                            {
+                                for (int i = 0; i < n; ++i)
+                                    scratch.left[static_cast<std::size_t>(i)] = lfo->processSample();
+                            } });
+    }
+
+    for (const float age : { 0.0f, 1.0f })
+    {
+        auto drift = std::make_shared<dsp::OuDrift>();
+        drift->prepare(sampleRate, 0x0D71u);
+        kernels.push_back({ "OuDrift", labelFor({ { "age", age } }),
+                            [](int) {},
+                            [drift, age, &scratch](int n)
+                            {
+                                for (int i = 0; i < n; ++i)
+                                    scratch.left[static_cast<std::size_t>(i)] = drift->processSample(0.5f, age);
+                            } });
+    }
+
+    // The arp is called once per host block; time it at a 64-sample block.
+    using Pattern = dsp::ArpEngine::Pattern;
+    for (const float rateHz : { 4.0f, 32.0f })
+    {
+        for (const auto pattern : { Pattern::up, Pattern::random })
+        {
+            auto arp = std::make_shared<dsp::ArpEngine>();
+            arp->prepare(sampleRate, 0xA4Bu);
+            arp->setEnabled(true);
+            arp->setRate(rateHz);
+            arp->setPattern(pattern);
+            for (const int note : { 48, 52, 55, 59 })
+                arp->noteOn(note, 0.8f);
+            kernels.push_back({ "ArpEngine", labelFor({ { "rate", rateHz }, { "pattern", static_cast<float>(pattern) } }),
+                                [](int) {},
+                                [arp, &scratch](int n)
+                                {
+                                    std::array<dsp::ArpEngine::NoteEvent, 32> events {};
+                                    int written = 0;
+                                    for (int offset = 0; offset < n; offset += 64)
+                                        written += arp->advance(std::min(64, n - offset), events);
+                                    scratch.left[0] = static_cast<float>(written);
+                                } });
+        }
+    }
+}
+
+// UnravelReverb's stages (FDN delay reads, ghost grains, glitch sparkle
+// voices, disintegration looper) live inside one process() call, so each is
+// timed as a reverb configured to isolate it; compare against delayReads.
+void addUnravelKernels(KernelList& kernels, Scratch& scratch, double sampleRate, int maxSamples)
+{
+    struct Stage
+    {
+        const char* name;
+        float drift, ghost, glitch;
+        bool looper;
+    };
+
+    constexpr std::array<Stage, 5> stages {{
+        { "UnravelReverb/delayReads",      0.0f, 0.0f, 0.0f, false },
+        { "UnravelReverb/modulatedReads",  1.0f, 0.0f, 0.0f, false },
+        { "UnravelReverb/ghostGrains",     0.0f, 1.0f, 0.0f, false },
+        { "UnravelReverb/glitchVoices",    0.0f, 0.0f, 1.0f, false },
+        { "UnravelReverb/looper",          0.0f, 0.0f, 0.0f, true },
+    }};
+
+    for (const auto& stage : stages)
+    {
+        for (const float size : { 0.5f, 2.0f })
+        {
+            auto reverb = std::make_shared<dsp::UnravelReverb>();
+            reverb->prepare({ sampleRate, static_cast<juce::uint32>(maxSamples), 2 });
+            auto state = std::make_shared<dsp::UnravelState>();
+            state->size = size;
+            state->decaySeconds = 8.0f;
+            state->mix = 1.0f;
+            state->drift = stage.drift;
+            state->ghost = stage.ghost;
+            state->glitch = stage.glitch;
+
+            const bool looper = stage.looper;
+            const auto rearmLooper = [reverb, state, &scratch, maxSamples, sampleRate]
+            {
+                // Record about a second, punch out, and settle into playback.
+                const auto blocks = static_cast<int>(sampleRate / maxSamples) + 1;
+                const auto n = static_cast<std::size_t>(maxSamples);
+                for (int block = 0; block <= blocks && reverb->getLooperState() != dsp::LooperState::Looping; ++block)
+                {
+                    state->looperTriggerAction = block == 0 ? 1 : (block == blocks ? 2 : 0);
+                    scratch.loadStereo(maxSamples);
+                    reverb->process(std::span<float>(scratch.left.data(), n), std::span<float>(scratch.right.data(), n), *state);
+                }
+                state->looperTriggerAction = 0;
+            };
+
+            kernels.push_back({ stage.name, labelFor({ { "size", size } }),
+                                [looper, rearmLooper, reverb, &scratch](int n)
+                                {
+                                    if (looper && reverb->getLooperState() != dsp::LooperState::Looping)
+                                        rearmLooper();
+                                    scratch.loadStereo(n);
+                                },
+                                [reverb, state, &scratch](int n)
+                                {
+                                    const auto count = static_cast<std::size_t>(n);
+                                    reverb->process(std::span<float>(scratch.left.data(), count),
+                                                    std::span<float>(scratch.right.data(), count), *state);
+                                } });
+        }
+    }
+}
+
+struct Stats
+{
+    double median = 0.0;
+    double min = 0.0;
+    double p90 = 0.0;
+};
+
+Stats statsOf(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    const auto at = [&values](double q)
+    {
+        const auto index = static_cast<std::size_t>(q * static_cast<double>(values.size() - 1) + 0.5);
+        return values[index];
+    };
+    return { at(0.5), values.front(), at(0.9) };
+}
+
+// Streams (and dirties) a buffer larger than the last-level cache.
+void evictCaches(std::vector<std::uint8_t>& evictBuffer) noexcept
+{
+    for (std::size_t i = 0; i < evictBuffer.size(); i += 64)
+        evictBuffer[i] = static_cast<std::uint8_t>(evictBuffer[i] + 1);
+}
+
+juce::String keyFor(const juce::String& name, const juce::String& variant, const juce::String& cache)
+{
+    return name + "|" + variant + "|" + cache;
+}
+
+std::map<juce::String, double> loadBaseline(const juce::File& file)
+{
+    std::map<juce::String, double> medians;
+    const auto parsed = juce::JSON::parse(file);
+    if (const auto* results = parsed["results"].getArray())
+    {
+        for (const auto& row : *results)
+            medians[keyFor(row["kernel"].toString(), row["variant"].toString(), row["cache"].toString())]
+                = static_cast<double>(row["nsPerSampleMedian"]);
+    }
+    return medians;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    using Clock = std::chrono::steady_clock;
+
+    const juce::ArgumentList args(argc, argv);
+    const auto optionOr = [&args](const char* option, const juce::String& fallback)
+    {
+        return args.containsOption(option) ? args.getValueForOption(option) : fallback;
+    };
+
+    const auto filter = optionOr("--filter", {});
+    const double sampleRate = std::max(8000.0, optionOr("--rate", "48000").getDoubleValue());
+    const int samplesPerRep = std::max(16, optionOr("--samples", "4096").getIntValue());
+    const int reps = std::max(3, optionOr("--reps", "25").getIntValue());
+    const auto evictBytes = static_cast<std::size_t>(std::max(1, optionOr("--evict-mb", "64").getIntValue())) << 20;
+    const double tolerance = optionOr("--tolerance", "0.1").getDoubleValue();
+    const auto cwd = juce::File::getCurrentWorkingDirectory();
+    const auto outputFile = args.containsOption("--output") ? cwd.getChildFile(args.getValueForOption("--output")) : juce::File();
+    const auto baseline = args.containsOption("--baseline")
+                              ? loadBaseline(cwd.getChildFile(args.getValueForOption("--baseline")))
+                              : std::map<juce::String, double>();
+
+    Scratch scratch(samplesPerRep);
+    KernelList kernels;
+    addFilterKernels(kernels, scratch, sampleRate, samplesPerRep);
+    addOscillatorKernels(kernels, scratch, sampleRate);
+    addPrintKernels(kernels, scratch, sampleRate, samplesPerRep);
+    addModulationKernels(kernels, scratch, sampleRate);
+    addUnravelKernels(kernels, scratch, sampleRate, samplesPerRep);
+
+    std::vector<std::uint8_t> evictBuffer(evictBytes);
+    std::vector<double> nsPerSample(static_cast<std::size_t>(reps));
+    juce::Array<juce::var> results;
+    volatile float sink = 0.0f;
+    bool regressed = false;
+
+    juce::ScopedNoDenormals noDenormals;
+
+    for (auto& kernel : kernels)
+    {
+        if (filter.isNotEmpty() && !kernel.name.contains(filter))
+            continue;
+
+        for (const bool cold : { false, true })
+        {
+            // One untimed pass so warm runs start warm and first-touch
+            // allocations (page faults) stay out of both variants.
+            kernel.stage(samplesPerRep);
+            kernel.run(samplesPerRep);
+
+            for (int rep = 0; rep < reps; ++rep)
+            {
+                kernel.stage(samplesPerRep);
+                if (cold)
+                    evictCaches(evictBuffer);
+
+                const auto start = Clock::now();
+                kernel.run(samplesPerRep);
+                const auto end = Clock::now();
+
+                sink = sink + scratch.left[0];
+                const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+                nsPerSample[static_cast<std::size_t>(rep)] = static_cast<double>(ns) / samplesPerRep;
+            }
+
+            const auto stats = statsOf(nsPerSample);
+            const juce::String cache = cold ? "cold" : "warm";
+
+            auto* row = new juce::DynamicObject();
+            row->setProperty("kernel", kernel.name);
+            row->setProperty("variant", kernel.variant);
+            row->setProperty("cache", cache);
+            row->setProperty("nsPerSampleMedian", stats.median);
+            row->setProperty("nsPerSampleMin", stats.min);
+            row->setProperty("nsPerSampleP90", stats.p90);
+
+            const auto found = baseline.find(keyFor(kernel.name, kernel.variant, cache));
+            if (found != baseline.end() && found->second > 0.0)
+            {
+                const double ratio = stats.median / found->second;
+                row->setProperty("baselineRatio", ratio);
+                if (ratio > 1.0 + tolerance)
+                {
+                    row->setProperty("regression", true);
+                    regressed = true;
+                    std::cerr << "regression: " << kernel.name << " [" << kernel.variant << ", " << cache
+                              << "] x" << ratio << std::endl;
+                }
+            }
+            results.add(juce::var(row));
+        }
+    }
+
+    auto* report = new juce::DynamicObject();
+    report->setProperty("engine", "primitives");
+    report->setProperty("build", threadbare::bench::buildType());
+    report->setProperty("sampleRate", sampleRate);
+    report->setProperty("samplesPerRep", samplesPerRep);
+    report->setProperty("reps", reps);
+    report->setProperty("evictMb", static_cast<int>(evictBytes >> 20));
+    report->setProperty("results", results);
+
+    const int written = threadbare::bench::writeJson(juce::var(report), outputFile);
+    juce::ignoreUnused(sink);
+    return written != 0 ? written : (regressed ? 2 : 0);
+}
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <numbers>
+
+#include "Processors/UnravelProcessor.h"
+#include "Processors/WaverProcessor.h"
+#include "RealtimeChecker.h"
+#include "WaverHarness.h"
+
+namespace threadbare::bench
+{
+
+// Headless plugin processors (targets set up with
+// threadbare_add_headless_processors). Their parameter trees run a timer,
+// which needs a MessageManager, so main() holds a
+// juce::ScopedJuceInitialiser_GUI; nothing dispatches it, so timer callbacks
+// never run and renders repeat. Control changes are made
+// between blocks from the calling thread, the way a host's message thread
+// would.
+
+inline std::unique_ptr<UnravelProcessor> makeUnravelProcessor(double sampleRate, int blockSize)
+{
+    auto processor = std::make_unique<UnravelProcessor>();
+    processor->setRateAndBufferSizeDetails(sampleRate, blockSize);
+    processor->prepareToPlay(sampleRate, blockSize);
+    return processor;
+}
+
+// WaverProcessor draws its global seed at random; the seed is replaced
+// through a state restore before prepareToPlay hands it to the engine.
+inline std::unique_ptr<WaverProcessor> makeWaverProcessor(double sampleRate, int blockSize, std::uint64_t seed)
+{
+    auto processor = std::make_unique<WaverProcessor>();
+
+    juce::MemoryBlock state;
+    processor->getStateInformation(state);
+    auto tree = juce::ValueTree::readFromData(state.getData(), state.getSize());
+    tree.setProperty("determinismGlobalSeed", static_cast<juce::int64>(seed), nullptr);
+    state.reset();
+    {
+        juce::MemoryOutputStream stream(state, false);
+        tree.writeToStream(stream);
+    }
+    processor->setStateInformation(state.getData(), static_cast<int>(state.getSize()));
+
+    processor->setRateAndBufferSizeDetails(sampleRate, blockSize);
+    processor->prepareToPlay(sampleRate, blockSize);
+    return processor;
+}
+
+inline void setParameter(threadbare::core::ProcessorBase& processor, const char* id, float value)
+{
+    if (auto* param = processor.getValueTreeState().getParameter(id))
+        param->setValueNotifyingHost(param->convertTo0to1(value));
+}
+
+// One host callback. ProcessorBase opens its own scope as well; this one
+// also covers the wrapper itself.
+inline void processBlock(juce::AudioProcessor& processor, juce::AudioBuffer<float>& buffer,
+                         juce::MidiBuffer& midi) noexcept
+{
+    const threadbare::core::rtcheck::ScopedRealtime realtime;
+    processor.processBlock(buffer, midi);
+}
+
+// Host transport for the processors' getPlayHead(); set between blocks.
+class BenchPlayHead final : public juce::AudioPlayHead
+{
+public:
+    void set(bool isPlaying, double ppqPosition, double bpm, juce::int64 timeInSamples) noexcept
+    {
+        info.setIsPlaying(isPlaying);
+        info.setPpqPosition(ppqPosition);
+        info.setBpm(bpm);
+        info.setTimeInSamples(timeInSamples);
+    }
+
+    juce::Optional<PositionInfo> getPosition() const override { return info; }
+
+private:
+    PositionInfo info;
+};
+
+// Worst-case control traffic for threadbare_bench_waver --stress, driven
+// through a headless WaverProcessor so the preset transition, quality switch,
+// morph and arp latch are the plugin's own code. The host side of each block
+// runs untimed before it; processBlock is what gets timed. The schedule is in
+// samples, so it is the same at every block size:
+//   - the makeStressPhrase() MIDI;
+//   - puck X/Y swept at 3 and 4.7 Hz (the morph re-evaluates every block
+//     with the arp off; with it on, the pucks drive the arp and age);
+//   - a preset change every 1.25 s through setCurrentProgram;
+//   - qualityMode cycling standard -> hq -> lite every 2 s;
+//   - transport start/stop every 0.75 s, with the arp on the host position.
+class WaverStress
+{
+public:
+    WaverStress(double sampleRateToUse, int blockSize, bool arpEnabled)
+        : sampleRate(sampleRateToUse),
+          phrase(makeStressPhrase(sampleRateToUse)),
+          presetPeriod(static_cast<std::int64_t>(sampleRateToUse * 1.25)),
+          qualityPeriod(static_cast<std::int64_t>(sampleRateToUse * 2.0)),
+          transportPeriod(static_cast<std::int64_t>(sampleRateToUse * 0.75)),
+          processor(makeWaverProcessor(sampleRateToUse, blockSize, 0x5EEDu))
+    {
+        processor->setPlayHead(&playHead);
+        setParameter(*processor, "arpEnabled", arpEnabled ? 1.0f : 0.0f);
+    }
+
+    WaverStress(const WaverStress&) = delete;
+    WaverStress& operator=(const WaverStress&) = delete;
+
+    ~WaverStress() { processor->setPlayHead(nullptr); }
+
+    /** Untimed: the host's message thread and transport, then this block's MIDI. */
+    void fill(juce::MidiBuffer& midi, std::int64_t blockStart, int numSamples)
+    {
+        const auto slot = blockStart / presetPeriod;
+        if (slot != presetSlot)
+        {
+            presetSlot = slot;
+            processor->setCurrentProgram(static_cast<int>(slot % processor->getNumPrograms()));
+        }
+
+        constexpr std::array<float, 3> qualityCycle { 1.0f, 2.0f, 0.0f };
+        setParameter(*processor, "qualityMode", qualityCycle[static_cast<std::size_t>((blockStart / qualityPeriod) % 3)]);
+
+        constexpr auto twoPi = 2.0 * std::numbers::pi;
+        const double seconds = static_cast<double>(blockStart) / sampleRate;
+        setParameter(*processor, "puckX", static_cast<float>(std::sin(twoPi * 3.0 * seconds)));
+        setParameter(*processor, "puckY", static_cast<float>(std::sin(twoPi * 4.7 * seconds + 1.0)));
+
+        constexpr double kBpm = 120.0;
+        const bool playing = (blockStart / transportPeriod) % 2 == 0;
+        playHead.set(playing, playing ? seconds * kBpm / 60.0 : 0.0, kBpm, blockStart);
+
+        phrase.fill(midi, blockStart, numSamples);
+    }
+
+    /** Timed: one host callback. */
+    void process(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi)
+    {
+        processor->processBlock(buffer, midi);
+    }
+
+private:
+    double sampleRate;
+    MidiPhrase phrase;
+    std::int64_t presetPeriod, qualityPeriod, transportPeriod;
+    BenchPlayHead playHead;
+    std::unique_ptr<WaverProcessor> processor;
+    std::int64_t presetSlot = 0;
+};
+
+} // namespace threadbare::bench
@@ -0,0 +1,84 @@
+// threadbare_bench_unravel: times UnravelReverb::process over the factory
+// preset matrix with synthetic program material, or under UnravelStress with
+// --stress. See BenchCommon.h for the command-line options; the report is
+// JSON.
+
+#include <juce_dsp/juce_dsp.h>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "UnravelHarness.h"
+
+int main(int argc, char* argv[])
+{
+    const juce::ArgumentList args(argc, argv);
+    const auto options = threadbare::bench::parseMatrixOptions(args);
+
+    juce::Array<juce::var> results;
+
+    for (const double sampleRate : options.sampleRates)
+    {
+        const threadbare::bench::ProgramMaterial material(sampleRate);
+
+        for (const int blockSize : options.blockSizes)
+        {
+            std::vector<float> left(static_cast<std::size_t>(blockSize));
+            std::vector<float> right(static_cast<std::size_t>(blockSize));
+
+            // stageState(state, blockStart, numSamples) runs untimed before each block.
+            const auto run = [&](threadbare::dsp::UnravelState state, auto&& stageState)
+            {
+                auto reverb = std::make_unique<threadbare::dsp::UnravelReverb>();
+                reverb->prepare({ sampleRate, static_cast<juce::uint32>(blockSize), 2 });
+                reverb->reset();
+
+                juce::ScopedNoDenormals noDenormals;
+                return threadbare::bench::measure(
+                    sampleRate, blockSize, options,
+                    [&](std::int64_t blockIndex, int numSamples)
+                    {
+                        material.copyTo(blockIndex * blockSize, left.data(), right.data(), numSamples);
+                        stageState(state, blockIndex * blockSize, numSamples);
+                    },
+                    [&](int numSamples)
+                    {
+                        const auto n = static_cast<std::size_t>(numSamples);
+                        reverb->process(std::span<float>(left.data(), n), std::span<float>(right.data(), n), state);
+                    },
+                    [&](int numSamples)
+                    {
+                        return std::max(threadbare::bench::peakOf(left.data(), numSamples),
+                                        threadbare::bench::peakOf(right.data(), numSamples));
+                    });
+            };
+
+            if (options.stress)
+            {
+                threadbare::bench::UnravelStress stress(sampleRate);
+                const auto measurement = run({}, [&stress](threadbare::dsp::UnravelState& state,
+                                                           std::int64_t blockStart, int numSamples)
+                {
+                    stress.apply(state, blockStart, numSamples);
+                });
+                results.add(threadbare::bench::makeResult("stress", sampleRate, blockSize, measurement));
+                continue;
+            }
+
+            for (const auto& preset : threadbare::unravel::getFactoryPresets())
+            {
+                if (!options.includesPreset(preset.name))
+                    continue;
+
+                const auto measurement = run(threadbare::bench::stateForPreset(preset),
+                                             [](threadbare::dsp::UnravelState&, std::int64_t, int) {});
+                results.add(threadbare::bench::makeResult(preset.name, sampleRate, blockSize, measurement));
+            }
+        }
+    }
+
+    return threadbare::bench::writeReport("unravel", options, nullptr, results);
+}
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <string_view>
+#include <vector>
+
+#include "DSP/UnravelReverb.h"
+#include "NoiseSource.h"
+#include "UnravelFactoryPresets.h"
+#include "UnravelTuning.h"
+
+namespace threadbare::bench
+{
+
+// Mirrors the parameter -> state mapping in UnravelProcessor::processAudio.
+inline threadbare::dsp::UnravelState stateForPreset(const threadbare::unravel::FactoryPreset& preset)
+{
+    namespace tuning = threadbare::tuning;
+
+    threadbare::dsp::UnravelState state;
+    for (const auto& [id, value] : preset.parameters)
+    {
+        const std::string_view name { id };
+        if (name == "puckX")           state.puckX = juce::jlimit(-1.0f, 1.0f, value);
+        else if (name == "puckY")      state.puckY = juce::jlimit(-1.0f, 1.0f, value);
+        else if (name == "mix")        state.mix = juce::jlimit(0.0f, 1.0f, value);
+        else if (name == "size")       state.size = juce::jlimit(tuning::Fdn::kSizeMin, tuning::Fdn::kSizeMax, value);
+        else if (name == "decay")      state.decaySeconds = juce::jlimit(tuning::Decay::kT60Min, tuning::Decay::kT60Max, value);
+        else if (name == "tone")       state.tone = juce::jlimit(-1.0f, 1.0f, value);
+        else if (name == "drift")      state.drift = juce::jlimit(0.0f, 1.0f, value);
+        else if (name == "ghost")      state.ghost = juce::jlimit(0.0f, 1.0f, value);
+        else if (name == "glitch")     state.glitch = juce::jlimit(0.0f, 1.0f, value);
+        else if (name == "duck")       state.duck = juce::jlimit(0.0f, 1.0f, value);
+        else if (name == "erPreDelay") state.erPreDelay = juce::jlimit(0.0f, tuning::EarlyReflections::kMaxPreDelayMs, value);
+        else if (name == "freeze")     state.freeze = value > 0.5f;
+    }
+    state.tempo = 120.0f;
+    state.isPlaying = true;
+    return state;
+}
+
+// Four-second stereo loop: plucked partials every half second, a pink noise
+// burst every two seconds and a quiet final second so tails and ducking
+// release. Deterministic for a given rate.
+struct ProgramMaterial
+{
+    std::vector<float> left, right;
+
+    explicit ProgramMaterial(double sampleRate)
+    {
+        const auto length = static_cast<std::size_t>(sampleRate * 4.0);
+        left.assign(length, 0.0f);
+        right.assign(length, 0.0f);
+
+        std::uint32_t rng = 0x5EEDu;
+        constexpr std::array<float, 6> pitches { 220.0f, 277.18f, 329.63f, 440.0f, 392.0f, 164.81f };
+        constexpr auto twoPi = 2.0f * std::numbers::pi_v<float>;
+
+        for (std::size_t note = 0; note < 6; ++note)
+        {
+            const auto onset = static_cast<std::size_t>(static_cast<double>(note) * 0.5 * sampleRate);
+            const float pitch = pitches[note];
+            const float pan = 0.3f + 0.4f * static_cast<float>(note % 2);
+            const float decayPerSample = std::exp(-4.0f / static_cast<float>(sampleRate));
+            float envelope = 0.5f;
+            for (std::size_t i = onset; i < length - static_cast<std::size_t>(sampleRate); ++i)
+            {
+                const float t = static_cast<float>(i - onset) / static_cast<float>(sampleRate);
+                const float tone = std::sin(twoPi * pitch * t)
+                                 + 0.4f * std::sin(twoPi * pitch * 2.0f * t)
+                                 + 0.2f * std::sin(twoPi * pitch * 3.0f * t);
+                left[i] += tone * envelope * (1.0f - pan);
+                right[i] += tone * envelope * pan;
+                envelope *= decayPerSample;
+            }
+        }
+
+        threadbare::core::PinkFilter pinkL, pinkR;
+        for (double burstStart : { 0.25, 2.25 })
+        {
+            const auto start = static_cast<std::size_t>(burstStart * sampleRate);
+            const auto burstLength = static_cast<std::size_t>(0.15 * sampleRate);
+            for (std::size_t i = 0; i < burstLength; ++i)
+            {
+                rng = threadbare::core::nextLcg(rng);
+                const float l = pinkL.process(threadbare::core::lcgToBipolar(rng));
+                rng = threadbare::core::nextLcg(rng);
+                const float r = pinkR.process(threadbare::core::lcgToBipolar(rng));
+                left[start + i] += 0.3f * l;
+                right[start + i] += 0.3f * r;
+            }
+        }
+    }
+
+    void copyTo(std::int64_t position, float* outLeft, float* outRight, int numSamples) const noexcept
+    {
+        const auto length = static_cast<std::int64_t>(left.size());
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const auto index = static_cast<std::size_t>((position + i) % length);
+            outLeft[i] = left[index];
+            outRight[i] = right[index];
+        }
+    }
+};
+
+// Worst-case control traffic for --stress, staged into the state the way
+// UnravelProcessor::processAudio hands it to the reverb. The schedule is in
+// samples, so it is the same at every block size:
+//   - puck X/Y swept at 3 and 4.7 Hz, retargeting every puck-driven smoother
+//     on every block;
+//   - a preset switch every second (all other inputs jump at once);
+//   - looper trigger storms: for the first half second of every two, a random
+//     start/stop every 10 ms, otherwise one every 400 ms. As with
+//     enqueueLooperTrigger, the last action queued before a block wins;
+//   - transport start/stop every 1.5 s (the looper auto-stops on stop).
+// cpuLoad stays 0, so the CPU governor never engages and the numbers are the
+// ungoverned worst case.
+class UnravelStress
+{
+public:
+    explicit UnravelStress(double sampleRateToUse)
+        : sampleRate(sampleRateToUse),
+          presetPeriod(samplesFor(1.0)),
+          stormCycle(samplesFor(2.0)),
+          stormLength(samplesFor(0.5)),
+          stormInterval(samplesFor(0.01)),
+          calmInterval(samplesFor(0.4)),
+          transportPeriod(samplesFor(1.5))
+    {
+        for (const auto& preset : threadbare::unravel::getFactoryPresets())
+            presets.push_back(stateForPreset(preset));
+    }
+
+    void apply(threadbare::dsp::UnravelState& state, std::int64_t blockStart, int numSamples) noexcept
+    {
+        // Inputs only; the reverb's outputs (looper state, meters) carry over.
+        const auto& preset = presets[static_cast<std::size_t>(blockStart / presetPeriod) % presets.size()];
+        state.size = preset.size;
+        state.decaySeconds = preset.decaySeconds;
+        state.tone = preset.tone;
+        state.mix = preset.mix;
+        state.drift = preset.drift;
+        state.ghost = preset.ghost;
+        state.glitch = preset.glitch;
+        state.duck = preset.duck;
+        state.erPreDelay = preset.erPreDelay;
+        state.freeze = preset.freeze;
+        state.tempo = preset.tempo;
+
+        constexpr auto twoPi = 2.0 * std::numbers::pi;
+        const double seconds = static_cast<double>(blockStart) / sampleRate;
+        state.puckX = static_cast<float>(std::sin(twoPi * 3.0 * seconds));
+        state.puckY = static_cast<float>(std::sin(twoPi * 4.7 * seconds + 1.0));
+
+        const bool storm = blockStart % stormCycle < stormLength;
+        state.looperTriggerAction = 0;
+        if (hasMultipleIn(storm ? stormInterval : calmInterval, blockStart, numSamples))
+            state.looperTriggerAction = rng.nextUnipolar() < 0.5f ? 1 : 2;
+
+        state.isPlaying = (blockStart / transportPeriod) % 2 == 0;
+    }
+
+private:
+    std::int64_t samplesFor(double seconds) const noexcept
+    {
+        return std::max<std::int64_t>(1, static_cast<std::int64_t>(seconds * sampleRate));
+    }
+
+    // True when an event scheduled every `period` samples lands in the block.
+    static bool hasMultipleIn(std::int64_t period, std::int64_t blockStart, int numSamples) noexcept
+    {
+        const auto next = (blockStart + period - 1) / period * period;
+        return next < blockStart + numSamples;
+    }
+
+    double sampleRate;
+    std::int64_t presetPeriod, stormCycle, stormLength, stormInterval, calmInterval, transportPeriod;
+    std::vector<threadbare::dsp::UnravelState> presets;
+    threadbare::core::NoiseGenerator rng { 0x5EEDu };
+};
+
+} // namespace threadbare::bench
@@ -0,0 +1,112 @@
+// threadbare_bench_waver: times WaverEngine::process over the factory preset
+// matrix with a looping MIDI phrase, or a headless WaverProcessor under
+// WaverStress with --stress.
+// Besides the options in BenchCommon.h:
+//   --quality=lite|standard|hq   oversampling mode (default standard; --stress
+//                                cycles through all three)
+//   --arp                        run the arpeggiator on the held notes
+
+#include <juce_dsp/juce_dsp.h>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "ProcessorHarness.h"
+#include "WaverHarness.h"
+
+int main(int argc, char* argv[])
+{
+    // The processor's parameter tree needs a MessageManager (see ProcessorHarness.h).
+    const juce::ScopedJuceInitialiser_GUI juceInitialiser;
+    const juce::ArgumentList args(argc, argv);
+    const auto options = threadbare::bench::parseMatrixOptions(args);
+    const auto quality = args.containsOption("--quality") ? args.getValueForOption("--quality") : juce::String("standard");
+    const int oversamplingStages = threadbare::bench::oversamplingStagesFor(quality);
+    const bool arpOn = args.containsOption("--arp");
+
+    juce::Array<juce::var> results;
+
+    for (const double sampleRate : options.sampleRates)
+    {
+        const threadbare::bench::MidiPhrase phrase(sampleRate);
+
+        for (const int blockSize : options.blockSizes)
+        {
+            std::vector<float> left(static_cast<std::size_t>(blockSize));
+            std::vector<float> right(static_cast<std::size_t>(blockSize));
+            juce::MidiBuffer midi;
+            midi.ensureSize(4096);
+
+            if (options.stress)
+            {
+                threadbare::bench::WaverStress stress(sampleRate, blockSize, arpOn);
+                juce::AudioBuffer<float> buffer(2, blockSize);
+
+                juce::ScopedNoDenormals noDenormals;
+                const auto measurement = threadbare::bench::measure(
+                    sampleRate, blockSize, options,
+                    [&](std::int64_t blockIndex, int numSamples)
+                    {
+                        buffer.clear();
+                        stress.fill(midi, blockIndex * blockSize, numSamples);
+                    },
+                    [&](int)
+                    {
+                        stress.process(buffer, midi);
+                    },
+                    [&](int numSamples)
+                    {
+                        return std::max(threadbare::bench::peakOf(buffer.getReadPointer(0), numSamples),
+                                        threadbare::bench::peakOf(buffer.getReadPointer(1), numSamples));
+                    });
+
+                results.add(threadbare::bench::makeResult("stress", sampleRate, blockSize, measurement));
+                continue;
+            }
+
+            for (const auto& preset : threadbare::waver::getFactoryPresets())
+            {
+                if (!options.includesPreset(preset.name))
+                    continue;
+
+                const auto settings = threadbare::bench::settingsForPreset(preset);
+                auto engine = std::make_unique<threadbare::dsp::WaverEngine>();
+                engine->prepare({ sampleRate, static_cast<juce::uint32>(blockSize), 2 }, 0x5EEDu, oversamplingStages);
+                engine->reset();
+
+                juce::ScopedNoDenormals noDenormals;
+                const auto measurement = threadbare::bench::measure(
+                    sampleRate, blockSize, options,
+                    [&](std::int64_t blockIndex, int numSamples)
+                    {
+                        std::fill(left.begin(), left.end(), 0.0f);
+                        std::fill(right.begin(), right.end(), 0.0f);
+                        phrase.fill(midi, blockIndex * blockSize, numSamples);
+                    },
+                    [&](int numSamples)
+                    {
+                        const auto n = static_cast<std::size_t>(numSamples);
+                        threadbare::bench::pushSettings(*engine, settings, arpOn);
+                        engine->process(std::span<float>(left.data(), n), std::span<float>(right.data(), n), midi);
+                    },
+                    [&](int numSamples)
+                    {
+                        return std::max(threadbare::bench::peakOf(left.data(), numSamples),
+                                        threadbare::bench::peakOf(right.data(), numSamples));
+                    });
+
+                results.add(threadbare::bench::makeResult(preset.name, sampleRate, blockSize, measurement));
+            }
+        }
+    }
+
+    juce::DynamicObject::Ptr config = new juce::DynamicObject();
+    config->setProperty("quality", quality);
+    config->setProperty("oversamplingStages", oversamplingStages);
+    config->setProperty("arp", arpOn);
+
+    return threadbare::bench::writeReport("waver", options, config, results);
+}
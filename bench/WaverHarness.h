@@ -0,0 +1,292 @@
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "DSP/WaverEngine.h"
+#include "NoiseSource.h"
+#include "WaverFactoryPresets.h"
+
+namespace threadbare::bench
+{
+
+inline float presetValue(const threadbare::waver::FactoryPreset& preset, std::string_view id)
+{
+    for (const auto& [name, value] : preset.parameters)
+    {
+        if (id == name)
+            return value;
+    }
+    for (const auto& [name, value] : threadbare::waver::kPresetFallbacks)
+    {
+        if (id == name)
+            return value;
+    }
+    jassertfalse;
+    return 0.0f;
+}
+
+// Engine-facing values for one preset, resolved once outside the timed loop.
+struct EngineSettings
+{
+    float portaTime = 0.0f;
+    bool portaAlways = false;
+    int chorusMode = 0;
+    float filterCutoff = 8000.0f;
+    float filterRes = 0.15f;
+    bool ladder = false;
+    float macroShape = 0.5f;
+    float lfoToPwm = 0.0f;
+    float driftAmount = 0.0f;
+    float age = 0.5f;
+    float dcoSubLevel = 0.0f;
+    float noiseLevel = 0.0f;
+    float lfoRate = 1.0f;
+    int lfoShape = 0;
+    float lfoToVibrato = 0.0f;
+    float toyIndex = 0.0f;
+    float toyRatio = 0.0f;
+    float layerDco = 1.0f;
+    float layerToy = 0.0f;
+    float layerOrgan = 0.0f;
+    float envAttack = 0.01f;
+    float envDecay = 0.1f;
+    float envSustain = 1.0f;
+    float envRelease = 0.1f;
+    float filterKeyTrack = 0.0f;
+    float envToFilter = 0.0f;
+    float noiseColor = 0.0f;
+    float stereoWidth = 1.0f;
+    int subOctave = 0;
+    int unisonVoices = 1;
+    float unisonDetune = 0.0f;
+    float organ16 = 0.0f;
+    float organ8 = 0.0f;
+    float organ4 = 0.0f;
+    float organMix = 0.0f;
+    float driveGain = 0.0f;
+    float tapeSat = 0.0f;
+    float wowDepth = 0.0f;
+    float flutterDepth = 0.0f;
+    float hissLevel = 0.0f;
+    float humHz = 60.0f;
+    float printMix = 0.0f;
+    float puckX = 0.0f;
+    float puckY = 0.0f;
+};
+
+inline EngineSettings settingsForPreset(const threadbare::waver::FactoryPreset& preset)
+{
+    const auto value = [&preset](std::string_view id) { return presetValue(preset, id); };
+
+    EngineSettings s;
+    s.portaTime = value("portaTime");
+    s.portaAlways = static_cast<int>(value("portaMode")) == 1;
+    s.chorusMode = static_cast<int>(value("chorusMode"));
+    s.filterCutoff = value("filterCutoff");
+    s.filterRes = value("filterRes");
+    s.ladder = static_cast<int>(value("filterMode")) == 1;
+    s.macroShape = value("macroShape");
+    s.lfoToPwm = value("lfoToPwm");
+    s.driftAmount = value("driftAmount");
+    s.age = (preset.puckY + 1.0f) * 0.5f;
+    s.dcoSubLevel = value("dcoSubLevel");
+    s.noiseLevel = value("noiseLevel");
+    s.lfoRate = value("lfoRate");
+    s.lfoShape = static_cast<int>(value("lfoShape"));
+    s.lfoToVibrato = value("lfoToVibrato");
+    s.toyIndex = value("toyIndex");
+    s.toyRatio = value("toyRatio");
+    s.layerDco = value("layerDco");
+    s.layerToy = value("layerToy");
+    s.layerOrgan = value("layerOrgan");
+    s.envAttack = value("envAttack");
+    s.envDecay = value("envDecay");
+    s.envSustain = value("envSustain");
+    s.envRelease = value("envRelease");
+    s.filterKeyTrack = value("filterKeyTrack");
+    s.envToFilter = value("envToFilter");
+    s.noiseColor = value("noiseColor");
+    s.stereoWidth = value("stereoWidth");
+    s.subOctave = static_cast<int>(value("dcoSubOctave"));
+    s.unisonVoices = static_cast<int>(value("unisonVoices")) + 1;
+    s.unisonDetune = value("unisonDetune");
+    s.organ16 = value("organ16");
+    s.organ8 = value("organ8");
+    s.organ4 = value("organ4");
+    s.organMix = value("organMix");
+    s.driveGain = value("driveGain");
+    s.tapeSat = value("tapeSat");
+    s.wowDepth = value("wowDepth");
+    s.flutterDepth = value("flutterDepth");
+    s.hissLevel = value("hissLevel");
+    s.humHz = static_cast<int>(value("humFreq")) == 0 ? 50.0f : 60.0f;
+    s.printMix = value("printMix");
+    s.puckX = preset.puckX;
+    s.puckY = preset.puckY;
+    return s;
+}
+
+// Mirrors the per-block setter calls in WaverProcessor::processAudio, so the
+// timed loop includes the same parameter traffic as the plugin. The host
+// position defaults to a stopped transport.
+inline void pushSettings(threadbare::dsp::WaverEngine& engine, const EngineSettings& s, bool arpOn,
+                         double hostPpq = 0.0, double hostBpm = 0.0, bool hostPlaying = false) noexcept
+{
+    engine.setPortamento(s.portaTime, s.portaAlways);
+    engine.setChorusMode(s.chorusMode);
+    engine.setFilter(s.filterCutoff, s.filterRes, s.ladder);
+    engine.setWaveBlend(s.macroShape);
+    engine.setLfoToPwm(s.lfoToPwm);
+    engine.setDriftAmount(s.driftAmount);
+    engine.setAge(s.age);
+    engine.setSubLevel(s.dcoSubLevel);
+    engine.setNoiseLevel(s.noiseLevel);
+    engine.setLfoRate(s.lfoRate);
+    engine.setLfoShape(s.lfoShape);
+    engine.setLfoToVibrato(s.lfoToVibrato);
+    engine.setToyParams(s.toyIndex, s.toyRatio, 0.0f);
+    engine.setLayerLevels(s.layerDco, s.layerToy);
+    engine.setEnvelopeParams(s.envAttack, s.envDecay, s.envSustain, s.envRelease);
+    engine.setFilterKeyTrack(s.filterKeyTrack);
+    engine.setEnvToFilter(s.envToFilter);
+    engine.setNoiseColor(s.noiseColor);
+    engine.setStereoWidth(s.stereoWidth);
+    engine.setSubOctave(s.subOctave);
+    engine.setUnison(s.unisonVoices, s.unisonDetune);
+    engine.setOrganDrawbars(s.organ16, s.organ8, s.organ4, s.organMix);
+    // No background worker here: build a queued drawbar table inline.
+    engine.serviceBackgroundWork();
+    engine.setOrganLevel(s.layerOrgan);
+    engine.setPrintParams(s.driveGain, s.tapeSat, s.wowDepth, s.flutterDepth, s.hissLevel, s.humHz, s.printMix);
+    engine.setArpHostPosition(hostPpq, hostBpm, hostPlaying);
+    engine.setArpEnabled(arpOn);
+    if (arpOn)
+        engine.setArpPuck(s.puckX, s.puckY);
+}
+
+// Four-second phrase: a held four-note chord under a mod wheel sweep, then a
+// legato eighth-note line with pitch bend, then the release tails ring out
+// before the loop point.
+struct MidiPhrase
+{
+    struct Event
+    {
+        std::int64_t sample = 0;
+        juce::MidiMessage message;
+    };
+
+    std::int64_t length = 0;
+    std::vector<Event> events;
+
+    MidiPhrase() = default;
+
+    explicit MidiPhrase(double sampleRate)
+    {
+        length = static_cast<std::int64_t>(sampleRate * 4.0);
+        const auto at = [sampleRate](double seconds) { return static_cast<std::int64_t>(seconds * sampleRate); };
+        const auto add = [this](std::int64_t sample, juce::MidiMessage message)
+        {
+            events.push_back({ sample, std::move(message) });
+        };
+
+        for (const int note : { 48, 52, 55, 59 })
+        {
+            add(at(0.0), juce::MidiMessage::noteOn(1, note, static_cast<juce::uint8>(100)));
+            add(at(1.5), juce::MidiMessage::noteOff(1, note));
+        }
+        for (int step = 0; step <= 10; ++step)
+            add(at(0.25 + 0.1 * step), juce::MidiMessage::controllerEvent(1, 1, step * 12));
+
+        constexpr std::array<int, 8> line { 60, 62, 64, 67, 69, 67, 64, 62 };
+        for (std::size_t i = 0; i < line.size(); ++i)
+        {
+            const double start = 1.5 + 0.25 * static_cast<double>(i);
+            add(at(start), juce::MidiMessage::noteOn(1, line[i], static_cast<juce::uint8>(90)));
+            add(at(start + 0.3), juce::MidiMessage::noteOff(1, line[i]));
+        }
+        for (int step = 0; step <= 10; ++step)
+            add(at(2.0 + 0.05 * step), juce::MidiMessage::pitchWheel(1, 8192 + (step % 2 == 0 ? 1200 : -1200)));
+        add(at(2.6), juce::MidiMessage::pitchWheel(1, 8192));
+        add(at(2.6), juce::MidiMessage::controllerEvent(1, 1, 0));
+
+        std::stable_sort(events.begin(), events.end(),
+                         [](const Event& a, const Event& b) { return a.sample < b.sample; });
+    }
+
+    // Block sizes stay well below the loop length, so a block wraps at most once.
+    void fill(juce::MidiBuffer& midi, std::int64_t blockStart, int numSamples) const
+    {
+        midi.clear();
+        const auto loopStart = blockStart % length;
+        for (const auto& event : events)
+        {
+            auto offset = event.sample - loopStart;
+            if (offset < 0)
+                offset += length;
+            if (offset < numSamples)
+                midi.addEvent(event.message, static_cast<int>(offset));
+        }
+    }
+};
+
+// Two-second phrase for --stress: a three-note chord every 62.5 ms held for
+// 80-400 ms (far past the voice count, so steals are constant), pitch bend
+// sweeping the full wheel every 5 ms, channel pressure every 7 ms, the mod
+// wheel every 10 ms and the sustain pedal flipping every half second.
+inline MidiPhrase makeStressPhrase(double sampleRate)
+{
+    MidiPhrase phrase;
+    phrase.length = static_cast<std::int64_t>(sampleRate * 2.0);
+    const auto at = [sampleRate](double seconds) { return static_cast<std::int64_t>(seconds * sampleRate); };
+    const auto add = [&phrase](std::int64_t sample, juce::MidiMessage message)
+    {
+        phrase.events.push_back({ sample % phrase.length, std::move(message) });
+    };
+
+    threadbare::core::NoiseGenerator rng { 0x5EEDu };
+    for (double start = 0.0; start < 2.0; start += 0.0625)
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            const int note = 36 + static_cast<int>(rng.nextUnipolar() * 60.0f);
+            const auto velocity = static_cast<juce::uint8>(40 + static_cast<int>(rng.nextUnipolar() * 87.0f));
+            const double held = 0.08 + 0.32 * static_cast<double>(rng.nextUnipolar());
+            add(at(start), juce::MidiMessage::noteOn(1, note, velocity));
+            add(at(start + held), juce::MidiMessage::noteOff(1, note));
+        }
+    }
+
+    constexpr auto twoPi = 2.0 * std::numbers::pi;
+    for (double t = 0.0; t < 2.0; t += 0.005)
+        add(at(t), juce::MidiMessage::pitchWheel(1, juce::jlimit(0, 16383, 8192 + static_cast<int>(8191.0 * std::sin(twoPi * 3.0 * t)))));
+    for (double t = 0.0; t < 2.0; t += 0.007)
+        add(at(t), juce::MidiMessage::channelPressureChange(1, static_cast<int>(rng.nextUnipolar() * 127.0f)));
+    for (double t = 0.0; t < 2.0; t += 0.01)
+        add(at(t), juce::MidiMessage::controllerEvent(1, 1, static_cast<int>(63.5 + 63.5 * std::sin(twoPi * 1.3 * t))));
+    for (int i = 0; i < 4; ++i)
+        add(at(0.5 * i), juce::MidiMessage::controllerEvent(1, 64, i % 2 == 0 ? 127 : 0));
+
+    std::stable_sort(phrase.events.begin(), phrase.events.end(),
+                     [](const MidiPhrase::Event& a, const MidiPhrase::Event& b) { return a.sample < b.sample; });
+    return phrase;
+}
+
+inline int oversamplingStagesFor(const juce::String& quality)
+{
+    if (quality == "lite")
+        return 0;
+    if (quality == "hq")
+        return 2;
+    return 1;
+}
+
+} // namespace threadbare::bench
@@ -59,6 +59,20 @@ namespace
         const float c3 = 0.5f * (y3 - y0) + 1.5f * (y1 - y2);
         return ((c3 * frac + c2) * frac + c1) * frac + c0;
     }
+    
+    // 6-point, 5th-order Lagrange (x-form) for offline HQ; frac is between y0 and y1
+    inline float lagrange6(float ym2, float ym1, float y0, float y1, float y2, float y3, float frac) noexcept
+    {
+        const float ym1py1 = ym1 + y1;
+        const float twentyFourthYm2py2 = (1.0f / 24.0f) * (ym2 + y2);
+        const float c0 = y0;
+        const float c1 = (1.0f / 20.0f) * ym2 - 0.5f * ym1 - (1.0f / 3.0f) * y0 + y1 - 0.25f * y2 + (1.0f / 30.0f) * y3;
+        const float c2 = (2.0f / 3.0f) * ym1py1 - 1.25f * y0 - twentyFourthYm2py2;
+        const float c3 = (5.0f / 12.0f) * y0 - (7.0f / 12.0f) * y1 + (7.0f / 24.0f) * y2 - (1.0f / 24.0f) * (ym2 + ym1 + y3);
+        const float c4 = 0.25f * y0 - (1.0f / 6.0f) * ym1py1 + twentyFourthYm2py2;
+        const float c5 = (1.0f / 120.0f) * (y3 - ym2) + (1.0f / 24.0f) * (ym1 - y2) + (1.0f / 12.0f) * (y1 - y0);
+        return ((((c5 * frac + c4) * frac + c3) * frac + c2) * frac + c1) * frac + c0;
+    }
 }
 
 void UnravelReverb::prepare(const juce::dsp::ProcessSpec& spec)
@@ -71,6 +85,7 @@ void UnravelReverb::prepare(const juce::dsp::ProcessSpec& spec)
     }
     
     sampleRate = static_cast<int>(spec.sampleRate);
+    profiler.prepare(spec.sampleRate);
     
     // Initialize parameter smoothers with 50ms ramp time for "weighty" feel
     constexpr float smoothingTimeSec = 0.2f; // 200ms for testing (was 50ms)
@@ -479,6 +494,66 @@ void UnravelReverb::reset() noexcept
     focusSmoother.setCurrentAndTargetValue(0.0f);
     diffuseAmountSmoother.setCurrentAndTargetValue(0.0f);
     entropySmoother.setCurrentAndTargetValue(0.0f);
+    
+    // Full engines until load says otherwise
+    governorLevel = 0.0f;
+    ghostSpawnScale = 1.0f;
+    sparkleVoiceCap = threadbare::tuning::GlitchLooper::kMaxVoices;
+    linearReads = false;
+    linearReadMix = 0.0f;
+    linearReadStep = 0.0f;
+    
+    fdnLimiterX1 = 0.0f;
+    outputClipX1L = outputClipX1R = 0.0f;
+}
+
+void UnravelReverb::updateGovernor(float load, std::size_t numSamples) noexcept
+{
+    using threadbare::tuning::Governor;
+    
+    // Offline renders have no deadline: full engines straight away
+    if (highQuality)
+    {
+        governorLevel = 0.0f;
+        ghostSpawnScale = 1.0f;
+        sparkleVoiceCap = threadbare::tuning::GlitchLooper::kMaxVoices;
+        linearReads = false;
+        linearReadMix = 0.0f;
+        linearReadStep = 0.0f;
+        return;
+    }
+    
+    // Ramp toward full degradation above the engage threshold (faster the
+    // further over budget), back toward none below the release threshold,
+    // and hold in between so the level doesn't chatter around one value.
+    const float blockSeconds = static_cast<float>(numSamples) / static_cast<float>(sampleRate);
+    if (load > Governor::kEngageLoad)
+    {
+        const float overshoot = (load - Governor::kEngageLoad) / (1.0f - Governor::kEngageLoad);
+        const float urgency = juce::jlimit(0.25f, 2.0f, overshoot);
+        governorLevel = std::min(1.0f, governorLevel + urgency * blockSeconds / Governor::kAttackSeconds);
+    }
+    else if (load < Governor::kReleaseLoad)
+    {
+        governorLevel = std::max(0.0f, governorLevel - blockSeconds / Governor::kReleaseSeconds);
+    }
+    
+    // Spawn probability scales continuously; the voice cap only stops new
+    // sparkle voices, so sounding ones finish their fragments untouched.
+    ghostSpawnScale = 1.0f - governorLevel * (1.0f - Governor::kMinSpawnScale);
+    const float voiceRange = static_cast<float>(threadbare::tuning::GlitchLooper::kMaxVoices - Governor::kMinSparkleVoices);
+    sparkleVoiceCap = threadbare::tuning::GlitchLooper::kMaxVoices
+                    - static_cast<int>(std::floor(governorLevel * voiceRange + 0.5f));
+    
+    // Interpolation order flips at block boundaries with its own hysteresis,
+    // then crossfades across the block so the switch never clicks
+    if (!linearReads && governorLevel > Governor::kLinearInterpAbove)
+        linearReads = true;
+    else if (linearReads && governorLevel < Governor::kCubicInterpBelow)
+        linearReads = false;
+    
+    const float linearTarget = linearReads ? 1.0f : 0.0f;
+    linearReadStep = (linearTarget - linearReadMix) / static_cast<float>(std::max<std::size_t>(numSamples, 1));
 }
 
 float UnravelReverb::readDelayInterpolated(std::size_t lineIndex, float readPosition) const noexcept
@@ -501,13 +576,22 @@ float UnravelReverb::readDelayInterpolated(std::size_t lineIndex, float readPosi
     const int baseIndex = static_cast<int>(readPosition);
     const float frac = readPosition - static_cast<float>(baseIndex);
     
-    // Get 4 samples for cubic interpolation using SAFE wrapper
-    const float y0 = getSampleSafe(buffer, baseIndex - 1);
     const float y1 = getSampleSafe(buffer, baseIndex);
     const float y2 = getSampleSafe(buffer, baseIndex + 1);
+    
+    // Governor under load: linear (2 taps) instead of cubic
+    const float linear = y1 + frac * (y2 - y1);
+    if (linearReadMix >= 1.0f)
+        return linear;
+    
+    // Get the outer samples for cubic interpolation using SAFE wrapper
+    const float y0 = getSampleSafe(buffer, baseIndex - 1);
     const float y3 = getSampleSafe(buffer, baseIndex + 2);
     
-    return cubicInterp(y0, y1, y2, y3, frac);
+    // Cubic in offline HQ too: inside the loop the interpolator's damping
+    // compounds on every pass, so a different kernel would change the decay.
+    const float full = cubicInterp(y0, y1, y2, y3, frac);
+    return full + linearReadMix * (linear - full);
 }
 
 float UnravelReverb::readGhostHistory(float readPosition) const noexcept
@@ -527,13 +611,23 @@ float UnravelReverb::readGhostHistory(float readPosition) const noexcept
     const int baseIndex = static_cast<int>(readPosition);
     const float frac = readPosition - static_cast<float>(baseIndex);
     
-    // Get 4 samples for cubic interpolation using SAFE wrapper
-    const float y0 = getSampleSafe(ghostHistory, baseIndex - 1);
     const float y1 = getSampleSafe(ghostHistory, baseIndex);
     const float y2 = getSampleSafe(ghostHistory, baseIndex + 1);
+    
+    // Governor under load: linear (2 taps) instead of cubic
+    const float linear = y1 + frac * (y2 - y1);
+    if (linearReadMix >= 1.0f)
+        return linear;
+    
+    // Get the outer samples for cubic interpolation using SAFE wrapper
+    const float y0 = getSampleSafe(ghostHistory, baseIndex - 1);
     const float y3 = getSampleSafe(ghostHistory, baseIndex + 2);
     
-    return cubicInterp(y0, y1, y2, y3, frac);
+    // Offline HQ: 6 taps (dry input history, outside the loop)
+    const float full = highQuality ? lagrange6(getSampleSafe(ghostHistory, baseIndex - 2), y0, y1, y2, y3,
+                                               getSampleSafe(ghostHistory, baseIndex + 3), frac)
+                                   : cubicInterp(y0, y1, y2, y3, frac);
+    return full + linearReadMix * (linear - full);
 }
 
 void UnravelReverb::trySpawnGrain(float ghostAmount, float puckX) noexcept
@@ -759,10 +853,14 @@ void UnravelReverb::process(std::span<float> left,
         return;
 
     juce::ScopedNoDenormals noDenormals;
+    profiler.beginBlock();
 
     const auto numSamples = left.size();
     const int bufferSize = static_cast<int>(delayLines[0].size());
     
+    highQuality = state.highQuality;
+    updateGovernor(state.cpuLoad, numSamples);
+    
     // Set target values once per block (these will ramp smoothly)
     const float puckY = juce::jlimit(-1.0f, 1.0f, state.puckY);
     
@@ -1174,6 +1272,8 @@ void UnravelReverb::process(std::span<float> left,
 
     for (std::size_t sample = 0; sample < numSamples; ++sample)
     {
+        linearReadMix = juce::jlimit(0.0f, 1.0f, linearReadMix + linearReadStep);
+        
         const float inputL = left[sample];
         const float inputR = right[sample];
         const float monoInput = 0.5f * (inputL + inputR);
@@ -1199,6 +1299,9 @@ void UnravelReverb::process(std::span<float> left,
         // Smoothing prevents clicks when moving puck horizontally!
         const float driftAmount = currentDrift * currentDriftDepth;
         
+        // Stage timers (sampled; compiled out unless THREADBARE_STAGE_PROFILING)
+        threadbare::core::StageProfiler<UnravelStage>::Laps laps(profiler, sample);
+        
         // ═════════════════════════════════════════════════════════════════════
         // A. EARLY REFLECTIONS (Proximity - Physical to Ethereal)
         // ═════════════════════════════════════════════════════════════════════
@@ -1260,6 +1363,7 @@ void UnravelReverb::process(std::span<float> left,
             if (erWriteHead >= erBufSize)
                 erWriteHead = 0;
         }
+        laps.mark(UnravelStage::earlyReflections);
         
         // B. Record input into Ghost History (before glitch processing)
         const float originalGainedInput = monoInput;
@@ -1278,6 +1382,7 @@ void UnravelReverb::process(std::span<float> left,
         if (glitchAmount > 0.01f) {
             processGlitchLooper(glitchOutL, glitchOutR, glitchAmount, safeGlitchTempo, puckX, puckY);
         }
+        laps.mark(UnravelStage::glitch);
         
         // Use original input for downstream processing (glitch applied at output)
         const float gainedInput = originalGainedInput;
@@ -1292,8 +1397,8 @@ void UnravelReverb::process(std::span<float> left,
             
             if (samplesSinceLastSpawn >= effectiveSpawnInterval && currentGhost > 0.01f)
             {
-                // Spawn probability scaled by ghost amount
-                const float effectiveProb = currentGhost * spawnProb;
+                // Spawn probability scaled by ghost amount (and thinned by the governor)
+                const float effectiveProb = currentGhost * spawnProb * ghostSpawnScale;
                 
                 if (ghostRng.nextFloat() < effectiveProb)
                     trySpawnGrain(currentGhost, puckX);
@@ -1304,6 +1409,7 @@ void UnravelReverb::process(std::span<float> left,
             // D. Process Ghost Engine (stereo output)
             processGhostEngine(currentGhost, ghostOutputL, ghostOutputR);
         }
+        laps.mark(UnravelStage::ghost);
         
         // E. Mix dry + ghost + ERs into FDN input with proximity control
         //    fdnSend: 0.2 (Left/Physical) → 1.0 (Right/Ethereal)
@@ -1341,7 +1447,11 @@ void UnravelReverb::process(std::span<float> left,
                 -threadbare::tuning::Debug::kInternalHeadroomDb);
             const float headroomCompensation = juce::Decibels::decibelsToGain(
                 threadbare::tuning::Debug::kInternalHeadroomDb);
-            fdnInput = std::tanh(fdnInputRaw * headroomGain) * headroomCompensation;
+            const float limiterInput = fdnInputRaw * headroomGain;
+            const float limited = highQuality ? residualAdaaTanh(limiterInput, fdnLimiterX1)
+                                              : std::tanh(limiterInput);
+            fdnLimiterX1 = limiterInput;
+            fdnInput = limited * headroomCompensation;
         }
         
         // Step A: Read from all 8 delay lines with modulation
@@ -1449,6 +1559,7 @@ void UnravelReverb::process(std::span<float> left,
         constexpr float wetScale = 0.35f;
         wetL *= wetScale;
         wetR *= wetScale;
+        laps.mark(UnravelStage::fdn);
         
         // ═══════════════════════════════════════════════════════════════════════
         // DISINTEGRATION LOOPER PER-SAMPLE PROCESSING
@@ -1949,6 +2060,7 @@ void UnravelReverb::process(std::span<float> left,
         // Update looper state for UI
         state.looperState = currentLooperState;
         state.entropy = entropyAmount;
+        laps.mark(UnravelStage::looper);
         
         // BUG FIX 2: Implement ducking (sidechain-style) - can be disabled via debug switch
         if constexpr (threadbare::tuning::Debug::kEnableEqAndDuck)
@@ -2020,8 +2132,14 @@ void UnravelReverb::process(std::span<float> left,
                 -threadbare::tuning::Debug::kInternalHeadroomDb);
             const float headroomCompensation = juce::Decibels::decibelsToGain(
                 threadbare::tuning::Debug::kInternalHeadroomDb);
-            clippedL = std::tanh(outL * headroomGain) * headroomCompensation;
-            clippedR = std::tanh(outR * headroomGain) * headroomCompensation;
+            const float clipInputL = outL * headroomGain;
+            const float clipInputR = outR * headroomGain;
+            clippedL = (highQuality ? residualAdaaTanh(clipInputL, outputClipX1L) : std::tanh(clipInputL))
+                     * headroomCompensation;
+            clippedR = (highQuality ? residualAdaaTanh(clipInputR, outputClipX1R) : std::tanh(clipInputR))
+                     * headroomCompensation;
+            outputClipX1L = clipInputL;
+            outputClipX1R = clipInputR;
         }
         
         // Remove any DC offset from final output (very gentle 1-pole HPF @ ~3Hz)
@@ -2044,11 +2162,29 @@ void UnravelReverb::process(std::span<float> left,
         
         inputMeterState = inputTarget + meterCoeff * (inputMeterState - inputTarget);
         tailMeterState = tailTarget + meterCoeff * (tailMeterState - tailTarget);
+        laps.mark(UnravelStage::output);
     }
     
     // Update metering state from envelope followers
     state.inLevel = inputMeterState;
     state.tailLevel = tailMeterState;
+
+    // Only the trace reads these; skip the grain pool and FDN scans otherwise.
+    if (state.traceActivity)
+    {
+        state.activeGrains = static_cast<int>(std::count_if(grainPool.begin(), grainPool.end(),
+                                                            [](const Grain& grain) { return grain.active; }));
+        float energy = 0.0f;
+        for (const float line : lpState)
+            energy += line * line;
+        state.fdnEnergy = energy;
+    }
+    state.governorLevel = governorLevel;
+    state.sparkleVoiceCap = sparkleVoiceCap;
+    state.linearInterpolation = linearReads;
+    linearReadMix = linearReads ? 1.0f : 0.0f;
+    linearReadStep = 0.0f;
+    profiler.endBlock(numSamples, state.stageProfile);
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -2074,24 +2210,39 @@ float UnravelReverb::readGhostHistoryInterpolated(float position) const noexcept
     const int idx = static_cast<int>(position);
     const float frac = position - static_cast<float>(idx);
     
-    // Get 4 samples for Catmull-Rom (wrap indices)
-    const int i0 = (idx - 1 + historySize) % historySize;
     const int i1 = idx % historySize;
     const int i2 = (idx + 1) % historySize;
-    const int i3 = (idx + 2) % historySize;
-    
-    const float y0 = ghostHistory[static_cast<size_t>(i0)];
     const float y1 = ghostHistory[static_cast<size_t>(i1)];
     const float y2 = ghostHistory[static_cast<size_t>(i2)];
+    
+    // Governor under load: linear (2 taps) instead of Catmull-Rom
+    const float linear = y1 + frac * (y2 - y1);
+    if (linearReadMix >= 1.0f)
+        return linear;
+    
+    // Outer samples for Catmull-Rom (wrap indices)
+    const int i0 = (idx - 1 + historySize) % historySize;
+    const int i3 = (idx + 2) % historySize;
+    const float y0 = ghostHistory[static_cast<size_t>(i0)];
     const float y3 = ghostHistory[static_cast<size_t>(i3)];
     
+    // Offline HQ: 6 taps (dry input history, outside the loop)
+    if (highQuality)
+    {
+        const float ym2 = ghostHistory[static_cast<size_t>((idx - 2 + historySize) % historySize)];
+        const float y4 = ghostHistory[static_cast<size_t>((idx + 3) % historySize)];
+        const float full = lagrange6(ym2, y0, y1, y2, y3, y4, frac);
+        return full + linearReadMix * (linear - full);
+    }
+    
     // Catmull-Rom interpolation coefficients
     const float c0 = y1;
     const float c1 = 0.5f * (y2 - y0);
     const float c2 = y0 - 2.5f * y1 + 2.0f * y2 - 0.5f * y3;
     const float c3 = 0.5f * (y3 - y0) + 1.5f * (y1 - y2);
     
-    return ((c3 * frac + c2) * frac + c1) * frac + c0;
+    const float full = ((c3 * frac + c2) * frac + c1) * frac + c0;
+    return full + linearReadMix * (linear - full);
 }
 
 void UnravelReverb::processGlitchLooper(
@@ -2155,9 +2306,9 @@ void UnravelReverb::processGlitchLooper(
     }
     
     // Determine max voices based on glitch amount
-    const int maxActiveVoices = static_cast<int>(juce::jmap(glitchAmount,
+    const int maxActiveVoices = std::min(sparkleVoiceCap, static_cast<int>(juce::jmap(glitchAmount,
         static_cast<float>(GlitchLooper::kVoicesAtLow),
-        static_cast<float>(GlitchLooper::kVoicesAtHigh)));
+        static_cast<float>(GlitchLooper::kVoicesAtHigh))));
     
     // Try to trigger new voice
     if (glitchAmount > 0.01f && activeVoices < maxActiveVoices && sparkleTriggerSamples <= 0) {
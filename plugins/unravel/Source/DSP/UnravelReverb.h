@@ -1,11 +1,13 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <span>
 #include <vector>
 
 #include <juce_dsp/juce_dsp.h>
 #include "../UnravelTuning.h"
+#include "StageProfiler.h"
 
 namespace threadbare::dsp
 {
@@ -19,6 +21,23 @@ enum class LooperState {
     Looping     // Playback with disintegration
 };
 
+// Per-sample stages timed by THREADBARE_STAGE_PROFILING builds, in loop order.
+enum class UnravelStage : std::uint8_t {
+    earlyReflections,
+    glitch,     // includes the ghost history write
+    ghost,      // grain spawn + render
+    fdn,
+    looper,
+    output,     // ducking, mix, injections, clip, DC, meters
+    count
+};
+
+inline constexpr std::array<const char*, static_cast<std::size_t>(UnravelStage::count)> kUnravelStageNames {
+    "er", "glitch", "ghost", "fdn", "looper", "output"
+};
+
+using UnravelStageProfile = threadbare::core::StageProfile<static_cast<std::size_t>(UnravelStage::count)>;
+
 struct UnravelState
 {
     float size = 1.0f;
@@ -46,6 +65,23 @@ struct UnravelState
     
     // === TRANSPORT STATE (from DAW) ===
     bool isPlaying = true;          // DAW transport state (for auto-stop)
+
+    // === ENGINE ACTIVITY (output, for trace counters) ===
+    bool traceActivity = false;     // Input: fill the two below (trace is recording)
+    int activeGrains = 0;           // Ghost grains sounding at block end
+    float fdnEnergy = 0.0f;         // Sum of squared FDN line states at block end
+
+    // === CPU GOVERNOR ===
+    float cpuLoad = 0.0f;           // Input: smoothed load pressure (1.0 = deadline)
+    float governorLevel = 0.0f;     // Output: degradation 0 (full engines) - 1 (thinnest)
+    int sparkleVoiceCap = threadbare::tuning::GlitchLooper::kMaxVoices; // Output
+    bool linearInterpolation = false; // Output: FDN/ghost reads dropped to linear
+
+    // === RENDER QUALITY (input) ===
+    bool highQuality = false;       // Offline render: 6-point ghost reads, ADAA clippers, governor off
+
+    // === STAGE PROFILE (output to dev overlay, zero unless profiling) ===
+    UnravelStageProfile stageProfile;
 };
 
 class UnravelReverb
@@ -65,6 +101,7 @@ private:
     static constexpr std::size_t kMaxGrains = 8;
     
     int sampleRate = 48000;
+    threadbare::core::StageProfiler<UnravelStage> profiler;
     
     // Smoothed parameters for "creamy" knobs (no zipper noise)
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> sizeSmoother;
@@ -120,7 +157,7 @@ private:
     // GLITCH SPARKLE STATE
     // Multi-voice granular sparkle - shimmering, articulate fragments
     // ═══════════════════════════════════════════════════════════════════════
-    static constexpr std::size_t kSparkleVoices = 4;
+    static constexpr std::size_t kSparkleVoices = static_cast<std::size_t>(threadbare::tuning::GlitchLooper::kMaxVoices);
     
     struct SparkleVoice {
         float readPos = 0.0f;       // Current read position in ghostHistory (fractional)
@@ -389,6 +426,31 @@ private:
         return result;
     }
     
+    // tanh with first-order ADAA on the residual tanh(x) - x only: the linear
+    // part passes undelayed, so HQ changes aliasing, not timing or frequency
+    // response. x1 is the previous input. Double precision: the difference
+    // quotient cancels badly in float.
+    static float residualAdaaTanh(float x, float x1) noexcept
+    {
+        // Antiderivative of tanh(v) - v: ln(cosh v) - v^2/2
+        const auto antiderivative = [](double v) {
+            const double a = std::abs(v);
+            return a + std::log1p(std::exp(-2.0 * a)) - 0.6931471805599453 - 0.5 * v * v;
+        };
+        
+        const double xd = x;
+        const double x1d = x1;
+        const double diff = xd - x1d;
+        double residual;
+        if (std::abs(diff) < 1.0e-4) {
+            const double mid = 0.5 * (xd + x1d);  // Midpoint fallback
+            residual = std::tanh(mid) - mid;
+        } else {
+            residual = (antiderivative(xd) - antiderivative(x1d)) / diff;
+        }
+        return x + static_cast<float>(residual);
+    }
+    
     // === DISINTEGRATION DSP HELPERS ===
     // SVF implementation (Cytomic/Vadim TPT topology - correct formula)
     // g = tan(pi * fc / fs), k = 2 - 2*resonance (k=2 for no resonance)
@@ -447,7 +509,25 @@ private:
     float dcOffsetL = 0.0f;
     float dcOffsetR = 0.0f;
     
+    // CPU governor (see tuning::Governor): block-rate, driven by state.cpuLoad
+    float governorLevel = 0.0f;         // 0 = full engines, 1 = thinnest
+    float ghostSpawnScale = 1.0f;       // Multiplies the grain spawn probability
+    int sparkleVoiceCap = threadbare::tuning::GlitchLooper::kMaxVoices;
+    bool linearReads = false;           // FDN/ghost reads use linear instead of cubic
+    float linearReadMix = 0.0f;         // 0 = cubic, 1 = linear; crossfades over a block on a switch
+    float linearReadStep = 0.0f;
+    
+    // Offline HQ (state.highQuality): 6-point ghost history reads and ADAA on
+    // the FDN input limiter and output clipper. FDN loop reads stay cubic so
+    // the tail decays as in playback. The ADAA inputs are tracked in every
+    // mode so switching mid-stream is seamless.
+    bool highQuality = false;
+    float fdnLimiterX1 = 0.0f;
+    float outputClipX1L = 0.0f;
+    float outputClipX1R = 0.0f;
+    
     // Helper functions
+    void updateGovernor(float load, std::size_t numSamples) noexcept;
     float readDelayInterpolated(std::size_t lineIndex, float readPosition) const noexcept;
     float readGhostHistory(float readPosition) const noexcept;
     void trySpawnGrain(float ghostAmount, float puckX) noexcept;
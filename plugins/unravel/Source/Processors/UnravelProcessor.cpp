@@ -1,10 +1,14 @@
 #include "UnravelProcessor.h"
-#include "UI/UnravelEditor.h"
+#if ! THREADBARE_HEADLESS
+ #include "UI/UnravelEditor.h"
+#endif
 #include "../UnravelTuning.h"
+#include "../UnravelFactoryPresets.h"
 #include "../UnravelGeneratedParams.h"
 
 #include <juce_audio_utils/juce_audio_utils.h>
 #include <memory>
+#include <utility>
 #include <vector>
 
 UnravelProcessor::UnravelProcessor()
@@ -33,25 +37,6 @@ void UnravelProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 
     reverbEngine.prepare(spec);
     stateQueue.reset();
-
-    const auto getFloat = [this](const juce::String& id)
-    {
-        return dynamic_cast<juce::AudioParameterFloat*>(apvts.getParameter(id));
-    };
-
-    puckXParam = getFloat("puckX");
-    puckYParam = getFloat("puckY");
-    mixParam = getFloat("mix");
-    sizeParam = getFloat("size");
-    decayParam = getFloat("decay");
-    toneParam = getFloat("tone");
-    driftParam = getFloat("drift");
-    ghostParam = getFloat("ghost");
-    glitchParam = getFloat("glitch");
-    duckParam = getFloat("duck");
-    erPreDelayParam = getFloat("erPreDelay");
-    freezeParam = dynamic_cast<juce::AudioParameterBool*>(apvts.getParameter("freeze"));
-    outputParam = getFloat("output");
 }
 
 void UnravelProcessor::releaseResources() {}
@@ -62,7 +47,7 @@ void UnravelProcessor::reset()
     stateQueue.reset();
 }
 
-void UnravelProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi)
+void UnravelProcessor::processAudio(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi)
 {
     juce::ignoreUnused(midi);
 
@@ -83,32 +68,32 @@ void UnravelProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Midi
             buffer.clear(ch, 0, numSamples);
     }
 
-    const auto readParam = [](auto* param, float fallback) -> float
-    {
-        return param != nullptr ? param->get() : fallback;
-    };
-
     const auto clamp = [](float value, float lo, float hi) { return juce::jlimit(lo, hi, value); };
 
-    currentState.puckX = clamp(readParam(puckXParam, 0.0f), -1.0f, 1.0f);
-    currentState.puckY = clamp(readParam(puckYParam, 0.0f), -1.0f, 1.0f);
-    currentState.mix = clamp(readParam(mixParam, 0.5f), 0.0f, 1.0f);
-    currentState.size = clamp(readParam(sizeParam, 1.0f), 
+    currentState.puckX = clamp(params.puckX(), -1.0f, 1.0f);
+    currentState.puckY = clamp(params.puckY(), -1.0f, 1.0f);
+    currentState.mix = clamp(params.mix(), 0.0f, 1.0f);
+    currentState.size = clamp(params.size(), 
                              threadbare::tuning::Fdn::kSizeMin, 
                              threadbare::tuning::Fdn::kSizeMax);
-    currentState.decaySeconds = clamp(readParam(decayParam, 5.0f), 
+    currentState.decaySeconds = clamp(params.decay(), 
                                      threadbare::tuning::Decay::kT60Min, 
                                      threadbare::tuning::Decay::kT60Max);
-    currentState.tone = clamp(readParam(toneParam, 0.0f), -1.0f, 1.0f);
-    currentState.drift = clamp(readParam(driftParam, 0.2f), 0.0f, 1.0f);
-    currentState.ghost = clamp(readParam(ghostParam, 0.0f), 0.0f, 1.0f);
-    currentState.glitch = clamp(readParam(glitchParam, 0.0f), 0.0f, 1.0f);
-    currentState.duck = clamp(readParam(duckParam, 0.0f), 0.0f, 1.0f);
-    currentState.erPreDelay = clamp(readParam(erPreDelayParam, 0.0f), 
+    currentState.tone = clamp(params.tone(), -1.0f, 1.0f);
+    currentState.drift = clamp(params.drift(), 0.0f, 1.0f);
+    currentState.ghost = clamp(params.ghost(), 0.0f, 1.0f);
+    currentState.glitch = clamp(params.glitch(), 0.0f, 1.0f);
+    currentState.duck = clamp(params.duck(), 0.0f, 1.0f);
+    currentState.erPreDelay = clamp(params.erPreDelay(), 
                                    0.0f, 
                                    threadbare::tuning::EarlyReflections::kMaxPreDelayMs);
-    currentState.freeze = freezeParam != nullptr ? freezeParam->get() : false;
+    currentState.freeze = params.freeze();
     currentState.looperTriggerAction = 0;
+    currentState.traceActivity = trace.isRecording();
+
+    // Offline renders have no deadline: highest-quality paths, no governor
+    currentState.highQuality = isNonRealtime();
+    currentState.cpuLoad = currentState.highQuality ? 0.0f : getLoadPressure();
 
     {
         int start1 = 0;
@@ -143,15 +128,43 @@ void UnravelProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Midi
         }
     }
 
+    if (currentState.looperTriggerAction != 0)
+        trace.instant("looperTrigger", static_cast<float>(currentState.looperTriggerAction));
+
+    trace.begin("reverb");
     reverbEngine.process(leftSpan, rightSpan, currentState);
+    trace.end("reverb");
+    traceEngineActivity();
     currentState.looperTriggerAction = 0;
 
-    const float outputGain = juce::Decibels::decibelsToGain(readParam(outputParam, 0.0f));
+    const float outputGain = juce::Decibels::decibelsToGain(params.output());
     buffer.applyGain(outputGain);
 
     stateQueue.push(currentState);
 }
 
+void UnravelProcessor::traceEngineActivity() noexcept
+{
+    using threadbare::dsp::LooperState;
+
+    // Looper states become spans; Idle is the gap between them.
+    if (currentState.looperState != tracedLooperState)
+    {
+        const auto spanName = [](LooperState state) {
+            return state == LooperState::Recording ? "looper.recording" : "looper.looping";
+        };
+        if (tracedLooperState != LooperState::Idle)
+            trace.endSpan(spanName(tracedLooperState));
+        if (currentState.looperState != LooperState::Idle)
+            trace.beginSpan(spanName(currentState.looperState));
+        tracedLooperState = currentState.looperState;
+    }
+
+    trace.counter("activeGrains", static_cast<float>(currentState.activeGrains));
+    trace.counter("fdnEnergy", currentState.fdnEnergy);
+    trace.counter("governorLevel", currentState.governorLevel);
+}
+
 void UnravelProcessor::enqueueLooperTrigger(int action) noexcept
 {
     int start1 = 0;
@@ -175,10 +188,14 @@ void UnravelProcessor::enqueueLooperTrigger(int action) noexcept
 //==============================================================================
 juce::AudioProcessorEditor* UnravelProcessor::createEditor()
 {
+   #if THREADBARE_HEADLESS
+    return nullptr;
+   #else
     return new UnravelEditor(*this);
+   #endif
 }
 
-bool UnravelProcessor::hasEditor() const { return true; }
+bool UnravelProcessor::hasEditor() const { return ! THREADBARE_HEADLESS; }
 
 //==============================================================================
 const juce::String UnravelProcessor::getName() const { return "UnravelProcessor"; }
@@ -246,6 +263,9 @@ bool UnravelProcessor::popVisualState(threadbare::dsp::UnravelState& state) noex
 
     while (stateQueue.pop(latest))
     {
+        // Stage timings keep the worst block since the last frame
+        if (popped)
+            latest.stageProfile.mergeMax(state.stageProfile);
         state = latest;
         popped = true;
     }
@@ -257,32 +277,27 @@ void UnravelProcessor::pushCurrentState() noexcept
 {
     // Read current parameter values and push to state queue
     // This forces an immediate UI update (e.g., after preset load)
-    const auto readParam = [](auto* param, float fallback) -> float
-    {
-        return param != nullptr ? param->get() : fallback;
-    };
-
     const auto clamp = [](float value, float lo, float hi) { return juce::jlimit(lo, hi, value); };
 
     threadbare::dsp::UnravelState state{};
-    state.puckX = clamp(readParam(puckXParam, 0.0f), -1.0f, 1.0f);
-    state.puckY = clamp(readParam(puckYParam, 0.0f), -1.0f, 1.0f);
-    state.mix = clamp(readParam(mixParam, 0.5f), 0.0f, 1.0f);
-    state.size = clamp(readParam(sizeParam, 1.0f), 
+    state.puckX = clamp(params.puckX(), -1.0f, 1.0f);
+    state.puckY = clamp(params.puckY(), -1.0f, 1.0f);
+    state.mix = clamp(params.mix(), 0.0f, 1.0f);
+    state.size = clamp(params.size(), 
                        threadbare::tuning::Fdn::kSizeMin, 
                        threadbare::tuning::Fdn::kSizeMax);
-    state.decaySeconds = clamp(readParam(decayParam, 5.0f), 
+    state.decaySeconds = clamp(params.decay(), 
                                threadbare::tuning::Decay::kT60Min, 
                                threadbare::tuning::Decay::kT60Max);
-    state.tone = clamp(readParam(toneParam, 0.0f), -1.0f, 1.0f);
-    state.drift = clamp(readParam(driftParam, 0.2f), 0.0f, 1.0f);
-    state.ghost = clamp(readParam(ghostParam, 0.0f), 0.0f, 1.0f);
-    state.glitch = clamp(readParam(glitchParam, 0.0f), 0.0f, 1.0f);
-    state.duck = clamp(readParam(duckParam, 0.0f), 0.0f, 1.0f);
-    state.erPreDelay = clamp(readParam(erPreDelayParam, 0.0f), 
+    state.tone = clamp(params.tone(), -1.0f, 1.0f);
+    state.drift = clamp(params.drift(), 0.0f, 1.0f);
+    state.ghost = clamp(params.ghost(), 0.0f, 1.0f);
+    state.glitch = clamp(params.glitch(), 0.0f, 1.0f);
+    state.duck = clamp(params.duck(), 0.0f, 1.0f);
+    state.erPreDelay = clamp(params.erPreDelay(), 
                              0.0f, 
                              threadbare::tuning::EarlyReflections::kMaxPreDelayMs);
-    state.freeze = freezeParam != nullptr ? freezeParam->get() : false;
+    state.freeze = params.freeze();
     state.tempo = currentState.tempo;  // Keep current tempo from audio thread
 
     stateQueue.push(state);
@@ -294,180 +309,23 @@ juce::AudioProcessorValueTreeState::ParameterLayout UnravelProcessor::createPara
     return threadbare::unravel::UnravelGeneratedParams::createParameterLayout();
 }
 
+#if ! THREADBARE_HEADLESS
 juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
 {
     return new UnravelProcessor();
 }
+#endif
 
 void UnravelProcessor::initialiseFactoryPresets()
 {
-    auto preset = [](juce::String name, std::map<juce::String, float> params)
+    factoryPresets.clear();
+    for (const auto& factory : threadbare::unravel::getFactoryPresets())
     {
-        return Preset{std::move(name), std::move(params)};
-    };
-
-    factoryPresets = {
-        // 1. unravel [INIT/DEFAULT] - balanced starting point
-        preset("unravel",
-               {{"puckX", 0.0f},
-                {"puckY", 0.2f},
-                {"decay", 3.2f},
-                {"erPreDelay", 25.0f},
-                {"size", 1.1f},
-                {"tone", -0.2f},
-                {"drift", 0.35f},
-                {"ghost", 0.4f},
-                {"glitch", 0.0f},
-                {"duck", 0.0f},
-                {"mix", 0.45f},
-                {"output", 0.0f},
-                {"freeze", 0.0f}}),
-
-        // 2. close - dry and intimate with max sparkle fragments
-        preset("close",
-               {{"puckX", -0.8f},
-                {"puckY", -0.6f},
-                {"decay", 0.8f},
-                {"erPreDelay", 5.0f},
-                {"size", 0.6f},
-                {"tone", -0.30f},
-                {"drift", 0.05f},
-                {"ghost", 0.15f},
-                {"glitch", 1.0f},
-                {"duck", 0.0f},
-                {"mix", 0.35f},
-                {"output", 0.0f},
-                {"freeze", 0.0f}}),
-
-        // 3. tether - grounded with subtle sparkle
-        preset("tether",
-               {{"puckX", -0.5f},
-                {"puckY", 0.1f},
-                {"decay", 2.4f},
-                {"erPreDelay", 18.0f},
-                {"size", 0.95f},
-                {"tone", -0.25f},
-                {"drift", 0.20f},
-                {"ghost", 0.20f},
-                {"glitch", 0.15f},
-                {"duck", 0.30f},
-                {"mix", 0.38f},
-                {"output", 0.0f},
-                {"freeze", 0.0f}}),
-
-        // 4. pulse - rhythmic ducking
-        preset("pulse",
-               {{"puckX", 0.25f},
-                {"puckY", 0.10f},
-                {"decay", 4.5f},
-                {"erPreDelay", 12.0f},
-                {"size", 1.15f},
-                {"tone", -0.15f},
-                {"drift", 0.35f},
-                {"ghost", 0.25f},
-                {"glitch", 0.0f},
-                {"duck", 0.85f},
-                {"mix", 0.55f},
-                {"output", -1.0f},
-                {"freeze", 0.0f}}),
-
-        // 5. bloom - lush expansion with gentle sparkle
-        preset("bloom",
-               {{"puckX", 0.40f},
-                {"puckY", 0.80f},
-                {"decay", 10.0f},
-                {"erPreDelay", 40.0f},
-                {"size", 1.70f},
-                {"tone", 0.05f},
-                {"drift", 0.50f},
-                {"ghost", 0.55f},
-                {"glitch", 0.20f},
-                {"duck", 0.0f},
-                {"mix", 0.60f},
-                {"output", -2.0f},
-                {"freeze", 0.0f}}),
-
-        // 6. mist - dark fog, no sparkle
-        preset("mist",
-               {{"puckX", 0.90f},
-                {"puckY", 0.60f},
-                {"decay", 14.0f},
-                {"erPreDelay", 70.0f},
-                {"size", 1.85f},
-                {"tone", -0.60f},
-                {"drift", 0.60f},
-                {"ghost", 0.70f},
-                {"glitch", 0.0f},
-                {"duck", 0.0f},
-                {"mix", 0.65f},
-                {"output", -3.0f},
-                {"freeze", 0.0f}}),
-
-        // 7. rewind - memory playback, sparkle fragments
-        preset("rewind",
-               {{"puckX", 0.30f},
-                {"puckY", 0.5f},
-                {"decay", 6.0f},
-                {"erPreDelay", 20.0f},
-                {"size", 1.25f},
-                {"tone", -0.20f},
-                {"drift", 0.55f},
-                {"ghost", 0.85f},
-                {"glitch", 0.45f},
-                {"duck", 0.0f},
-                {"mix", 0.50f},
-                {"output", -1.0f},
-                {"freeze", 0.0f}}),
-
-        // 8. halation - bright glow with shimmer
-        preset("halation",
-               {{"puckX", 0.85f},
-                {"puckY", 0.70f},
-                {"decay", 9.0f},
-                {"erPreDelay", 45.0f},
-                {"size", 1.90f},
-                {"tone", 0.50f},
-                {"drift", 0.45f},
-                {"ghost", 0.60f},
-                {"glitch", 0.30f},
-                {"duck", 0.0f},
-                {"mix", 0.55f},
-                {"output", -2.0f},
-                {"freeze", 0.0f}}),
-
-        // 9. stasis - frozen stillness
-        preset("stasis",
-               {{"puckX", 0.0f},
-                {"puckY", 0.30f},
-                {"decay", 20.0f},
-                {"erPreDelay", 0.0f},
-                {"size", 1.50f},
-                {"tone", -0.40f},
-                {"drift", 0.60f},
-                {"ghost", 1.0f},
-                {"glitch", 0.0f},
-                {"duck", 0.0f},
-                {"mix", 0.75f},
-                {"output", -3.0f},
-                {"freeze", 0.0f}}),
-
-        // 10. shiver - extreme with sparkle bursts
-        preset("shiver",
-               {{"puckX", 1.0f},
-                {"puckY", 1.0f},
-                {"decay", 25.0f},
-                {"erPreDelay", 15.0f},
-                {"size", 2.0f},
-                {"tone", 0.35f},
-                {"drift", 0.80f},
-                {"ghost", 1.0f},
-                {"glitch", 0.60f},
-                {"duck", 0.0f},
-                {"mix", 0.75f},
-                {"output", -3.0f},
-                {"freeze", 0.0f}})
-    };
-
+        Preset preset { factory.name, {} };
+        for (const auto& [id, value] : factory.parameters)
+            preset.parameters[id] = value;
+        factoryPresets.push_back(std::move(preset));
+    }
 }
 
 void UnravelProcessor::applyPreset(const Preset& preset)
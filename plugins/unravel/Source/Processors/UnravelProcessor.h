@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "../DSP/UnravelReverb.h"
+#include "../UnravelGeneratedParams.h"
 #include "ProcessorBase.h"
 
 class UnravelProcessor final : public threadbare::core::ProcessorBase
@@ -18,7 +19,7 @@ public:
     void prepareToPlay(double sampleRate, int samplesPerBlock) override;
     void releaseResources() override;
     void reset() override;
-    void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processAudio(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
@@ -61,31 +62,21 @@ private:
 
     threadbare::dsp::UnravelReverb reverbEngine;
     threadbare::dsp::UnravelState currentState;
+    threadbare::dsp::LooperState tracedLooperState = threadbare::dsp::LooperState::Idle;
     std::array<int, kLooperTriggerCapacity> looperTriggerBuffer {};
     juce::AbstractFifo looperTriggerQueue { kLooperTriggerCapacity };
 
     // Use shared StateQueue template
     threadbare::core::StateQueue<threadbare::dsp::UnravelState> stateQueue;
 
-    juce::AudioParameterFloat* puckXParam = nullptr;
-    juce::AudioParameterFloat* puckYParam = nullptr;
-    juce::AudioParameterFloat* mixParam = nullptr;
-    juce::AudioParameterFloat* sizeParam = nullptr;
-    juce::AudioParameterFloat* decayParam = nullptr;
-    juce::AudioParameterFloat* toneParam = nullptr;
-    juce::AudioParameterFloat* driftParam = nullptr;
-    juce::AudioParameterFloat* ghostParam = nullptr;
-    juce::AudioParameterFloat* glitchParam = nullptr;
-    juce::AudioParameterFloat* duckParam = nullptr;
-    juce::AudioParameterFloat* erPreDelayParam = nullptr;
-    juce::AudioParameterBool* freezeParam = nullptr;
-    juce::AudioParameterFloat* outputParam = nullptr;
+    threadbare::unravel::UnravelGeneratedParams::ParamCache params { apvts };
 
     std::vector<Preset> factoryPresets;
     int currentProgramIndex = 0;
 
     void initialiseFactoryPresets();
     void applyPreset(const Preset& preset);
+    void traceEngineActivity() noexcept;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(UnravelProcessor)
 };
@@ -186,6 +186,37 @@ namespace
                       completion(false);
                   }
               }
+            },
+
+            // resetDeadlineStats: Clear the overrun counters shown in the dev overlay
+            { "resetDeadlineStats",
+              [processorPtr](const juce::Array<juce::var>&,
+                            juce::WebBrowserComponent::NativeFunctionCompletion completion)
+              {
+                  processorPtr->resetDeadlineStats();
+                  completion({});
+              }
+            },
+
+            // setTraceRecording: Start/stop the trace rings of every instance
+            { "setTraceRecording",
+              [processorPtr](const juce::Array<juce::var>& args,
+                            juce::WebBrowserComponent::NativeFunctionCompletion completion)
+              {
+                  auto& session = processorPtr->getTraceSession();
+                  if (args.size() >= 1)
+                      session.setRecording(static_cast<bool>(args[0]));
+                  completion(session.isRecording());
+              }
+            },
+
+            // exportTrace: Write every instance's ring as Chrome trace JSON (background thread)
+            { "exportTrace",
+              [processorPtr](const juce::Array<juce::var>&,
+                            juce::WebBrowserComponent::NativeFunctionCompletion completion)
+              {
+                  completion(processorPtr->getTraceSession().exportTrace().getFullPathName());
+              }
             }
         };
     }
@@ -279,6 +310,25 @@ void UnravelEditor::handleUpdate()
     // Current preset
     obj->setProperty("currentPreset", processorRef.getCurrentProgram());
 
+    // Block load vs. real-time deadline (all builds), plus what the CPU
+    // governor has thinned to stay inside it
+    auto deadline = threadbare::core::WebViewBridge::deadlineSnapshotToVar(processorRef.getDeadlineSnapshot());
+    if (auto* deadlineObj = deadline.getDynamicObject())
+    {
+        auto* governor = new juce::DynamicObject();
+        governor->setProperty("level", state.governorLevel);
+        governor->setProperty("sparkleVoices", state.sparkleVoiceCap);
+        governor->setProperty("linearInterpolation", state.linearInterpolation);
+        deadlineObj->setProperty("governor", juce::var(governor));
+    }
+    obj->setProperty("deadline", deadline);
+
+    // Stage timings for the dev overlay (profiling builds only)
+   #if THREADBARE_STAGE_PROFILING
+    obj->setProperty("stageProfile", threadbare::core::WebViewBridge::stageProfileToVar(
+                                         threadbare::dsp::kUnravelStageNames, state.stageProfile));
+   #endif
+
     // juce::JSON::toString takes a pointer or reference depending on version, 
     // wrapping it in a var ensures safety.
     const auto jsonString = juce::JSON::toString(juce::var(obj));
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+namespace threadbare::unravel
+{
+
+// Factory presets, shared by the processor and the headless benchmarks.
+// Values are in parameter units (see config/params.json).
+struct FactoryPreset
+{
+    const char* name = "";
+    std::vector<std::pair<const char*, float>> parameters;
+};
+
+inline const std::vector<FactoryPreset>& getFactoryPresets()
+{
+    static const std::vector<FactoryPreset> presets {
+        // 1. unravel [INIT/DEFAULT] - balanced starting point
+        {"unravel", {
+            {"puckX", 0.0f},
+            {"puckY", 0.2f},
+            {"decay", 3.2f},
+            {"erPreDelay", 25.0f},
+            {"size", 1.1f},
+            {"tone", -0.2f},
+            {"drift", 0.35f},
+            {"ghost", 0.4f},
+            {"glitch", 0.0f},
+            {"duck", 0.0f},
+            {"mix", 0.45f},
+            {"output", 0.0f},
+            {"freeze", 0.0f}}},
+
+        // 2. close - dry and intimate with max sparkle fragments
+        {"close", {
+            {"puckX", -0.8f},
+            {"puckY", -0.6f},
+            {"decay", 0.8f},
+            {"erPreDelay", 5.0f},
+            {"size", 0.6f},
+            {"tone", -0.30f},
+            {"drift", 0.05f},
+            {"ghost", 0.15f},
+            {"glitch", 1.0f},
+            {"duck", 0.0f},
+            {"mix", 0.35f},
+            {"output", 0.0f},
+            {"freeze", 0.0f}}},
+
+        // 3. tether - grounded with subtle sparkle
+        {"tether", {
+            {"puckX", -0.5f},
+            {"puckY", 0.1f},
+            {"decay", 2.4f},
+            {"erPreDelay", 18.0f},
+            {"size", 0.95f},
+            {"tone", -0.25f},
+            {"drift", 0.20f},
+            {"ghost", 0.20f},
+            {"glitch", 0.15f},
+            {"duck", 0.30f},
+            {"mix", 0.38f},
+            {"output", 0.0f},
+            {"freeze", 0.0f}}},
+
+        // 4. pulse - rhythmic ducking
+        {"pulse", {
+            {"puckX", 0.25f},
+            {"puckY", 0.10f},
+            {"decay", 4.5f},
+            {"erPreDelay", 12.0f},
+            {"size", 1.15f},
+            {"tone", -0.15f},
+            {"drift", 0.35f},
+            {"ghost", 0.25f},
+            {"glitch", 0.0f},
+            {"duck", 0.85f},
+            {"mix", 0.55f},
+            {"output", -1.0f},
+            {"freeze", 0.0f}}},
+
+        // 5. bloom - lush expansion with gentle sparkle
+        {"bloom", {
+            {"puckX", 0.40f},
+            {"puckY", 0.80f},
+            {"decay", 10.0f},
+            {"erPreDelay", 40.0f},
+            {"size", 1.70f},
+            {"tone", 0.05f},
+            {"drift", 0.50f},
+            {"ghost", 0.55f},
+            {"glitch", 0.20f},
+            {"duck", 0.0f},
+            {"mix", 0.60f},
+            {"output", -2.0f},
+            {"freeze", 0.0f}}},
+
+        // 6. mist - dark fog, no sparkle
+        {"mist", {
+            {"puckX", 0.90f},
+            {"puckY", 0.60f},
+            {"decay", 14.0f},
+            {"erPreDelay", 70.0f},
+            {"size", 1.85f},
+            {"tone", -0.60f},
+            {"drift", 0.60f},
+            {"ghost", 0.70f},
+            {"glitch", 0.0f},
+            {"duck", 0.0f},
+            {"mix", 0.65f},
+            {"output", -3.0f},
+            {"freeze", 0.0f}}},
+
+        // 7. rewind - memory playback, sparkle fragments
+        {"rewind", {
+            {"puckX", 0.30f},
+            {"puckY", 0.5f},
+            {"decay", 6.0f},
+            {"erPreDelay", 20.0f},
+            {"size", 1.25f},
+            {"tone", -0.20f},
+            {"drift", 0.55f},
+            {"ghost", 0.85f},
+            {"glitch", 0.45f},
+            {"duck", 0.0f},
+            {"mix", 0.50f},
+            {"output", -1.0f},
+            {"freeze", 0.0f}}},
+
+        // 8. halation - bright glow with shimmer
+        {"halation", {
+            {"puckX", 0.85f},
+            {"puckY", 0.70f},
+            {"decay", 9.0f},
+            {"erPreDelay", 45.0f},
+            {"size", 1.90f},
+            {"tone", 0.50f},
+            {"drift", 0.45f},
+            {"ghost", 0.60f},
+            {"glitch", 0.30f},
+            {"duck", 0.0f},
+            {"mix", 0.55f},
+            {"output", -2.0f},
+            {"freeze", 0.0f}}},
+
+        // 9. stasis - frozen stillness
+        {"stasis", {
+            {"puckX", 0.0f},
+            {"puckY", 0.30f},
+            {"decay", 20.0f},
+            {"erPreDelay", 0.0f},
+            {"size", 1.50f},
+            {"tone", -0.40f},
+            {"drift", 0.60f},
+            {"ghost", 1.0f},
+            {"glitch", 0.0f},
+            {"duck", 0.0f},
+            {"mix", 0.75f},
+            {"output", -3.0f},
+            {"freeze", 0.0f}}},
+
+        // 10. shiver - extreme with sparkle bursts
+        {"shiver", {
+            {"puckX", 1.0f},
+            {"puckY", 1.0f},
+            {"decay", 25.0f},
+            {"erPreDelay", 15.0f},
+            {"size", 2.0f},
+            {"tone", 0.35f},
+            {"drift", 0.80f},
+            {"ghost", 1.0f},
+            {"glitch", 0.60f},
+            {"duck", 0.0f},
+            {"mix", 0.75f},
+            {"output", -3.0f},
+            {"freeze", 0.0f}}}
+    };
+    return presets;
+}
+
+} // namespace threadbare::unravel
@@ -1,11 +1,14 @@
 // =============================================================================
 // AUTO-GENERATED FILE - DO NOT EDIT MANUALLY
 // Generated from: params.json
-// Generated at: 2026-02-23T19:03:48.926Z
+// Generated at: 2026-10-16T23:32:03.114Z
 // =============================================================================
 #pragma once
 
 #include <juce_audio_processors/juce_audio_processors.h>
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -111,6 +114,81 @@ struct UnravelGeneratedParams
         static constexpr float kOUTPUT_MAX = 12.0f;
         static constexpr float kOUTPUT_DEFAULT = 0.0f;
     };
+
+    // Parameter indices in definition order
+    enum class Index : int
+    {
+        puckX,
+        puckY,
+        mix,
+        size,
+        decay,
+        tone,
+        drift,
+        ghost,
+        glitch,
+        duck,
+        erPreDelay,
+        freeze,
+        output,
+    };
+
+    static constexpr std::size_t kNumParams = 13;
+
+    static constexpr std::array<const char*, kNumParams> kIdsByIndex {
+        "puckX",
+        "puckY",
+        "mix",
+        "size",
+        "decay",
+        "tone",
+        "drift",
+        "ghost",
+        "glitch",
+        "duck",
+        "erPreDelay",
+        "freeze",
+        "output",
+    };
+
+    // Raw value pointers resolved once against the APVTS; reads on the audio
+    // thread are relaxed atomic loads with no string-keyed lookup.
+    class ParamCache
+    {
+    public:
+        explicit ParamCache(juce::AudioProcessorValueTreeState& apvts)
+        {
+            for (std::size_t i = 0; i < kNumParams; ++i)
+            {
+                values[i] = apvts.getRawParameterValue(kIdsByIndex[i]);
+                jassert(values[i] != nullptr);
+            }
+        }
+
+        float get(Index index) const noexcept
+        {
+            return values[static_cast<std::size_t>(index)]->load(std::memory_order_relaxed);
+        }
+
+        std::atomic<float>* raw(Index index) const noexcept { return values[static_cast<std::size_t>(index)]; }
+
+        float puckX() const noexcept { return get(Index::puckX); }
+        float puckY() const noexcept { return get(Index::puckY); }
+        float mix() const noexcept { return get(Index::mix); }
+        float size() const noexcept { return get(Index::size); }
+        float decay() const noexcept { return get(Index::decay); }
+        float tone() const noexcept { return get(Index::tone); }
+        float drift() const noexcept { return get(Index::drift); }
+        float ghost() const noexcept { return get(Index::ghost); }
+        float glitch() const noexcept { return get(Index::glitch); }
+        float duck() const noexcept { return get(Index::duck); }
+        float erPreDelay() const noexcept { return get(Index::erPreDelay); }
+        bool freeze() const noexcept { return get(Index::freeze) > 0.5f; }
+        float output() const noexcept { return get(Index::output); }
+
+    private:
+        std::array<std::atomic<float>*, kNumParams> values {};
+    };
 };
 
 } // namespace threadbare::unravel
@@ -442,6 +442,28 @@ struct Safety {
     static constexpr float kAntiDenormal = 0.0f; // DISABLED - was causing audible grain
 };
 
+// ═══════════════════════════════════════════════════════════════════════════
+// CPU GOVERNOR
+// Thins the optional engines (ghost spawns, sparkle voices, interpolation
+// order) when blocks approach their deadline; restores them with headroom
+// ═══════════════════════════════════════════════════════════════════════════
+struct Governor {
+    // === LOAD THRESHOLDS (load pressure: the reverb's own block load,
+    // smoothed, 1.0 after an overrun; see DeadlineMonitor) ===
+    static constexpr float kEngageLoad = 0.70f;       // Degrade above this
+    static constexpr float kReleaseLoad = 0.45f;      // Restore below this (hysteresis)
+
+    // === RESPONSE (time to sweep the full 0-1 range) ===
+    static constexpr float kAttackSeconds = 0.15f;    // Fast: an underrun is worse than thin ghosts
+    static constexpr float kReleaseSeconds = 4.0f;    // Slow: no audible pumping on recovery
+
+    // === DEGRADATION AT FULL LEVEL ===
+    static constexpr float kMinSpawnScale = 0.3f;     // Ghost spawn probability x0.3
+    static constexpr int kMinSparkleVoices = 1;       // Sparkle cap (of GlitchLooper::kMaxVoices)
+    static constexpr float kLinearInterpAbove = 0.6f; // Cubic -> linear reads above this level (crossfaded over a block)
+    static constexpr float kCubicInterpBelow = 0.3f;  // ...and back below this one
+};
+
 // ═══════════════════════════════════════════════════════════════════════════
 // DEBUG SWITCHES: Toggle subsystems to isolate crackling/distortion sources
 // Set to false to disable each subsystem during debugging
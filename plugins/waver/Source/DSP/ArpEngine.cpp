@@ -3,6 +3,21 @@
 namespace threadbare::dsp
 {
 
+namespace
+{
+// A note-on is only written with a slot left over for its note-off, so a
+// full buffer can skip a step but never strand a sounding note.
+bool pushEvent(std::span<ArpEngine::NoteEvent> out, int& count, const ArpEngine::NoteEvent& event) noexcept
+{
+    const int needed = event.isNoteOn ? 2 : 1;
+    if (count + needed > static_cast<int>(out.size()))
+        return false;
+
+    out[static_cast<std::size_t>(count++)] = event;
+    return true;
+}
+} // namespace
+
 void ArpEngine::prepare(double sampleRate, std::uint32_t seed) noexcept
 {
     sr = sampleRate;
@@ -22,8 +37,6 @@ void ArpEngine::reset() noexcept
     patternIndex = 0;
     ascending = true;
     currentNote = -1;
-    pendingHead = 0;
-    pendingCount = 0;
 }
 
 void ArpEngine::setEnabled(bool on) noexcept
@@ -36,8 +49,6 @@ void ArpEngine::setEnabled(bool on) noexcept
         patternIndex = 0;
         ascending = true;
         currentNote = -1;
-        pendingHead = 0;
-        pendingCount = 0;
     }
     enabled = on;
 }
@@ -62,9 +73,21 @@ void ArpEngine::setPattern(Pattern p) noexcept
     pattern = p;
 }
 
-void ArpEngine::setHostTempo(double bpm) noexcept
+void ArpEngine::setHostPosition(double ppqPosition, double bpm, bool isPlaying) noexcept
 {
     hostBpm = bpm;
+    const bool lock = isPlaying && bpm > 0.0;
+    if (lock && !hostLocked)
+        noteOffPpq = ppqPosition; // free-running gate is released at the block start
+    else if (!lock && hostLocked)
+        phase = currentStepTiming().gateEnd; // grid gate is released, free clock picks up
+
+    hostLocked = lock;
+    if (lock)
+    {
+        hostPpq = ppqPosition;
+        samplesPerBeat = sr * 60.0 / bpm;
+    }
 }
 
 void ArpEngine::setPuckParams(float puckX, float puckY) noexcept
@@ -84,6 +107,7 @@ void ArpEngine::setPuckParams(float puckX, float puckY) noexcept
 
     const int zone = std::min(5, static_cast<int>(normX * 6.0f));
     setPattern(kPatterns[zone]);
+    stepsPerBeat = static_cast<double>(kDivisors[zone]);
 
     const double bpm = hostBpm > 0.0 ? hostBpm : 120.0;
     setRate(static_cast<float>(bpm / 60.0 * static_cast<double>(kDivisors[zone])));
@@ -163,128 +187,152 @@ void ArpEngine::allNotesOff() noexcept
     sortedCount = 0;
 }
 
-void ArpEngine::pushEvent(const NoteEvent& e) noexcept
+ArpEngine::StepTiming ArpEngine::currentStepTiming() const noexcept
 {
-    if (pendingCount >= kMaxPendingEvents)
-        return;
-    const int idx = (pendingHead + pendingCount) % kMaxPendingEvents;
-    pendingEvents[static_cast<std::size_t>(idx)] = e;
-    ++pendingCount;
+    const double stepDuration = sr / static_cast<double>(rateHz);
+    const bool isSwung = (currentStep & 1) != 0;
+    const double swing = isSwung ? swingAmount * stepDuration * 0.5 : 0.0;
+    const double duration = stepDuration + (isSwung ? swing : -swing * 0.5);
+    return { duration, duration * gateRatio };
 }
 
-ArpEngine::NoteEvent ArpEngine::popEvent() noexcept
+ArpEngine::GridStep ArpEngine::gridStep(std::int64_t step) const noexcept
 {
-    if (pendingCount <= 0)
-        return {};
-    const auto& e = pendingEvents[static_cast<std::size_t>(pendingHead)];
-    pendingHead = (pendingHead + 1) % kMaxPendingEvents;
-    --pendingCount;
-    return e;
+    // Swing delays odd steps; each pair still spans exactly two grid steps,
+    // so the pattern never drifts off the bar.
+    const double stepBeats = 1.0 / stepsPerBeat;
+    const double shift = swingAmount * 0.5 * stepBeats;
+    const bool isSwung = (step & 1) != 0;
+    const double onset = static_cast<double>(step) * stepBeats + (isSwung ? shift : 0.0);
+    const double length = isSwung ? stepBeats - shift : stepBeats + shift;
+    return { onset, onset + length * gateRatio };
 }
 
-ArpEngine::NoteEvent ArpEngine::advance(int numSamples) noexcept
+int ArpEngine::advance(int numSamples, std::span<NoteEvent> out) noexcept
 {
-    if (pendingCount > 0)
-        return popEvent();
+    if (!enabled || numSamples <= 0)
+        return 0;
 
-    if (!enabled)
-        return {};
+    return hostLocked ? advanceLocked(numSamples, out) : advanceFree(numSamples, out);
+}
+
+int ArpEngine::advanceLocked(int numSamples, std::span<NoteEvent> out) noexcept
+{
+    const double startPpq = hostPpq;
+    const double endPpq = startPpq + static_cast<double>(numSamples) / samplesPerBeat;
+    hostPpq = endPpq;
+
+    int count = 0;
+    const auto emit = [&](int noteNumber, float velocity, bool isNoteOn, double ppq) noexcept {
+        const double position = (std::max(ppq, startPpq) - startPpq) * samplesPerBeat;
+        const int offset = std::clamp(static_cast<int>(position), 0, numSamples - 1);
+        return pushEvent(out, count, { noteNumber, velocity, isNoteOn, offset });
+    };
+    const auto release = [&](double ppq) noexcept {
+        noteIsOn = false;
+        emit(currentNote, 0.0f, false, ppq);
+    };
+
+    // A gate end that is already behind us or more than a step pair ahead
+    // means the transport jumped (seek or loop): cut the note immediately.
+    if (noteIsOn && (noteOffPpq <= startPpq || noteOffPpq > startPpq + 2.0 / stepsPerBeat))
+        release(startPpq);
 
     if (sortedCount == 0)
     {
-        if (noteIsOn && currentNote >= 0)
+        if (noteIsOn)
+            release(startPpq);
+        currentNote = -1;
+        return count;
+    }
+
+    // Steps are enumerated straight from the grid, so the same PPQ range
+    // always yields the same edges regardless of block size or history.
+    auto step = static_cast<std::int64_t>(std::floor(startPpq * stepsPerBeat)) - 1;
+    for (int safety = 0; safety < 256; ++safety, ++step)
+    {
+        const auto grid = gridStep(step);
+        if (noteIsOn && noteOffPpq < std::min(grid.onset, endPpq))
+            release(noteOffPpq);
+        if (grid.onset >= endPpq)
+            break;
+        if (grid.onset < startPpq)
+            continue;
+        if (noteIsOn)
+            release(grid.onset);
+
+        currentStep = static_cast<int>(step & 1);
+        patternIndex = static_cast<int>(std::max<std::int64_t>(0, step) % 0x40000000);
+        const int note = nextPatternNote();
+        if (note >= 0)
         {
-            noteIsOn = false;
-            NoteEvent off;
-            off.noteNumber = currentNote;
-            off.velocity = 0.0f;
-            off.isNoteOn = false;
-            currentNote = -1;
-            return off;
+            const auto& held = heldNotes[static_cast<std::size_t>(note)];
+            currentNote = held.noteNumber;
+            noteOffPpq = grid.gateEnd;
+            noteIsOn = emit(currentNote, held.velocity, true, grid.onset);
         }
-        return {};
     }
 
-    auto calcStepTiming = [&]() {
-        const double stepDuration = sr / static_cast<double>(rateHz);
-        const bool isSwung = (currentStep & 1) != 0;
-        const double swing = isSwung ? swingAmount * stepDuration * 0.5 : 0.0;
-        const double eDur = stepDuration + (isSwung ? swing : -swing * 0.5);
-        return std::pair<double, double>{ eDur, eDur * gateRatio };
-    };
+    return count;
+}
 
-    auto [effectiveStepDuration, gateEnd] = calcStepTiming();
+int ArpEngine::advanceFree(int numSamples, std::span<NoteEvent> out) noexcept
+{
+    int count = 0;
+    const auto emit = [&](int noteNumber, float velocity, bool isNoteOn, double position) noexcept {
+        const int offset = std::clamp(static_cast<int>(position), 0, numSamples - 1);
+        return pushEvent(out, count, { noteNumber, velocity, isNoteOn, offset });
+    };
 
-    // Bug C fix: if a rate change moved gateEnd behind the current phase
-    // since the last advance call, catch the missed note-off now (before
-    // advancing phase further).
-    if (noteIsOn && phase >= gateEnd)
+    if (sortedCount == 0)
     {
-        noteIsOn = false;
-        NoteEvent off;
-        off.noteNumber = currentNote;
-        off.velocity = 0.0f;
-        off.isNoteOn = false;
-        pushEvent(off);
+        if (noteIsOn && currentNote >= 0)
+        {
+            noteIsOn = false;
+            emit(currentNote, 0.0f, false, 0.0);
+            currentNote = -1;
+        }
+        return count;
     }
 
-    const double prevPhase = phase;
-    phase += static_cast<double>(std::max(0, numSamples));
-
-    // Normal gate-end crossing detection within this block.
-    if (noteIsOn && phase >= gateEnd && prevPhase < gateEnd)
+    // Walk gate edges analytically: each iteration jumps to the next gate end
+    // (while a note sounds) or step boundary. Timing is re-read every edge so
+    // rate and swing changes take effect on the next step; if a rate change
+    // already put an edge behind the phase, it fires at the current position.
+    const double blockLength = static_cast<double>(numSamples);
+    double position = 0.0;
+    for (int safety = 0; safety < 64; ++safety)
     {
-        noteIsOn = false;
-        NoteEvent off;
-        off.noteNumber = currentNote;
-        off.velocity = 0.0f;
-        off.isNoteOn = false;
-        pushEvent(off);
-    }
+        const auto timing = currentStepTiming();
+        const double edge = noteIsOn ? timing.gateEnd : timing.duration;
+        const double wait = std::max(0.0, edge - phase);
+        if (position + wait >= blockLength)
+            break;
+
+        position += wait;
+        phase = std::max(phase, edge);
 
-    // Advance through step boundaries. Recalculate timing per step (Bug D fix).
-    // Push noteOff + noteOn pairs so no events are lost (Bug B fix).
-    int safety = 0;
-    while (phase >= effectiveStepDuration && safety++ < 8)
-    {
         if (noteIsOn)
         {
             noteIsOn = false;
-            NoteEvent off;
-            off.noteNumber = currentNote;
-            off.velocity = 0.0f;
-            off.isNoteOn = false;
-            pushEvent(off);
+            emit(currentNote, 0.0f, false, position);
+            continue;
         }
 
-        phase -= effectiveStepDuration;
+        phase -= timing.duration;
         ++currentStep;
 
-        std::tie(effectiveStepDuration, gateEnd) = calcStepTiming();
-
         const int note = nextPatternNote();
         if (note >= 0)
         {
-            currentNote = heldNotes[static_cast<std::size_t>(note)].noteNumber;
-
-            // Only start the note if there's audible gate time remaining.
-            // If the phase remainder already exceeds gateEnd, the note's
-            // entire duration fell within this block -- skip it to avoid
-            // zero-duration note-on/off pairs that accumulate release tails.
-            if (phase < gateEnd)
-            {
-                noteIsOn = true;
-
-                NoteEvent on;
-                on.noteNumber = currentNote;
-                on.velocity = heldNotes[static_cast<std::size_t>(note)].velocity;
-                on.isNoteOn = true;
-                pushEvent(on);
-            }
+            const auto& held = heldNotes[static_cast<std::size_t>(note)];
+            currentNote = held.noteNumber;
+            noteIsOn = emit(currentNote, held.velocity, true, position);
         }
     }
 
-    return popEvent();
+    phase += blockLength - position;
+    return count;
 }
 
 int ArpEngine::nextPatternNote() noexcept
@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <algorithm>
 #include <cmath>
+#include <span>
 
 namespace threadbare::dsp
 {
@@ -27,6 +28,7 @@ public:
         int noteNumber = -1;
         float velocity = 0.0f;
         bool isNoteOn = false;
+        int sampleOffset = 0;
     };
 
     void prepare(double sampleRate, std::uint32_t seed) noexcept;
@@ -39,7 +41,10 @@ public:
     void setGate(float ratio) noexcept;
     void setSwing(float amount) noexcept;
     void setPattern(Pattern p) noexcept;
-    void setHostTempo(double bpm) noexcept;
+    // Called once per host block, before advance. While the transport plays
+    // with a known tempo, steps sit on the host PPQ grid (advance then walks
+    // ppqPosition forward itself); otherwise the arp free-runs on its own phase.
+    void setHostPosition(double ppqPosition, double bpm, bool isPlaying) noexcept;
 
     void setPuckParams(float puckX, float puckY) noexcept;
 
@@ -47,9 +52,32 @@ public:
     void noteOff(int noteNumber) noexcept;
     void allNotesOff() noexcept;
 
-    NoteEvent advance(int numSamples) noexcept;
+    // Runs the clock over numSamples and writes the gate edges that fall in
+    // them to out, in time order, with sampleOffset in [0, numSamples).
+    // Returns the number written. A note-on is only written if its note-off
+    // will fit too, so when out runs short later steps are skipped (the clock
+    // still advances to the block end) but every note-off is delivered.
+    // Callers should advance in ranges short enough for out to hold them.
+    int advance(int numSamples, std::span<NoteEvent> out) noexcept;
 
 private:
+    struct StepTiming
+    {
+        double duration = 0.0;
+        double gateEnd = 0.0;
+    };
+
+    // Step k on the PPQ grid, in beats.
+    struct GridStep
+    {
+        double onset = 0.0;
+        double gateEnd = 0.0;
+    };
+
+    StepTiming currentStepTiming() const noexcept;
+    GridStep gridStep(std::int64_t step) const noexcept;
+    int advanceFree(int numSamples, std::span<NoteEvent> out) noexcept;
+    int advanceLocked(int numSamples, std::span<NoteEvent> out) noexcept;
     int nextPatternNote() noexcept;
     std::uint32_t nextRandom() noexcept;
 
@@ -60,6 +88,13 @@ private:
     float swingAmount = 0.0f;
     Pattern pattern = Pattern::up;
     double hostBpm = 0.0;
+    double stepsPerBeat = 2.0;
+
+    // Host-locked clock: PPQ at the next advance call and the pending gate end.
+    bool hostLocked = false;
+    double hostPpq = 0.0;
+    double samplesPerBeat = 0.0;
+    double noteOffPpq = 0.0;
 
     struct HeldNote
     {
@@ -82,14 +117,6 @@ private:
     int currentNote = -1;
 
     std::uint32_t rngState = 1;
-
-    static constexpr int kMaxPendingEvents = 8;
-    std::array<NoteEvent, kMaxPendingEvents> pendingEvents{};
-    int pendingHead = 0;
-    int pendingCount = 0;
-
-    void pushEvent(const NoteEvent& e) noexcept;
-    NoteEvent popEvent() noexcept;
 };
 
 } // namespace threadbare::dsp
@@ -11,16 +11,7 @@ void BbdChorus::prepare(double newSampleRate, std::size_t maxBlockSize)
     delayL.assign(maxDelaySamples + maxBlockSize + 8, 0.0f);
     delayR.assign(maxDelaySamples + maxBlockSize + 8, 0.0f);
 
-    const float w0 = 2.0f * std::numbers::pi_v<float> * 150.0f / static_cast<float>(sampleRate);
-    const float cosW0 = std::cos(w0);
-    const float sinW0 = std::sin(w0);
-    const float alpha = sinW0 / (2.0f * std::sqrt(2.0f));
-    const float a0 = 1.0f + alpha;
-    subLpB0 = ((1.0f - cosW0) * 0.5f) / a0;
-    subLpB1 = (1.0f - cosW0) / a0;
-    subLpB2 = subLpB0;
-    subLpA1 = (-2.0f * cosW0) / a0;
-    subLpA2 = (1.0f - alpha) / a0;
+    subLp.setSection(0, threadbare::core::BiquadCoefficients::lowpass(sampleRate, 150.0, std::numbers::sqrt2));
 
     reset();
 }
@@ -33,9 +24,8 @@ void BbdChorus::reset() noexcept
     phase1 = 0.0f;
     phase2 = 0.5f;
     noiseState = 0.0f;
-    noiseRng = 0x6D2B79F5u;
-    subLpS1 = 0.0f;
-    subLpS2 = 0.0f;
+    noiseRng.reset();
+    subLp.reset();
 }
 
 void BbdChorus::process(float* left, float* right, int numSamples) noexcept
@@ -53,13 +43,10 @@ void BbdChorus::process(float* left, float* right, int numSamples) noexcept
         float inL = left[i];
         float inR = right[i];
         const float mono = 0.5f * (inL + inR);
-        const float subBass = subLpB0 * mono + subLpS1;
-        subLpS1 = subLpB1 * mono - subLpA1 * subBass + subLpS2;
-        subLpS2 = subLpB2 * mono - subLpA2 * subBass;
+        const float subBass = subLp.processSample(mono);
         const float upperBand = mono - subBass;
 
-        noiseRng = noiseRng * 1664525u + 1013904223u;
-        const float white = (static_cast<float>((noiseRng >> 8) & 0x00FFFFFFu) / static_cast<float>(0x00FFFFFFu)) * 2.0f - 1.0f;
+        const float white = noiseRng.nextBipolar();
         noiseState = noiseState * 0.9975f + 0.0025f * white;
         const float lfo1 = std::sin(2.0f * std::numbers::pi_v<float> * phase1);
         const float lfo2 = std::sin(2.0f * std::numbers::pi_v<float> * phase2);
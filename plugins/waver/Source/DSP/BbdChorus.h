@@ -7,6 +7,9 @@
 #include <cstddef>
 #include <vector>
 
+#include "BiquadCascade.h"
+#include "NoiseSource.h"
+
 namespace threadbare::dsp
 {
 class BbdChorus
@@ -37,10 +40,8 @@ private:
     float phase1 = 0.0f;
     float phase2 = 0.5f;
     float noiseState = 0.0f;
-    std::uint32_t noiseRng = 0x6D2B79F5u;
-    float subLpB0 = 0.0f, subLpB1 = 0.0f, subLpB2 = 0.0f;
-    float subLpA1 = 0.0f, subLpA2 = 0.0f;
-    float subLpS1 = 0.0f, subLpS2 = 0.0f;
+    threadbare::core::NoiseGenerator noiseRng { 0x6D2B79F5u };
+    threadbare::core::BiquadCascade<1, 1> subLp;
     float stereoWidth = 0.8f;
 };
 } // namespace threadbare::dsp
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+
+namespace threadbare::dsp
+{
+
+// Two-lane stereo frame. Processors that keep L/R state in matching arrays
+// and loop over lanes let the compiler pair both channels in one register.
+using StereoFrame = std::array<float, 2>;
+
+// Pade [7/6] tanh approximation, branch-free so it vectorises. Input is
+// clamped to the approximation's +-5 range (error < 1e-4 there).
+inline float fastTanh(float x) noexcept
+{
+    const float xc = std::clamp(x, -5.0f, 5.0f);
+    const float x2 = xc * xc;
+    const float numerator = xc * (135135.0f + x2 * (17325.0f + x2 * (378.0f + x2)));
+    const float denominator = 135135.0f + x2 * (62370.0f + x2 * (3150.0f + 28.0f * x2));
+    return std::clamp(numerator / denominator, -1.0f, 1.0f);
+}
+
+} // namespace threadbare::dsp
@@ -7,10 +7,21 @@ void MoogLadder::prepare(const juce::dsp::ProcessSpec& spec) noexcept
     ladder.prepare(spec);
     ladder.setMode(juce::dsp::LadderFilterMode::LPF24);
     ladder.setDrive(1.1f);
-    ladder.setCutoffFrequencyHz(8000.0f);
+    preparedRate = spec.sampleRate;
+    cutoffScale = 1.0f;
+    setCutoffHz(8000.0f);
     ladder.setResonance(0.15f);
 }
 
+void MoogLadder::setSampleRate(double newSampleRate) noexcept
+{
+    // LadderFilter only takes a new rate through prepare(), which clears its
+    // stages. Its coefficients depend on cutoff / rate alone, so scaling the
+    // cutoff by prepared / current rate re-rates it with the state intact.
+    cutoffScale = static_cast<float>(preparedRate / std::max(1.0, newSampleRate));
+    setCutoffHz(cutoffHz);
+}
+
 void MoogLadder::reset() noexcept
 {
     ladder.reset();
@@ -18,7 +29,8 @@ void MoogLadder::reset() noexcept
 
 void MoogLadder::setCutoffHz(float hz) noexcept
 {
-    ladder.setCutoffFrequencyHz(hz);
+    cutoffHz = hz;
+    ladder.setCutoffFrequencyHz(hz * cutoffScale);
 }
 
 void MoogLadder::setResonance(float q) noexcept
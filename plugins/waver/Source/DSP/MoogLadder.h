@@ -9,6 +9,8 @@ class MoogLadder
 {
 public:
     void prepare(const juce::dsp::ProcessSpec& spec) noexcept;
+    // Changes rate without clearing the ladder stages.
+    void setSampleRate(double newSampleRate) noexcept;
     void reset() noexcept;
     void setCutoffHz(float hz) noexcept;
     void setResonance(float q) noexcept;
@@ -16,6 +18,9 @@ public:
 
 private:
     juce::dsp::LadderFilter<float> ladder;
+    double preparedRate = 44100.0;
+    float cutoffScale = 1.0f;
+    float cutoffHz = 8000.0f;
     std::array<float, 1> sampleScratch { 0.0f };
 };
 } // namespace threadbare::dsp
@@ -23,9 +23,7 @@ void NoiseFloor::prepare(double sampleRate) noexcept
 
 void NoiseFloor::reset() noexcept
 {
-    pinkB0 = 0.0f;
-    pinkB1 = 0.0f;
-    pinkB2 = 0.0f;
+    pink.reset();
     humPhase = 0.0f;
     whirPhase = 0.0f;
     whirAmpPhase = 0.0f;
@@ -54,7 +52,7 @@ float NoiseFloor::processSample() noexcept
     constexpr float twoPi = 2.0f * std::numbers::pi_v<float>;
 
     // Tape hiss (pink noise).
-    const float hiss = pinkFilter(nextWhite()) * hissGain.getNextValue();
+    const float hiss = pink.process(rng.nextBipolar()) * hissGain.getNextValue();
 
     // AC hum: fundamental + 2nd + 3rd harmonics at ~-72dBFS.
     constexpr float humGain = 0.00025f;
@@ -79,19 +77,4 @@ float NoiseFloor::processSample() noexcept
     return hiss + hum + whir;
 }
 
-float NoiseFloor::nextWhite() noexcept
-{
-    rngState = rngState * 1664525u + 1013904223u;
-    return (static_cast<float>((rngState >> 8) & 0xFFFFu) / 65535.0f) * 2.0f - 1.0f;
-}
-
-float NoiseFloor::pinkFilter(float white) noexcept
-{
-    // Paul Kellet's pink noise filter (simplified 3-band).
-    pinkB0 = 0.99765f * pinkB0 + white * 0.0990460f;
-    pinkB1 = 0.96300f * pinkB1 + white * 0.2965164f;
-    pinkB2 = 0.57000f * pinkB2 + white * 1.0526913f;
-    return (pinkB0 + pinkB1 + pinkB2 + white * 0.1848f) * 0.22f;
-}
-
 } // namespace threadbare::dsp
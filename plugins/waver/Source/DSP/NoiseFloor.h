@@ -3,6 +3,8 @@
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <cstdint>
 
+#include "NoiseSource.h"
+
 namespace threadbare::dsp
 {
 
@@ -18,9 +20,6 @@ public:
     float processSample() noexcept;
 
 private:
-    float nextWhite() noexcept;
-    float pinkFilter(float white) noexcept;
-
     double sr = 44100.0;
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Multiplicative> hissGain;
     float humPhase = 0.0f;
@@ -31,10 +30,8 @@ private:
     float whirAmpInc = 0.0f;
     float ageParam = 0.0f;
 
-    std::uint32_t rngState = 0xDEADBEEFu;
-
-    // Voss-McCartney pink noise state (3 octave bands).
-    float pinkB0 = 0.0f, pinkB1 = 0.0f, pinkB2 = 0.0f;
+    threadbare::core::NoiseGenerator rng { 0xDEADBEEFu };
+    threadbare::core::PinkFilter pink;
 };
 
 } // namespace threadbare::dsp
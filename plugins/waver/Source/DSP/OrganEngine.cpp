@@ -3,10 +3,20 @@
 #include <algorithm>
 #include <cmath>
 #include <numbers>
+#include <thread>
 
 namespace threadbare::dsp
 {
 
+OrganEngine::OrganEngine()
+{
+    pendingDraws[0].store(requested.draw16);
+    pendingDraws[1].store(requested.draw8);
+    pendingDraws[2].store(requested.draw4);
+    pendingDraws[3].store(requested.drawMix);
+    slotState.store(withSlotField(withSlotField(0u, kPublishedShift, kNoSlot), kFadeShift, kNoSlot));
+}
+
 void OrganEngine::prepare(double sr) noexcept
 {
     sampleRate = std::max(1.0, sr);
@@ -16,18 +26,34 @@ void OrganEngine::prepare(double sr) noexcept
     {
         const float freq = 440.0f * std::pow(2.0f, (static_cast<float>(i) - 69.0f) / 12.0f);
         auto& n = notes[static_cast<std::size_t>(i)];
-        n.phaseInc = freq / srF;
-        n.phase = 0.0f;
-        n.active = false;
-        n.wasActivated = false;
-        n.clickRemaining = 0.0f;
-        n.clickGain = 0.0f;
-        n.leakEnvelope = 0.0f;
+
+        // The table runs at the 16' rate; each note picks the richest mip
+        // level whose top harmonic stays below Nyquist.
+        n.phaseInc = 0.5f * freq / srF;
+        n.clockInc = 0.5 * static_cast<double>(freq) / sampleRate;
+        n.mipLevel = 0;
+        for (int level = 1; level < kMipLevels; ++level)
+            if (static_cast<float>(kMipHarmonics[static_cast<std::size_t>(level)]) * n.phaseInc < 0.5f)
+                n.mipLevel = level;
     }
 
     // ~3 second decay for leakage after note-off.
     leakDecayCoeff = std::exp(-1.0f / (srF * 3.0f));
 
+    // ~10 ms crossfade when a rebuilt drawbar table is swapped in.
+    fadeLength = std::max(1, static_cast<int>(sampleRate * 0.01));
+
+    // Build the starting table here; later drawbar moves go to the worker.
+    lockTableBuild();
+    builtSerial = requestSerial.load(std::memory_order_acquire);
+    buildTable(tables[0], loadPendingDraws());
+    slotState.store(withSlotField(withSlotField(0u, kPublishedShift, kNoSlot), kFadeShift, kNoSlot));
+    liveSlot = 0;
+    fadeSlot = -1;
+    fadeRemaining = 0;
+    tableBuildBusy.clear(std::memory_order_release);
+
+    reset();
     recalcFormant();
 }
 
@@ -37,11 +63,18 @@ void OrganEngine::reset() noexcept
     {
         n.phase = 0.0f;
         n.active = false;
-        n.wasActivated = false;
-        n.clickRemaining = 0.0f;
-        n.clickGain = 0.0f;
+        n.listed = false;
         n.leakEnvelope = 0.0f;
     }
+    noteListSize = 0;
+    sampleClock = 0;
+
+    if (fadeRemaining > 0)
+    {
+        fadeRemaining = 0;
+        releaseFadeSlot();
+    }
+
     bpZ1 = 0.0f;
     bpZ2 = 0.0f;
 }
@@ -52,12 +85,18 @@ void OrganEngine::noteOn(int noteNumber) noexcept
         return;
 
     auto& n = notes[static_cast<std::size_t>(noteNumber)];
-    const bool wasActive = n.active;
     n.active = true;
-    n.wasActivated = true;
     n.leakEnvelope = 1.0f;
 
-    (void)wasActive;
+    if (!n.listed)
+    {
+        // Divide-down: every key's phase free-runs from the shared clock, so a
+        // re-struck key picks up where its accumulator would have been.
+        const double cycles = static_cast<double>(sampleClock) * n.clockInc;
+        n.phase = static_cast<float>(cycles - std::floor(cycles));
+        n.listed = true;
+        noteList[static_cast<std::size_t>(noteListSize++)] = static_cast<std::uint8_t>(noteNumber);
+    }
 }
 
 void OrganEngine::noteOff(int noteNumber) noexcept
@@ -76,10 +115,25 @@ void OrganEngine::allNotesOff() noexcept
 
 void OrganEngine::setDrawbars(float sub16, float fund8, float harm4, float mixture) noexcept
 {
-    draw16 = std::clamp(sub16, 0.0f, 8.0f) / 8.0f;
-    draw8 = std::clamp(fund8, 0.0f, 8.0f) / 8.0f;
-    draw4 = std::clamp(harm4, 0.0f, 8.0f) / 8.0f;
-    drawMix = std::clamp(mixture, 0.0f, 8.0f) / 8.0f;
+    DrawbarSet next;
+    next.draw16 = std::clamp(sub16, 0.0f, 8.0f) / 8.0f;
+    next.draw8 = std::clamp(fund8, 0.0f, 8.0f) / 8.0f;
+    next.draw4 = std::clamp(harm4, 0.0f, 8.0f) / 8.0f;
+    next.drawMix = std::clamp(mixture, 0.0f, 8.0f) / 8.0f;
+
+    if (next.draw16 == requested.draw16 && next.draw8 == requested.draw8
+        && next.draw4 == requested.draw4 && next.drawMix == requested.drawMix)
+        return;
+
+    requested = next;
+    pendingDraws[0].store(next.draw16, std::memory_order_relaxed);
+    pendingDraws[1].store(next.draw8, std::memory_order_relaxed);
+    pendingDraws[2].store(next.draw4, std::memory_order_relaxed);
+    pendingDraws[3].store(next.drawMix, std::memory_order_relaxed);
+    requestSerial.fetch_add(1, std::memory_order_release);
+
+    if (tableSignal != nullptr)
+        tableSignal->notify();
 }
 
 void OrganEngine::setAge(float age) noexcept
@@ -97,51 +151,177 @@ void OrganEngine::setFormant(float centerHz, float q) noexcept
 
 float OrganEngine::processSample() noexcept
 {
-    constexpr float twoPi = 2.0f * std::numbers::pi_v<float>;
-    float sum = 0.0f;
+    ++sampleClock;
 
-    for (int i = 0; i < kNoteCount; ++i)
+    if (fadeRemaining == 0 && slotField(slotState.load(std::memory_order_relaxed), kPublishedShift) != kNoSlot)
+        takePublishedTable();
+
+    if (noteListSize == 0)
+        return formantProcess(0.0f);
+
+    const auto& live = tables[static_cast<std::size_t>(liveSlot)];
+    const MipTable* fading = nullptr;
+    float fadeGain = 0.0f;
+    if (fadeRemaining > 0)
     {
-        auto& n = notes[static_cast<std::size_t>(i)];
+        fading = &tables[static_cast<std::size_t>(fadeSlot)];
+        fadeGain = static_cast<float>(fadeRemaining) / static_cast<float>(fadeLength);
+        if (--fadeRemaining == 0)
+            releaseFadeSlot();
+    }
 
-        // Phase accumulators always advance (divide-down behavior).
-        n.phase += n.phaseInc;
-        if (n.phase >= 1.0f)
-            n.phase -= 1.0f;
+    float sum = 0.0f;
 
-        // Decay leakage envelope for inactive notes.
+    for (int i = 0; i < noteListSize;)
+    {
+        auto& n = notes[noteList[static_cast<std::size_t>(i)]];
+
+        // Decay leakage envelope for released notes.
         if (!n.active && n.leakEnvelope > 0.0f)
             n.leakEnvelope *= leakDecayCoeff;
 
-        const bool hasLeakage = n.wasActivated && !n.active && n.leakEnvelope > 1e-6f && leakageLevel > 0.0f;
+        const bool hasLeakage = !n.active && n.leakEnvelope > 1e-6f && leakageLevel > 0.0f;
         if (!n.active && !hasLeakage)
+        {
+            removeListedNote(i);
             continue;
+        }
 
-        const float fund = std::sin(twoPi * n.phase);
+        const auto level = static_cast<std::size_t>(n.mipLevel);
+        float tone = readTable(live[level], n.phase);
+        if (fading != nullptr)
+            tone += fadeGain * (readTable((*fading)[level], n.phase) - tone);
 
-        float tone = 0.0f;
-        tone += draw16 * std::sin(twoPi * n.phase * 0.5f);
-        tone += draw8 * fund;
-        tone += draw4 * std::sin(twoPi * n.phase * 2.0f);
-        tone += drawMix * 0.33f * (
-            std::sin(twoPi * n.phase * 3.0f) +
-            std::sin(twoPi * n.phase * 4.0f) +
-            std::sin(twoPi * n.phase * 6.0f));
+        n.phase += n.phaseInc;
+        if (n.phase >= 1.0f)
+            n.phase -= 1.0f;
 
-        float contribution = 0.0f;
-        if (n.active)
-            contribution = tone * 0.15f;
+        sum += n.active ? tone * 0.15f : tone * leakageLevel * n.leakEnvelope;
+        ++i;
+    }
 
-        if (hasLeakage)
-            contribution = tone * leakageLevel * n.leakEnvelope;
+    return formantProcess(sum);
+}
 
-        (void)n.clickRemaining;
-        (void)n.clickGain;
+void OrganEngine::removeListedNote(int listIndex) noexcept
+{
+    auto& n = notes[noteList[static_cast<std::size_t>(listIndex)]];
+    n.listed = false;
+    n.leakEnvelope = 0.0f;
+    noteList[static_cast<std::size_t>(listIndex)] = noteList[static_cast<std::size_t>(--noteListSize)];
+}
 
-        sum += contribution;
+void OrganEngine::buildTable(MipTable& table, const DrawbarSet& draws) noexcept
+{
+    constexpr float twoPi = 2.0f * std::numbers::pi_v<float>;
+    const std::array<float, kMipLevels> gains {
+        draws.draw16, draws.draw8, draws.draw4,
+        draws.drawMix * 0.33f, draws.drawMix * 0.33f, draws.drawMix * 0.33f
+    };
+
+    // Each mip level adds the next footage on top of the previous one.
+    for (int i = 0; i <= kTableSize; ++i)
+    {
+        const float phase = static_cast<float>(i % kTableSize) / static_cast<float>(kTableSize);
+        float value = 0.0f;
+        for (std::size_t level = 0; level < kMipLevels; ++level)
+        {
+            value += gains[level] * std::sin(twoPi * phase * static_cast<float>(kMipHarmonics[level]));
+            table[level][static_cast<std::size_t>(i)] = value;
+        }
     }
+}
 
-    return formantProcess(sum);
+float OrganEngine::readTable(const Table& table, float phase) noexcept
+{
+    const float pos = phase * static_cast<float>(kTableSize);
+    const int index = std::min(static_cast<int>(pos), kTableSize - 1);
+    const float frac = pos - static_cast<float>(index);
+    const float a = table[static_cast<std::size_t>(index)];
+    const float b = table[static_cast<std::size_t>(index + 1)];
+    return a + frac * (b - a);
+}
+
+OrganEngine::DrawbarSet OrganEngine::loadPendingDraws() const noexcept
+{
+    DrawbarSet draws;
+    draws.draw16 = pendingDraws[0].load(std::memory_order_relaxed);
+    draws.draw8 = pendingDraws[1].load(std::memory_order_relaxed);
+    draws.draw4 = pendingDraws[2].load(std::memory_order_relaxed);
+    draws.drawMix = pendingDraws[3].load(std::memory_order_relaxed);
+    return draws;
+}
+
+void OrganEngine::lockTableBuild() noexcept
+{
+    // Only prepare() and the worker contend, and neither is the audio thread.
+    while (tableBuildBusy.test_and_set(std::memory_order_acquire))
+        std::this_thread::yield();
+}
+
+void OrganEngine::buildPendingTable() noexcept
+{
+    lockTableBuild();
+
+    const auto serial = requestSerial.load(std::memory_order_acquire);
+    if (serial == builtSerial)
+    {
+        tableBuildBusy.clear(std::memory_order_release);
+        return;
+    }
+
+    const auto draws = loadPendingDraws();
+
+    // A slot that is neither published, live nor fading is ours. The audio
+    // thread can only take the published slot, so this stays free until the
+    // build is handed over below.
+    const auto state = slotState.load(std::memory_order_acquire);
+    std::uint32_t slot = 0;
+    while (slot == slotField(state, kPublishedShift)
+           || slot == slotField(state, kLiveShift)
+           || slot == slotField(state, kFadeShift))
+        ++slot;
+
+    buildTable(tables[slot], draws);
+    builtSerial = serial;
+
+    auto expected = slotState.load(std::memory_order_relaxed);
+    while (!slotState.compare_exchange_weak(expected, withSlotField(expected, kPublishedShift, slot),
+                                            std::memory_order_acq_rel))
+    {
+    }
+
+    tableBuildBusy.clear(std::memory_order_release);
+}
+
+void OrganEngine::takePublishedTable() noexcept
+{
+    auto expected = slotState.load(std::memory_order_acquire);
+    std::uint32_t next = 0;
+    do
+    {
+        const auto published = slotField(expected, kPublishedShift);
+        if (published == kNoSlot)
+            return;
+
+        next = withSlotField(expected, kFadeShift, slotField(expected, kLiveShift));
+        next = withSlotField(next, kLiveShift, published);
+        next = withSlotField(next, kPublishedShift, kNoSlot);
+    } while (!slotState.compare_exchange_weak(expected, next, std::memory_order_acq_rel));
+
+    fadeSlot = static_cast<int>(slotField(next, kFadeShift));
+    liveSlot = static_cast<int>(slotField(next, kLiveShift));
+    fadeRemaining = fadeLength;
+}
+
+void OrganEngine::releaseFadeSlot() noexcept
+{
+    auto expected = slotState.load(std::memory_order_relaxed);
+    while (!slotState.compare_exchange_weak(expected, withSlotField(expected, kFadeShift, kNoSlot),
+                                            std::memory_order_acq_rel))
+    {
+    }
+    fadeSlot = -1;
 }
 
 float OrganEngine::formantProcess(float input) noexcept
@@ -1,16 +1,25 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstdint>
 
+#include "WorkSignal.h"
+
 namespace threadbare::dsp
 {
 
-// Baldwin-style divide-down organ with pre-allocated phase accumulators.
+// Baldwin-style divide-down organ.
 // Global (not per-voice): note-on activates an index, note-off deactivates it.
+// Only sounding or leaking notes are processed; each reads a single drawbar
+// wavetable that is rebuilt off the audio thread when the drawbars move.
 class OrganEngine
 {
 public:
+    OrganEngine();
+
+    // Message thread. Not concurrent with process calls, but may overlap a
+    // buildPendingTable() on the worker.
     void prepare(double sampleRate) noexcept;
     void reset() noexcept;
 
@@ -24,29 +33,94 @@ public:
 
     float processSample() noexcept;
 
+    // Drawbar moves notify this signal; its worker then calls
+    // buildPendingTable(). Without one, nothing is rebuilt until the caller
+    // runs buildPendingTable() itself.
+    void setTableSignal(threadbare::core::WorkSignal* signal) noexcept { tableSignal = signal; }
+
+    // Worker thread. Builds the latest requested drawbar table, if any, and
+    // publishes it for the audio thread to fade in.
+    void buildPendingTable() noexcept;
+
 private:
     static constexpr int kNoteCount = 128;
 
+    // One table period spans the 16' sub, so every footage is an integer
+    // harmonic: 16' = 1, 8' = 2, 4' = 4, mixture = 6 / 8 / 12.
+    static constexpr int kTableSize = 1024;
+    static constexpr int kMipLevels = 6;
+    static constexpr std::array<int, kMipLevels> kMipHarmonics { 1, 2, 4, 6, 8, 12 };
+
+    // Live, fading-out, published and in-build tables never alias.
+    static constexpr int kTableSlots = 4;
+
+    using Table = std::array<float, kTableSize + 1>;
+    using MipTable = std::array<Table, kMipLevels>;
+
     struct NoteState
     {
         float phase = 0.0f;
         float phaseInc = 0.0f;
-        float clickRemaining = 0.0f;
-        float clickGain = 0.0f;
+        double clockInc = 0.0;
         float leakEnvelope = 0.0f;
+        int mipLevel = 0;
         bool active = false;
-        bool wasActivated = false;
+        bool listed = false;
+    };
+
+    struct DrawbarSet
+    {
+        float draw16 = 5.0f / 8.0f;
+        float draw8 = 4.0f / 8.0f;
+        float draw4 = 2.0f / 8.0f;
+        float drawMix = 3.0f / 8.0f;
     };
 
+    static void buildTable(MipTable& table, const DrawbarSet& draws) noexcept;
+    static float readTable(const Table& table, float phase) noexcept;
+
+    DrawbarSet loadPendingDraws() const noexcept;
+    void lockTableBuild() noexcept;
+    void takePublishedTable() noexcept;
+    void releaseFadeSlot() noexcept;
+    void removeListedNote(int listIndex) noexcept;
     float formantProcess(float input) noexcept;
+    void recalcFormant() noexcept;
 
     std::array<NoteState, kNoteCount> notes{};
+    std::array<std::uint8_t, kNoteCount> noteList{};
+    int noteListSize = 0;
+    std::uint64_t sampleClock = 0;
     double sampleRate = 44100.0;
 
-    float draw16 = 5.0f / 8.0f;
-    float draw8 = 4.0f / 8.0f;
-    float draw4 = 2.0f / 8.0f;
-    float drawMix = 3.0f / 8.0f;
+    // Drawbar tables. Published / live / fading slot indices are packed into
+    // one atomic so a slot moves between owners in a single step.
+    static constexpr std::uint32_t kNoSlot = 7;
+    static constexpr int kPublishedShift = 0;
+    static constexpr int kLiveShift = 3;
+    static constexpr int kFadeShift = 6;
+
+    static std::uint32_t slotField(std::uint32_t state, int shift) noexcept { return (state >> shift) & 7u; }
+    static std::uint32_t withSlotField(std::uint32_t state, int shift, std::uint32_t slot) noexcept
+    {
+        return (state & ~(7u << shift)) | (slot << shift);
+    }
+
+    std::array<MipTable, kTableSlots> tables{};
+    std::atomic<std::uint32_t> slotState { 0 };
+    int liveSlot = 0;
+    int fadeSlot = -1;
+    int fadeRemaining = 0;
+    int fadeLength = 1;
+
+    DrawbarSet requested;
+    std::array<std::atomic<float>, 4> pendingDraws{};
+    std::atomic<std::uint32_t> requestSerial { 0 };
+    std::uint32_t builtSerial = 0;
+
+    // Serialises prepare() and the worker over builtSerial and the spare slots.
+    std::atomic_flag tableBuildBusy = ATOMIC_FLAG_INIT;
+    threadbare::core::WorkSignal* tableSignal = nullptr;
 
     float ageParam = 0.0f;
     float leakageLevel = 0.0f;
@@ -58,8 +132,6 @@ private:
     float bpZ1 = 0.0f, bpZ2 = 0.0f;
     float formantCenter = 1000.0f;
     float formantQ = 0.9f;
-
-    void recalcFormant() noexcept;
 };
 
 } // namespace threadbare::dsp
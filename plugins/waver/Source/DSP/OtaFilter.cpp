@@ -5,10 +5,15 @@
 namespace threadbare::dsp
 {
 void OtaFilter::prepare(double newSampleRate) noexcept
+{
+    setSampleRate(newSampleRate);
+    reset();
+}
+
+void OtaFilter::setSampleRate(double newSampleRate) noexcept
 {
     sampleRate = std::max(1.0, newSampleRate);
     setCutoffHz(cutoffHz);
-    reset();
 }
 
 void OtaFilter::reset() noexcept
@@ -9,6 +9,8 @@ class OtaFilter
 {
 public:
     void prepare(double newSampleRate) noexcept;
+    // Changes rate without clearing the integrators.
+    void setSampleRate(double newSampleRate) noexcept;
     void reset() noexcept;
 
     void setCutoffHz(float hz) noexcept;
@@ -3,18 +3,27 @@
 #include <algorithm>
 #include <numbers>
 
+#include "../WaverTuning.h"
+
 namespace threadbare::dsp
 {
 
-void OuDrift::prepare(double sampleRate, std::uint32_t seed) noexcept
+void OuDrift::prepare(double stepRateHz, std::uint32_t seed) noexcept
 {
-    rngState = seed;
-    const double srRatio = std::max(1.0, sampleRate) / 44100.0;
-    baseAlpha = static_cast<float>(std::pow(0.9991, srRatio));
-    baseBeta = static_cast<float>(0.042 * std::sqrt(srRatio));
+    rng.setSeed(seed);
+    setStepRate(stepRateHz);
     state = 0.0f;
 }
 
+void OuDrift::setStepRate(double stepRateHz) noexcept
+{
+    // One step spans this many 44.1 kHz baseline samples.
+    const double referenceSteps = 44100.0 / std::max(1.0, stepRateHz);
+    const auto ou = threadbare::tuning::waver::ouCoefficients(referenceSteps);
+    baseAlpha = ou.alpha;
+    baseBeta = ou.beta;
+}
+
 void OuDrift::reset() noexcept
 {
     state = 0.0f;
@@ -37,12 +46,10 @@ float OuDrift::processSample(float amount, float age) noexcept
 
 float OuDrift::nextNoise() noexcept
 {
-    rngState = rngState * 1664525u + 1013904223u;
     // Convert to [-1, 1] with approximately Gaussian-like distribution via
     // central limit of two uniform samples (cheaper than Box-Muller).
-    const float u1 = static_cast<float>((rngState >> 8) & 0xFFFFu) / 65535.0f;
-    rngState = rngState * 1664525u + 1013904223u;
-    const float u2 = static_cast<float>((rngState >> 8) & 0xFFFFu) / 65535.0f;
+    const float u1 = rng.nextUnipolar();
+    const float u2 = rng.nextUnipolar();
     return (u1 + u2 - 1.0f);
 }
 
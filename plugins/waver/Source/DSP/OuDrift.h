@@ -3,21 +3,27 @@
 #include <cmath>
 #include <cstdint>
 
+#include "NoiseSource.h"
+
 namespace threadbare::dsp
 {
 
 struct OuDrift
 {
-    void prepare(double sampleRate, std::uint32_t seed) noexcept;
+    // stepRateHz is how often processSample is called (the sample rate, or a
+    // control rate). Coefficients follow the tuning OU scaling for that step.
+    void prepare(double stepRateHz, std::uint32_t seed) noexcept;
+    // Recomputes the coefficients only; state and noise stream carry on.
+    void setStepRate(double stepRateHz) noexcept;
     void reset() noexcept;
 
-    // Returns drift value in [-1, +1] range, scaled by amount.
+    // Advances one step; returns drift value in [-1, +1] range, scaled by amount.
     // Age (0-1) couples the OU correlation time: higher age = slower, stickier, deeper excursions.
     float processSample(float amount, float age) noexcept;
 
     float getState() const noexcept { return state; }
     void setState(float s) noexcept { state = s; }
-    std::uint32_t getSeed() const noexcept { return rngState; }
+    std::uint32_t getSeed() const noexcept { return rng.getState(); }
 
 private:
     float nextNoise() noexcept;
@@ -25,7 +31,7 @@ private:
     float state = 0.0f;
     float baseAlpha = 0.9991f;
     float baseBeta = 0.042f;
-    std::uint32_t rngState = 0;
+    threadbare::core::NoiseGenerator rng { 0u };
 };
 
 } // namespace threadbare::dsp
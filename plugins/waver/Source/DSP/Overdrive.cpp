@@ -18,9 +18,9 @@ void Overdrive::prepare(double sampleRate) noexcept
 
 void Overdrive::reset() noexcept
 {
-    preZ1 = 0.0f;
-    preZ2 = 0.0f;
-    postZ1 = 0.0f;
+    preZ1 = {};
+    preZ2 = {};
+    postZ1 = {};
     gain.setCurrentAndTargetValue(gain.getTargetValue());
 }
 
@@ -29,28 +29,29 @@ void Overdrive::setGain(float gain01) noexcept
     gain.setTargetValue(1.0f + std::clamp(gain01, 0.0f, 1.0f) * 15.0f);
 }
 
-float Overdrive::processSample(float input) noexcept
+void Overdrive::processSample(StereoFrame& frame) noexcept
 {
     const float drive = gain.getNextValue();
 
-    // Pre-emphasis bandpass.
-    const float bpOut = preB0 * input + preB1 * preZ1 + preB2 * preZ2
-                      - preA1 * preZ1 - preA2 * preZ2;
-    preZ2 = preZ1;
-    preZ1 = bpOut;
+    for (std::size_t ch = 0; ch < frame.size(); ++ch)
+    {
+        const float input = frame[ch];
 
-    const float mid = input + bpOut * 0.6f;
+        // Pre-emphasis bandpass.
+        const float bpOut = preB0 * input + preB1 * preZ1[ch] + preB2 * preZ2[ch]
+                          - preA1 * preZ1[ch] - preA2 * preZ2[ch];
+        preZ2[ch] = preZ1[ch];
+        preZ1[ch] = bpOut;
 
-    // Asymmetric tanh waveshaping.
-    float shaped;
-    if (mid >= 0.0f)
-        shaped = std::tanh(drive * mid);
-    else
-        shaped = std::tanh(drive * mid * 0.7f);
+        const float mid = input + bpOut * 0.6f;
 
-    // Post-emphasis one-pole LPF.
-    postZ1 += postCoeff * (shaped - postZ1);
-    return postZ1;
+        // Asymmetric tanh waveshaping.
+        const float shaped = fastTanh(drive * mid * (mid >= 0.0f ? 1.0f : 0.7f));
+
+        // Post-emphasis one-pole LPF.
+        postZ1[ch] += postCoeff * (shaped - postZ1[ch]);
+        frame[ch] = postZ1[ch];
+    }
 }
 
 void Overdrive::recalcCoeffs() noexcept
@@ -2,17 +2,20 @@
 
 #include <juce_audio_basics/juce_audio_basics.h>
 
+#include "FastMath.h"
+
 namespace threadbare::dsp
 {
 
 // SD-1 style overdrive: pre-emphasis EQ, asymmetric tanh waveshaping, post-emphasis LPF.
+// Stereo: L/R share coefficients and drive, with per-lane filter state.
 class Overdrive
 {
 public:
     void prepare(double sampleRate) noexcept;
     void reset() noexcept;
     void setGain(float gain01) noexcept;
-    float processSample(float input) noexcept;
+    void processSample(StereoFrame& frame) noexcept;
 
 private:
     double sr = 44100.0;
@@ -21,11 +24,11 @@ private:
     // Pre-emphasis bandpass (1kHz, Q ~0.8).
     float preB0 = 0.0f, preB1 = 0.0f, preB2 = 0.0f;
     float preA1 = 0.0f, preA2 = 0.0f;
-    float preZ1 = 0.0f, preZ2 = 0.0f;
+    StereoFrame preZ1{}, preZ2{};
 
     // Post-emphasis LPF (~5kHz, 6dB/oct one-pole).
     float postCoeff = 0.0f;
-    float postZ1 = 0.0f;
+    StereoFrame postZ1{};
 
     void recalcCoeffs() noexcept;
 };
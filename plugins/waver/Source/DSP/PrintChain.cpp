@@ -5,27 +5,26 @@
 namespace threadbare::dsp
 {
 
-void PrintChain::prepare(double sampleRate, std::size_t maxBlockSize) noexcept
+void PrintChain::prepare(double sampleRate, double saturationRate, std::size_t maxBlockSize) noexcept
 {
-    overdriveL.prepare(sampleRate);
-    overdriveR.prepare(sampleRate);
-    tapeL.prepare(sampleRate);
-    tapeR.prepare(sampleRate);
+    setSaturationRate(saturationRate);
     wowFlutter.prepare(sampleRate, maxBlockSize);
     noiseFloor.prepare(sampleRate);
     mix.reset(sampleRate, 0.02);
     mix.setCurrentAndTargetValue(0.75f);
-    wetMixScratch.assign(maxBlockSize, mix.getCurrentValue());
-    wetL.assign(maxBlockSize, 0.0f);
-    wetR.assign(maxBlockSize, 0.0f);
+    bypassed = false;
+}
+
+void PrintChain::setSaturationRate(double saturationRate) noexcept
+{
+    overdrive.prepare(saturationRate);
+    tape.prepare(saturationRate);
 }
 
 void PrintChain::reset() noexcept
 {
-    overdriveL.reset();
-    overdriveR.reset();
-    tapeL.reset();
-    tapeR.reset();
+    overdrive.reset();
+    tape.reset();
     wowFlutter.reset();
     noiseFloor.reset();
     mix.setCurrentAndTargetValue(mix.getTargetValue());
@@ -33,14 +32,12 @@ void PrintChain::reset() noexcept
 
 void PrintChain::setDriveGain(float gain01) noexcept
 {
-    overdriveL.setGain(gain01);
-    overdriveR.setGain(gain01);
+    overdrive.setGain(gain01);
 }
 
 void PrintChain::setTapeSat(float sat01) noexcept
 {
-    tapeL.setDrive(sat01);
-    tapeR.setDrive(sat01);
+    tape.setDrive(sat01);
 }
 
 void PrintChain::setWowDepth(float depth01) noexcept
@@ -79,59 +76,78 @@ void PrintChain::setTransitionDelay(float delayMs) noexcept
     wowFlutter.setTransitionDelay(delayMs);
 }
 
+bool PrintChain::beginBlock() noexcept
+{
+    // Fully dry: skip the stage and leave its state untouched.
+    if (!mix.isSmoothing() && mix.getTargetValue() <= 0.0f)
+    {
+        bypassed = true;
+        return false;
+    }
+
+    // Coming back from bypass: drop stale delay and filter state so the
+    // mix ramp fades in fresh signal.
+    if (bypassed)
+    {
+        overdrive.reset();
+        tape.reset();
+        wowFlutter.reset();
+        bypassed = false;
+    }
+    return true;
+}
+
 void PrintChain::process(float* left, float* right, int numSamples) noexcept
 {
-    if (numSamples <= 0)
-        return;
-    const std::size_t scratchSize = wetMixScratch.size();
-    const std::size_t wetSize = std::min(wetL.size(), wetR.size());
-    if (wetSize == 0)
+    if (numSamples <= 0 || !beginBlock())
         return;
 
     for (int i = 0; i < numSamples; ++i)
     {
         const float wet = mix.getNextValue();
-        if (static_cast<std::size_t>(i) < scratchSize)
-            wetMixScratch[static_cast<std::size_t>(i)] = wet;
-        const float dryL = left[i];
-        const float dryR = right[i];
-
-        float wL = overdriveL.processSample(dryL);
-        float wR = overdriveR.processSample(dryR);
-
-        wL = tapeL.processSample(wL);
-        wR = tapeR.processSample(wR);
-
-        if (static_cast<std::size_t>(i) < wetSize)
-        {
-            wetL[static_cast<std::size_t>(i)] = wL;
-            wetR[static_cast<std::size_t>(i)] = wR;
-        }
-    }
+        const float dry = 1.0f - wet;
+
+        StereoFrame frame { left[i], right[i] };
+        overdrive.processSample(frame);
+        tape.processSample(frame);
 
-    // Wow/Flutter operates on the wet tape path so it scales with print mix.
-    const int n = static_cast<int>(std::min<std::size_t>(static_cast<std::size_t>(numSamples), wetSize));
-    wowFlutter.process(wetL.data(), wetR.data(), n);
+        // Wow/Flutter operates on the wet tape path so it scales with print mix.
+        wowFlutter.processSample(frame);
 
-    for (int i = 0; i < n; ++i)
+        // Noise floor is additive on the wet path.
+        const float noiseVal = noiseFloor.processSample();
+
+        left[i] = left[i] * dry + (frame[0] + noiseVal) * wet;
+        right[i] = right[i] * dry + (frame[1] + noiseVal) * wet;
+    }
+}
+
+void PrintChain::processSaturation(float* left, float* right, int numSamples) noexcept
+{
+    for (int i = 0; i < numSamples; ++i)
     {
-        const float wet = static_cast<std::size_t>(i) < scratchSize
-            ? wetMixScratch[static_cast<std::size_t>(i)]
-            : mix.getCurrentValue();
-        const float dry = 1.0f - wet;
-        left[i] = left[i] * dry + wetL[static_cast<std::size_t>(i)] * wet;
-        right[i] = right[i] * dry + wetR[static_cast<std::size_t>(i)] * wet;
+        StereoFrame frame { left[i], right[i] };
+        overdrive.processSample(frame);
+        tape.processSample(frame);
+        left[i] = frame[0];
+        right[i] = frame[1];
     }
+}
 
-    // Noise floor is additive.
+void PrintChain::processPrint(float* left, float* right, const float* wetLeft, const float* wetRight,
+                              int numSamples) noexcept
+{
     for (int i = 0; i < numSamples; ++i)
     {
+        const float wet = mix.getNextValue();
+        const float dry = 1.0f - wet;
+
+        StereoFrame frame { wetLeft[i], wetRight[i] };
+        wowFlutter.processSample(frame);
         const float noiseVal = noiseFloor.processSample();
-        const float wet = static_cast<std::size_t>(i) < scratchSize
-            ? wetMixScratch[static_cast<std::size_t>(i)]
-            : mix.getCurrentValue();
-        left[i] += noiseVal * wet;
-        right[i] += noiseVal * wet;
+
+        left[i] = left[i] * dry + (frame[0] + noiseVal) * wet;
+        right[i] = right[i] * dry + (frame[1] + noiseVal) * wet;
     }
 }
 
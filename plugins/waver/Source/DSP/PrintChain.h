@@ -8,16 +8,22 @@
 #include "WowFlutter.h"
 
 #include <cstddef>
-#include <vector>
 
 namespace threadbare::dsp
 {
 
 // Fixed-order print chain: Overdrive -> Tape Saturation -> Wow/Flutter -> Noise Floor.
+// Single fused pass per sample; the wow/flutter delay line is the only buffer,
+// so any block length is processed. Bypassed entirely while the mix rests at 0.
+//
+// When the engine oversamples, the chain is driven in two halves instead:
+// processSaturation (overdrive + tape) at saturationRate, then processPrint
+// (wow/flutter, noise, mix) at the host rate.
 class PrintChain
 {
 public:
-    void prepare(double sampleRate, std::size_t maxBlockSize) noexcept;
+    void prepare(double sampleRate, double saturationRate, std::size_t maxBlockSize) noexcept;
+    void setSaturationRate(double saturationRate) noexcept;
     void reset() noexcept;
 
     void setDriveGain(float gain01) noexcept;
@@ -30,17 +36,23 @@ public:
     void setAge(float age) noexcept;
     void setTransitionDelay(float delayMs) noexcept;
 
+    // Fused host-rate path.
     void process(float* left, float* right, int numSamples) noexcept;
 
+    // Split path. beginBlock returns false while the chain is bypassed; the
+    // stage calls are skipped for that block.
+    bool beginBlock() noexcept;
+    void processSaturation(float* left, float* right, int numSamples) noexcept;
+    void processPrint(float* left, float* right, const float* wetLeft, const float* wetRight,
+                      int numSamples) noexcept;
+
 private:
-    Overdrive overdriveL, overdriveR;
-    TapeSaturation tapeL, tapeR;
+    Overdrive overdrive;
+    TapeSaturation tape;
     WowFlutter wowFlutter;
     NoiseFloor noiseFloor;
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> mix;
-    std::vector<float> wetMixScratch;
-    std::vector<float> wetL;
-    std::vector<float> wetR;
+    bool bypassed = false;
 };
 
 } // namespace threadbare::dsp
@@ -0,0 +1,146 @@
+#include "RbfMorph.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace threadbare::dsp
+{
+
+namespace
+{
+constexpr float kMinSigma = 0.05f;
+constexpr float kMaxSigmaOffset = 0.06f;
+constexpr float kLayerSumCeiling = 1.0f;
+constexpr int kLayerDco = RbfMorph::Surfaces::indexOf("layerDco");
+constexpr int kLayerToy = RbfMorph::Surfaces::indexOf("layerToy");
+constexpr int kLayerOrgan = RbfMorph::Surfaces::indexOf("layerOrgan");
+static_assert(kLayerDco >= 0 && kLayerToy >= 0 && kLayerOrgan >= 0, "surfaces must set every layer level");
+} // namespace
+
+RbfMorph::RbfMorph() noexcept
+{
+    for (std::size_t lm = 0; lm < kNumLandmarks; ++lm)
+    {
+        for (std::size_t p = 0; p < kNumParams; ++p)
+        {
+            const float raw = Surfaces::kLandmarks[lm].values[p];
+            perceptual[lm][p] = std::isnan(raw) ? raw : toPerceptual(Surfaces::kParamScales[p], raw);
+        }
+    }
+}
+
+void RbfMorph::setSurface(int surfaceIndex) noexcept
+{
+    surface = std::clamp(surfaceIndex, 0, static_cast<int>(Surfaces::kSurfaces.size()) - 1);
+}
+
+void RbfMorph::setMomentSeed(std::uint32_t seed) noexcept
+{
+    // Same xorshift as the frontend used (32-bit signed shifts), so a given
+    // seed jitters the surface the same way it always has.
+    std::int32_t s = static_cast<std::int32_t>(seed != 0 ? seed : 1u);
+    for (auto& offset : sigmaOffsets)
+    {
+        s ^= static_cast<std::int32_t>(static_cast<std::uint32_t>(s) << 13);
+        s ^= s >> 17;
+        s ^= static_cast<std::int32_t>(static_cast<std::uint32_t>(s) << 5);
+        const double norm = static_cast<double>(static_cast<std::uint32_t>(s)) / 4294967295.0 * 2.0 - 1.0;
+        offset = static_cast<float>(norm) * kMaxSigmaOffset;
+    }
+}
+
+void RbfMorph::evaluate(float puckX, float puckY, Result& out) const noexcept
+{
+    const auto& active = Surfaces::kSurfaces[static_cast<std::size_t>(surface)];
+    const std::size_t first = active.firstLandmark;
+    const std::size_t count = std::min(active.numLandmarks, Surfaces::kMaxLandmarksPerSurface);
+
+    std::array<float, Surfaces::kMaxLandmarksPerSurface> weights {};
+    float totalWeight = 0.0f;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto& landmark = Surfaces::kLandmarks[first + i];
+        const float sigma = std::max(active.sigma + sigmaOffsets[i], kMinSigma);
+        const float dx = puckX - landmark.x;
+        const float dy = puckY - landmark.y;
+        weights[i] = std::exp(-(dx * dx + dy * dy) / (2.0f * sigma * sigma));
+        totalWeight += weights[i];
+    }
+
+    // Puck far outside every landmark: fall back to the first one.
+    if (totalWeight < 1.0e-12f)
+    {
+        weights.fill(0.0f);
+        weights[0] = 1.0f;
+    }
+
+    for (std::size_t p = 0; p < kNumParams; ++p)
+    {
+        const auto scale = Surfaces::kParamScales[p];
+        float sum = 0.0f;
+        float weightSum = 0.0f;
+        float bestWeight = -1.0f;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const float value = perceptual[first + i][p];
+            if (std::isnan(value))
+                continue;
+
+            if (scale == Surfaces::Scale::choice)
+            {
+                if (weights[i] > bestWeight)
+                {
+                    bestWeight = weights[i];
+                    sum = value;
+                    weightSum = 1.0f;
+                }
+                continue;
+            }
+
+            sum += weights[i] * value;
+            weightSum += weights[i];
+        }
+
+        out.present[p] = weightSum > 1.0e-12f;
+        if (out.present[p])
+            out.values[p] = fromPerceptual(scale, sum / weightSum);
+    }
+
+    if (out.present[kLayerDco] && out.present[kLayerToy] && out.present[kLayerOrgan])
+    {
+        const float layerSum = out.values[kLayerDco] + out.values[kLayerToy] + out.values[kLayerOrgan];
+        if (layerSum > kLayerSumCeiling)
+        {
+            const float scale = kLayerSumCeiling / layerSum;
+            out.values[kLayerDco] *= scale;
+            out.values[kLayerToy] *= scale;
+            out.values[kLayerOrgan] *= scale;
+        }
+    }
+}
+
+float RbfMorph::toPerceptual(Surfaces::Scale scale, float raw) noexcept
+{
+    switch (scale)
+    {
+        case Surfaces::Scale::log:   return std::log(std::max(raw, 1.0e-6f));
+        case Surfaces::Scale::logMs: return std::log(std::max(raw, 0.001f));
+        case Surfaces::Scale::linear:
+        case Surfaces::Scale::choice:
+        default:                     return raw;
+    }
+}
+
+float RbfMorph::fromPerceptual(Surfaces::Scale scale, float value) noexcept
+{
+    switch (scale)
+    {
+        case Surfaces::Scale::log:
+        case Surfaces::Scale::logMs: return std::exp(value);
+        case Surfaces::Scale::linear:
+        case Surfaces::Scale::choice:
+        default:                     return value;
+    }
+}
+
+} // namespace threadbare::dsp
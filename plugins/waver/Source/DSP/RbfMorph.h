@@ -0,0 +1,48 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../WaverMorphSurfaces.h"
+
+namespace threadbare::dsp
+{
+
+// Gaussian RBF morph across a preset surface's landmarks, evaluated in
+// perceptual space (log Hz, log seconds). Landmark tables are compiled in from
+// preset-surfaces.js; evaluate is allocation-free and audio-thread safe.
+class RbfMorph
+{
+public:
+    using Surfaces = threadbare::waver::WaverMorphSurfaces;
+    static constexpr std::size_t kNumParams = Surfaces::kNumParams;
+
+    struct Result
+    {
+        std::array<float, kNumParams> values {};
+        // False where no landmark on the active surface sets the parameter.
+        std::array<bool, kNumParams> present {};
+    };
+
+    RbfMorph() noexcept;
+
+    void setSurface(int surfaceIndex) noexcept;
+    int getSurface() const noexcept { return surface; }
+    // Moment Mode: per-landmark sigma jitter derived from seed.
+    void setMomentSeed(std::uint32_t seed) noexcept;
+
+    void evaluate(float puckX, float puckY, Result& out) const noexcept;
+
+    static float toPerceptual(Surfaces::Scale scale, float raw) noexcept;
+    static float fromPerceptual(Surfaces::Scale scale, float value) noexcept;
+
+private:
+    static constexpr std::size_t kNumLandmarks = Surfaces::kLandmarks.size();
+
+    std::array<std::array<float, kNumParams>, kNumLandmarks> perceptual {};
+    std::array<float, Surfaces::kMaxLandmarksPerSurface> sigmaOffsets {};
+    int surface = 0;
+};
+
+} // namespace threadbare::dsp
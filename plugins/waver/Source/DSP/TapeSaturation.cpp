@@ -17,9 +17,9 @@ void TapeSaturation::prepare(double sampleRate) noexcept
 
 void TapeSaturation::reset() noexcept
 {
-    headZ1 = 0.0f;
-    postZ1 = 0.0f;
-    hystState = 0.0f;
+    headZ1 = {};
+    postZ1 = {};
+    hystState = {};
 }
 
 void TapeSaturation::setDrive(float drive01) noexcept
@@ -28,27 +28,28 @@ void TapeSaturation::setDrive(float drive01) noexcept
     hystFeedback = 0.2f + drive * 0.5f;
 }
 
-float TapeSaturation::processSample(float input) noexcept
+void TapeSaturation::processSample(StereoFrame& frame) noexcept
 {
-    // Tape head bandwidth pre-filter.
-    headZ1 += headCoeff * (input - headZ1);
-
-    // Hysteresis: one-sample feedback for magnetization stickiness.
     const float driveScale = 1.0f + drive * 4.0f;
-    const float x = headZ1 * driveScale + hystState * hystFeedback;
+    const float invDriveScale = 1.0f / driveScale;
+
+    for (std::size_t ch = 0; ch < frame.size(); ++ch)
+    {
+        // Tape head bandwidth pre-filter.
+        headZ1[ch] += headCoeff * (frame[ch] - headZ1[ch]);
+
+        // Hysteresis: one-sample feedback for magnetization stickiness.
+        const float x = headZ1[ch] * driveScale + hystState[ch] * hystFeedback;
 
-    // Asymmetric soft clip modeling oxide saturation.
-    float sat;
-    if (x >= 0.0f)
-        sat = std::tanh(x);
-    else
-        sat = std::tanh(x * 0.85f);
+        // Asymmetric soft clip modeling oxide saturation.
+        const float sat = fastTanh(x * (x >= 0.0f ? 1.0f : 0.85f));
 
-    hystState = sat * 0.3f;
+        hystState[ch] = sat * 0.3f;
 
-    const float out = sat / driveScale;
-    postZ1 += postCoeff * (out - postZ1);
-    return postZ1;
+        const float out = sat * invDriveScale;
+        postZ1[ch] += postCoeff * (out - postZ1[ch]);
+        frame[ch] = postZ1[ch];
+    }
 }
 
 } // namespace threadbare::dsp
@@ -1,16 +1,19 @@
 #pragma once
 
+#include "FastMath.h"
+
 namespace threadbare::dsp
 {
 
 // Cassette tape saturation with simplified hysteresis approximation.
+// Stereo: L/R share drive, with per-lane filter and hysteresis state.
 class TapeSaturation
 {
 public:
     void prepare(double sampleRate) noexcept;
     void reset() noexcept;
     void setDrive(float drive01) noexcept;
-    float processSample(float input) noexcept;
+    void processSample(StereoFrame& frame) noexcept;
 
 private:
     double sr = 44100.0;
@@ -18,12 +21,12 @@ private:
 
     // Tape head bandwidth LPF (~13kHz one-pole).
     float headCoeff = 0.0f;
-    float headZ1 = 0.0f;
+    StereoFrame headZ1{};
     float postCoeff = 0.0f;
-    float postZ1 = 0.0f;
+    StereoFrame postZ1{};
 
     // Hysteresis state (one-sample feedback).
-    float hystState = 0.0f;
+    StereoFrame hystState{};
     float hystFeedback = 0.4f;
 };
 
@@ -1,6 +1,7 @@
 #include "ToyEngine.h"
 
 #include <algorithm>
+#include <cmath>
 #include <numbers>
 
 namespace threadbare::dsp
@@ -12,36 +13,111 @@ static constexpr float kOpllRatios[] = {
 };
 static constexpr int kOpllRatioCount = 13;
 
-void ToyEngine::prepare(double sr) noexcept
+namespace
 {
-    sampleRate = std::max(1.0, sr);
+constexpr int kSineTableSize = 4096;
+constexpr float kInvTwoPi = 1.0f / (2.0f * std::numbers::pi_v<float>);
+
+// One cycle plus a guard point for interpolation, shared by every instance.
+struct SineTable
+{
+    std::array<float, kSineTableSize + 1> values{};
+
+    SineTable() noexcept
+    {
+        for (int i = 0; i <= kSineTableSize; ++i)
+        {
+            const double phase = static_cast<double>(i) / static_cast<double>(kSineTableSize);
+            values[static_cast<std::size_t>(i)] = static_cast<float>(std::sin(2.0 * std::numbers::pi * phase));
+        }
+    }
+};
+
+const SineTable& getSineTable() noexcept
+{
+    static const SineTable table;
+    return table;
+}
+
+// Phase in cycles (any sign) -> sin(2*pi*phase). Branch-free so lane loops vectorise.
+inline float lookupSine(const float* table, float phase) noexcept
+{
+    float wrapped = phase - static_cast<float>(static_cast<int>(phase));
+    wrapped += wrapped < 0.0f ? 1.0f : 0.0f;
+    const float pos = wrapped * static_cast<float>(kSineTableSize);
+    const int whole = static_cast<int>(pos);
+    const float frac = pos - static_cast<float>(whole);
+    const int index = whole & (kSineTableSize - 1);
+    const float a = table[index];
+    const float b = table[index + 1];
+    return a + frac * (b - a);
+}
+
+// std::round equivalent (half away from zero) that compiles to SIMD.
+inline float roundHalfAway(float value) noexcept
+{
+    return static_cast<float>(static_cast<int>(value + (value >= 0.0f ? 0.5f : -0.5f)));
+}
+} // namespace
+
+void ToyEngine::prepare(double) noexcept
+{
+    sineTable = getSineTable().values.data();
     reset();
 }
 
 void ToyEngine::reset() noexcept
 {
-    carrierPhase = 0.0f;
-    modulatorPhase = 0.0f;
-    lastModOutput = 0.0f;
+    for (std::size_t lane = 0; lane < kLanes; ++lane)
+        resetLane(static_cast<int>(lane));
 }
 
-void ToyEngine::setNote(float frequencyHz) noexcept
+void ToyEngine::resetLane(int lane) noexcept
 {
-    carrierFreqHz = std::max(1.0f, frequencyHz);
-    carrierInc = carrierFreqHz / static_cast<float>(sampleRate);
-    modulatorInc = (carrierFreqHz * actualRatio) / static_cast<float>(sampleRate);
+    const auto l = static_cast<std::size_t>(lane);
+    for (auto& op : phases)
+        op[l] = 0.0f;
+    for (auto& op : incrementSteps)
+        op[l] = 0.0f;
+    feedbackStates[l] = 0.0f;
+    envelopes[l] = 0.0f;
+    outputs[l] = 0.0f;
+}
+
+void ToyEngine::setLaneIncrement(int lane, float carrierIncrement) noexcept
+{
+    const auto l = static_cast<std::size_t>(lane);
+    if (carrierIncrement == carrierIncrements[l] && incrementSteps[kOperators - 1][l] == 0.0f)
+        return;
+
+    carrierIncrements[l] = carrierIncrement;
+    recalcOperatorIncrements(l);
+}
+
+void ToyEngine::rampLaneIncrement(int lane, float targetIncrement, float intervalInverse) noexcept
+{
+    const auto l = static_cast<std::size_t>(lane);
+    carrierIncrements[l] = targetIncrement;
+    for (std::size_t op = 0; op < kOperators; ++op)
+        incrementSteps[op][l] = (targetIncrement * operatorRatios[op] - increments[op][l]) * intervalInverse;
 }
 
 void ToyEngine::setModIndex(float index) noexcept
 {
     modulationIndex = std::clamp(index, 0.0f, 8.0f);
+    operatorDepths[0] = modulationIndex;
 }
 
 void ToyEngine::setRatioNorm(float norm) noexcept
 {
     ratioNorm = std::clamp(norm, 0.0f, 1.0f);
-    actualRatio = quantizeToOpllRatio(ratioNorm);
-    modulatorInc = (carrierFreqHz * actualRatio) / static_cast<float>(sampleRate);
+    const float ratio = quantizeToOpllRatio(ratioNorm);
+    if (ratio == operatorRatios[0])
+        return;
+
+    operatorRatios[0] = ratio;
+    for (std::size_t lane = 0; lane < kLanes; ++lane)
+        recalcOperatorIncrements(lane);
 }
 
 void ToyEngine::setFeedback(float fb) noexcept
@@ -58,38 +134,67 @@ void ToyEngine::setBitDepth(int bits) noexcept
 void ToyEngine::setEnvelopeStepping(float stepping) noexcept
 {
     envelopeStep = std::clamp(stepping, 0.0f, 1.0f);
+    envelopeSteps = 4.0f + (1.0f - envelopeStep) * 60.0f;
 }
 
-float ToyEngine::processSample(float envelope) noexcept
+void ToyEngine::process() noexcept
 {
-    constexpr float twoPi = 2.0f * std::numbers::pi_v<float>;
+    const float* table = sineTable;
+    if (table == nullptr)
+        return;
+
+    // Phase offsets are carried in cycles so the table lookup needs no 2*pi.
+    alignas(32) LaneArray modulation{};
+    const float feedbackCycles = feedbackAmount * kInvTwoPi;
+    for (std::size_t l = 0; l < kLanes; ++l)
+        modulation[l] = feedbackCycles * feedbackStates[l];
 
-    // Age-coupled envelope stepping: quantize the envelope to coarser levels.
-    float env = envelope;
-    if (envelopeStep > 0.0f)
+    for (std::size_t op = 0; op < kOperators; ++op)
     {
-        const float steps = 4.0f + (1.0f - envelopeStep) * 60.0f;
-        env = std::round(env * steps) / steps;
+        auto& opPhases = phases[op];
+        auto& opIncrements = increments[op];
+        const auto& opSteps = incrementSteps[op];
+        const float depthCycles = operatorDepths[op] * kInvTwoPi;
+        const bool isFeedbackOp = op == 0;
+        const bool isCarrier = op == kOperators - 1;
+
+        for (std::size_t l = 0; l < kLanes; ++l)
+        {
+            const float s = lookupSine(table, opPhases[l] + modulation[l]);
+            if (isFeedbackOp)
+                feedbackStates[l] = s;
+            if (isCarrier)
+                outputs[l] = s;
+            modulation[l] = depthCycles * s;
+
+            const float next = opPhases[l] + opIncrements[l];
+            opPhases[l] = next - (next >= 1.0f ? 1.0f : 0.0f);
+            opIncrements[l] += opSteps[l];
+        }
     }
 
-    const float modPhaseAngle = twoPi * modulatorPhase + feedbackAmount * lastModOutput;
-    const float modOutput = std::sin(modPhaseAngle);
-    lastModOutput = modOutput;
-
-    const float carrierPhaseAngle = twoPi * carrierPhase + modulationIndex * modOutput;
-    float output = std::sin(carrierPhaseAngle);
-    output = dacQuantize(output);
-    output *= env;
-
-    carrierPhase += carrierInc;
-    if (carrierPhase >= 1.0f)
-        carrierPhase -= 1.0f;
+    // Age-coupled envelope stepping quantizes the envelope to coarser levels.
+    const float steps = envelopeSteps;
+    const float invSteps = 1.0f / steps;
+    const bool stepped = envelopeStep > 0.0f;
+    const float levels = quantLevels;
+    const float invLevels = 1.0f / levels;
 
-    modulatorPhase += modulatorInc;
-    if (modulatorPhase >= 1.0f)
-        modulatorPhase -= 1.0f;
+    for (std::size_t l = 0; l < kLanes; ++l)
+    {
+        const float env = stepped ? roundHalfAway(envelopes[l] * steps) * invSteps : envelopes[l];
+        outputs[l] = roundHalfAway(outputs[l] * levels) * invLevels * env;
+    }
+}
 
-    return output;
+void ToyEngine::recalcOperatorIncrements(std::size_t lane) noexcept
+{
+    // Lands on the lane's target; a ramp in flight ends there.
+    for (std::size_t op = 0; op < kOperators; ++op)
+    {
+        increments[op][lane] = carrierIncrements[lane] * operatorRatios[op];
+        incrementSteps[op][lane] = 0.0f;
+    }
 }
 
 float ToyEngine::quantizeToOpllRatio(float normValue) noexcept
@@ -99,9 +204,4 @@ float ToyEngine::quantizeToOpllRatio(float normValue) noexcept
     return kOpllRatios[index];
 }
 
-float ToyEngine::dacQuantize(float sample) const noexcept
-{
-    return std::round(sample * quantLevels) / quantLevels;
-}
-
 } // namespace threadbare::dsp
@@ -1,46 +1,71 @@
 #pragma once
 
-#include <cmath>
+#include <array>
 #include <cstdint>
 
 namespace threadbare::dsp
 {
 
-// Two-operator PM engine inspired by YM2413/OPLL.
-// Per-voice: carrier + modulator with DAC quantization.
+// Two-operator PM engine inspired by YM2413/OPLL with DAC quantization.
+// One instance renders every voice: each voice owns a lane, and operators run
+// lane-parallel over interpolated sine-table lookups. Operators form a serial
+// chain (operator 0 has self-feedback, the last one is the carrier), so a
+// wider OPLL-style stack only needs a larger kOperators.
 class ToyEngine
 {
 public:
+    static constexpr int kLanes = 8;
+    static constexpr int kOperators = 2;
+
     void prepare(double sampleRate) noexcept;
     void reset() noexcept;
+    void resetLane(int lane) noexcept;
+
+    // Per-lane carrier increment in cycles per sample, applied at once;
+    // operator increments are only recomputed when it changes.
+    void setLaneIncrement(int lane, float carrierIncrement) noexcept;
+    // Control rate: ramps the lane's increments linearly to the target over
+    // 1 / intervalInverse samples. process() steps them, so pitch can move
+    // every sample without a per-sample call; retarget before the ramp ends.
+    void rampLaneIncrement(int lane, float targetIncrement, float intervalInverse) noexcept;
+    void setLaneEnvelope(int lane, float envelope) noexcept { envelopes[static_cast<std::size_t>(lane)] = envelope; }
 
-    void setNote(float frequencyHz) noexcept;
     void setModIndex(float index) noexcept;
     void setRatioNorm(float normRatio) noexcept;
     void setFeedback(float fb) noexcept;
     void setBitDepth(int bits) noexcept;
     void setEnvelopeStepping(float stepping) noexcept;
 
-    float processSample(float envelope) noexcept;
+    // Renders one sample for every lane; read results with getLaneOutput.
+    void process() noexcept;
+    float getLaneOutput(int lane) const noexcept { return outputs[static_cast<std::size_t>(lane)]; }
 
 private:
+    using LaneArray = std::array<float, kLanes>;
+
     static float quantizeToOpllRatio(float normValue) noexcept;
-    float dacQuantize(float sample) const noexcept;
-
-    double sampleRate = 44100.0;
-    float carrierPhase = 0.0f;
-    float modulatorPhase = 0.0f;
-    float carrierInc = 0.0f;
-    float modulatorInc = 0.0f;
-    float carrierFreqHz = 440.0f;
+    void recalcOperatorIncrements(std::size_t lane) noexcept;
+
+    alignas(32) std::array<LaneArray, kOperators> phases{};
+    alignas(32) std::array<LaneArray, kOperators> increments{};
+    alignas(32) std::array<LaneArray, kOperators> incrementSteps{};
+    alignas(32) LaneArray carrierIncrements{};
+    alignas(32) LaneArray envelopes{};
+    alignas(32) LaneArray feedbackStates{};
+    alignas(32) LaneArray outputs{};
+
+    // Frequency ratio and output-to-next-operator depth (radians) per operator.
+    std::array<float, kOperators> operatorRatios { 2.0f, 1.0f };
+    std::array<float, kOperators> operatorDepths { 0.25f, 0.0f };
+
+    const float* sineTable = nullptr;
     float modulationIndex = 0.25f;
     float ratioNorm = 0.5f;
-    float actualRatio = 2.0f;
     float feedbackAmount = 0.0f;
-    float lastModOutput = 0.0f;
     int quantBits = 9;
     float quantLevels = 512.0f;
     float envelopeStep = 0.0f;
+    float envelopeSteps = 64.0f;
 };
 
 } // namespace threadbare::dsp
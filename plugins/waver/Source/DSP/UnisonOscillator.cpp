@@ -0,0 +1,114 @@
+#include "UnisonOscillator.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace threadbare::dsp
+{
+
+void UnisonOscillator::prepare(std::uint32_t seed) noexcept
+{
+    // Lane 0 always starts at zero so a single-lane stack matches the classic DCO.
+    // The remaining lanes get fixed, seed-derived offsets to avoid a phasey attack.
+    startPhases[0] = 0.0f;
+    for (std::size_t lane = 1; lane < kMaxLanes; ++lane)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        startPhases[lane] = static_cast<float>((seed >> 8) & 0xFFFFu) / 65536.0f;
+    }
+
+    recalcLanes();
+    reset();
+}
+
+void UnisonOscillator::reset() noexcept
+{
+    phases = startPhases;
+}
+
+void UnisonOscillator::setVoiceCount(int count) noexcept
+{
+    const int clamped = std::clamp(count, 1, kMaxLanes);
+    if (clamped == laneCount)
+        return;
+
+    laneCount = clamped;
+    recalcLanes();
+}
+
+void UnisonOscillator::setDetuneCents(float cents) noexcept
+{
+    const float clamped = std::clamp(cents, 0.0f, 50.0f);
+    if (clamped == detuneCents)
+        return;
+
+    detuneCents = clamped;
+    recalcLanes();
+}
+
+float UnisonOscillator::process(float baseIncrement, float pulseWidth, float waveBlend) noexcept
+{
+    const float dt = baseIncrement;
+    const int lanes = laneCount;
+
+    alignas(32) std::array<float, kMaxLanes> out{};
+
+    // Branch-free polyBLEP/polyBLAMP so the lane loop vectorises.
+    for (int i = 0; i < lanes; ++i)
+    {
+        const auto lane = static_cast<std::size_t>(i);
+        const float p = phases[lane];
+        const float inc = dt * ratios[lane];
+        const float invInc = inc > 0.0f ? 1.0f / inc : 0.0f;
+
+        const float head = p * invInc;
+        const float tail = (p - 1.0f) * invInc;
+        const bool inHead = p < inc;
+        const bool inTail = p > 1.0f - inc;
+
+        const float blep = inHead ? (head + head - head * head - 1.0f)
+                         : (inTail ? (tail * tail + tail + tail + 1.0f) : 0.0f);
+        const float saw = 2.0f * p - 1.0f - blep;
+
+        const float blampRise = inHead ? (head - 0.5f * head * head - 0.5f)
+                              : (inTail ? (0.5f * tail * tail + tail + 0.5f) : 0.0f);
+
+        float fall = p - pulseWidth;
+        fall += fall < 0.0f ? 1.0f : 0.0f;
+        const float fallHead = fall * invInc;
+        const float fallTail = (fall - 1.0f) * invInc;
+        const float blampFall = fall < inc ? (fallHead - 0.5f * fallHead * fallHead - 0.5f)
+                              : (fall > 1.0f - inc ? (0.5f * fallTail * fallTail + fallTail + 0.5f) : 0.0f);
+
+        const float pulse = (p < pulseWidth ? 1.0f : -1.0f) + blampRise - blampFall;
+        out[lane] = saw + waveBlend * (pulse - saw);
+
+        const float next = p + inc;
+        phases[lane] = next - (next >= 1.0f ? 1.0f : 0.0f);
+    }
+
+    float sum = 0.0f;
+    for (int i = 0; i < lanes; ++i)
+        sum += out[static_cast<std::size_t>(i)];
+
+    return sum * laneGain;
+}
+
+void UnisonOscillator::recalcLanes() noexcept
+{
+    // Symmetric spread in cents across the active lanes; equal-power sum.
+    for (int i = 0; i < kMaxLanes; ++i)
+    {
+        float offsetCents = 0.0f;
+        if (laneCount > 1 && i < laneCount)
+        {
+            const float position = static_cast<float>(i) / static_cast<float>(laneCount - 1);
+            offsetCents = detuneCents * (2.0f * position - 1.0f);
+        }
+        ratios[static_cast<std::size_t>(i)] = std::pow(2.0f, offsetCents / 1200.0f);
+    }
+
+    laneGain = 1.0f / std::sqrt(static_cast<float>(laneCount));
+}
+
+} // namespace threadbare::dsp
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace threadbare::dsp
+{
+
+// Detuned saw/pulse stack for one voice. Each copy is a lane in a fixed-width
+// structure-of-arrays so the per-sample loop compiles to SIMD; all lanes share
+// the voice's envelope, filter and sub oscillator downstream.
+class UnisonOscillator
+{
+public:
+    static constexpr int kMaxLanes = 8;
+
+    void prepare(std::uint32_t seed) noexcept;
+    void reset() noexcept;
+
+    void setVoiceCount(int count) noexcept;
+    void setDetuneCents(float cents) noexcept;
+    int getVoiceCount() const noexcept { return laneCount; }
+
+    // Returns the blended (saw -> pulse) stack output for one sample.
+    float process(float baseIncrement, float pulseWidth, float waveBlend) noexcept;
+
+private:
+    void recalcLanes() noexcept;
+
+    alignas(32) std::array<float, kMaxLanes> phases{};
+    alignas(32) std::array<float, kMaxLanes> ratios{};
+    alignas(32) std::array<float, kMaxLanes> startPhases{};
+
+    int laneCount = 1;
+    float detuneCents = 0.0f;
+    float laneGain = 1.0f;
+};
+
+} // namespace threadbare::dsp
@@ -1,78 +1,152 @@
 #include "WaverEngine.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <numbers>
 
+#include "FastMath.h"
+
 namespace threadbare::dsp
 {
-void WaverEngine::prepare(const juce::dsp::ProcessSpec& spec, std::uint32_t driftSeed) noexcept
+void WaverEngine::prepare(const juce::dsp::ProcessSpec& spec, std::uint32_t driftSeed, int newOversamplingStages)
 {
-    voiceAllocator.prepare(spec.sampleRate, driftSeed);
+    hostSpec = spec;
+    profiler.prepare(spec.sampleRate);
+    printWet.setSize(2, static_cast<int>(spec.maximumBlockSize));
+
+    reportedLatency = 0;
+    int maxVoiceLatency = 0;
+    for (std::size_t stages = 1; stages < chains.size(); ++stages)
+    {
+        auto& chain = chains[stages];
+        const auto makeOversampler = [&spec, stages](std::size_t channels) {
+            auto os = std::make_unique<Oversampler>(channels, stages, Oversampler::filterHalfBandPolyphaseIIR, true, false);
+            os->initProcessing(static_cast<std::size_t>(spec.maximumBlockSize));
+            return os;
+        };
+        chain.voice = makeOversampler(1);
+        chain.voiceBus = captureVoiceBus(*chain.voice, spec.maximumBlockSize);
+        chain.print = makeOversampler(4);
+        chain.clip = makeOversampler(2);
+        chain.latencySamples = juce::roundToInt(chain.voice->getLatencyInSamples()
+                                                + chain.print->getLatencyInSamples()
+                                                + chain.clip->getLatencyInSamples());
+        chain.voiceLatencySamples = juce::roundToInt(chain.voice->getLatencyInSamples());
+        reportedLatency = std::max(reportedLatency, chain.latencySamples);
+        maxVoiceLatency = std::max(maxVoiceLatency, chain.voiceLatencySamples);
+    }
+    padBuffer.setSize(2, reportedLatency + 1);
+    organDelay.setSize(1, maxVoiceLatency + 1);
+
+    oversamplingStages = std::clamp(newOversamplingStages, 0, static_cast<int>(chains.size()) - 1);
+    requestedStages = oversamplingStages;
+    const double oversampledRate = spec.sampleRate * static_cast<double>(1 << oversamplingStages);
+    voiceAllocator.prepare(oversampledRate, driftSeed);
+    activateChain(oversamplingStages);
+    chainFade.reset(spec.sampleRate, 0.005);
+    chainFade.setCurrentAndTargetValue(1.0f);
+    chainFadeLength = std::max(1, static_cast<int>(std::floor(spec.sampleRate * 0.005)));
+    chainFadeRemaining = 0;
+
     voiceAllocator.setPortamento(0.0f, false);
     arp.prepare(spec.sampleRate, driftSeed ^ 0xABCD1234u);
     chorus.prepare(spec.sampleRate, static_cast<std::size_t>(spec.maximumBlockSize));
     chorus.setMode(BbdChorus::Mode::modeI);
     organ.prepare(spec.sampleRate);
-    printChain.prepare(spec.sampleRate, static_cast<std::size_t>(spec.maximumBlockSize));
+    printChain.prepare(spec.sampleRate, spec.sampleRate * static_cast<double>(1 << oversamplingStages),
+                       static_cast<std::size_t>(spec.maximumBlockSize));
     organLevel.reset(spec.sampleRate, 0.02);
     organLevel.setCurrentAndTargetValue(0.3f);
 
-    // 4th-order Butterworth HPF at 45 Hz (two cascaded 2nd-order sections).
-    constexpr float hpfCutoff = 45.0f;
-    const float srF = static_cast<float>(spec.sampleRate);
-    const float w0 = 2.0f * std::numbers::pi_v<float> * hpfCutoff / srF;
-    const float cosW0 = std::cos(w0);
-    const float sinW0 = std::sin(w0);
-
-    // 4th-order Butterworth Q values: 1/(2*cos(pi/8)), 1/(2*cos(3*pi/8))
-    constexpr float q1 = 0.54119610f;
-    constexpr float q2 = 1.30656296f;
-
-    auto computeHpfStage = [&](BiquadStage& stage, float q) {
-        const float alpha = sinW0 / (2.0f * q);
-        const float a0 = 1.0f + alpha;
-        stage.b0 = ((1.0f + cosW0) * 0.5f) / a0;
-        stage.b1 = -(1.0f + cosW0) / a0;
-        stage.b2 = stage.b0;
-        stage.a1 = (-2.0f * cosW0) / a0;
-        stage.a2 = (1.0f - alpha) / a0;
-        stage.s1L = stage.s2L = 0.0f;
-        stage.s1R = stage.s2R = 0.0f;
-    };
+    using threadbare::core::BiquadCoefficients;
+    const double sr = spec.sampleRate;
 
-    computeHpfStage(hpfStage1, q1);
-    computeHpfStage(hpfStage2, q2);
+    // 4th-order Butterworth HPF at 45 Hz (two cascaded 2nd-order sections).
+    // Q values: 1/(2*cos(pi/8)), 1/(2*cos(3*pi/8)).
+    constexpr double hpfCutoff = 45.0;
+    subsonicHpf.setSection(0, BiquadCoefficients::highpass(sr, hpfCutoff, 0.54119610));
+    subsonicHpf.setSection(1, BiquadCoefficients::highpass(sr, hpfCutoff, 1.30656296));
+    subsonicHpf.reset();
 
     // Low-end mono collapse: 2nd-order Butterworth LP at 200 Hz (side channel).
-    {
-        constexpr float mcCutoff = 200.0f;
-        const float mcW0 = 2.0f * std::numbers::pi_v<float> * mcCutoff / srF;
-        const float mcCos = std::cos(mcW0);
-        const float mcSin = std::sin(mcW0);
-        const float mcAlpha = mcSin / std::sqrt(2.0f);
-        const float mcA0 = 1.0f + mcAlpha;
-
-        auto initLp = [&](BiquadStage& s) {
-            s.b0 = ((1.0f - mcCos) * 0.5f) / mcA0;
-            s.b1 = (1.0f - mcCos) / mcA0;
-            s.b2 = s.b0;
-            s.a1 = (-2.0f * mcCos) / mcA0;
-            s.a2 = (1.0f - mcAlpha) / mcA0;
-            s.s1L = s.s2L = 0.0f;
-            s.s1R = s.s2R = 0.0f;
-        };
-        initLp(monoCollapseSide);
-    }
+    monoCollapseSide.setSection(0, BiquadCoefficients::lowpass(sr, 200.0, std::numbers::sqrt2 * 0.5));
+    monoCollapseSide.reset();
 
     // Gentle HF rolloff: one-pole LP at 18 kHz.
+    hfRolloff.setSection(0, BiquadCoefficients::onePoleLowpass(sr, std::min(18000.0, sr * 0.49)));
+    hfRolloff.reset();
+}
+
+float* WaverEngine::captureVoiceBus(Oversampler& oversampler, juce::uint32 maximumBlockSize)
+{
+    // processSamplesDown decimates from the last stage's buffer, which
+    // Oversampling only hands out as the result of an up pass. Run one on
+    // silence here, keep the pointer (stable until the next initProcessing)
+    // and clear the filter state it left behind.
+    juce::AudioBuffer<float> silence(1, static_cast<int>(maximumBlockSize));
+    silence.clear();
+    juce::dsp::AudioBlock<float> block(silence);
+    float* bus = oversampler.processSamplesUp(block).getChannelPointer(0);
+    oversampler.reset();
+    return bus;
+}
+
+void WaverEngine::setOversampling(int newOversamplingStages) noexcept
+{
+    requestedStages = std::clamp(newOversamplingStages, 0, static_cast<int>(chains.size()) - 1);
+}
+
+void WaverEngine::startChainFade(float target) noexcept
+{
+    chainFade.setTargetValue(target);
+    chainFadeRemaining = chainFadeLength;
+}
+
+void WaverEngine::updateChainSwap() noexcept
+{
+    const bool fadingOut = chainFade.getTargetValue() <= 0.0f;
+    if (requestedStages != oversamplingStages)
+    {
+        if (!fadingOut)
+            startChainFade(0.0f);
+        else if (chainFadeRemaining == 0)
+        {
+            activateChain(requestedStages);
+            startChainFade(1.0f);
+        }
+    }
+    else if (fadingOut)
     {
-        const float g = std::tan(std::numbers::pi_v<float> * std::min(18000.0f, srF * 0.49f) / srF);
-        hfCoeff = g / (1.0f + g);
-        hfStateL = hfStateR = 0.0f;
+        // The request went back to the live chain before the swap.
+        startChainFade(1.0f);
     }
 }
 
+void WaverEngine::activateChain(int stages) noexcept
+{
+    oversamplingStages = stages;
+    auto& chain = chains[static_cast<std::size_t>(stages)];
+    voiceOversampler = chain.voice.get();
+    voiceOversampledBus = chain.voiceBus;
+    printOversampler = chain.print.get();
+    clipOversampler = chain.clip.get();
+    for (auto* os : { voiceOversampler, printOversampler, clipOversampler })
+        if (os != nullptr)
+            os->reset();
+
+    latencyPad = reportedLatency - chain.latencySamples;
+    padBuffer.clear();
+    padWrite = 0;
+    organDelaySamples = chain.voiceLatencySamples;
+    organDelay.clear();
+    organDelayWrite = 0;
+
+    const double oversampledRate = hostSpec.sampleRate * static_cast<double>(1 << stages);
+    voiceAllocator.setSampleRate(oversampledRate);
+    printChain.setSaturationRate(oversampledRate);
+}
+
 void WaverEngine::reset() noexcept
 {
     voiceAllocator.reset();
@@ -81,92 +155,420 @@ void WaverEngine::reset() noexcept
     organ.reset();
     printChain.reset();
     organLevel.setCurrentAndTargetValue(organLevel.getTargetValue());
-    hpfStage1.s1L = hpfStage1.s2L = 0.0f;
-    hpfStage1.s1R = hpfStage1.s2R = 0.0f;
-    hpfStage2.s1L = hpfStage2.s2L = 0.0f;
-    hpfStage2.s1R = hpfStage2.s2R = 0.0f;
-    monoCollapseSide.s1L = monoCollapseSide.s2L = 0.0f;
-    monoCollapseSide.s1R = monoCollapseSide.s2R = 0.0f;
-    hfStateL = hfStateR = 0.0f;
+    subsonicHpf.reset();
+    monoCollapseSide.reset();
+    hfRolloff.reset();
+    for (auto* os : { voiceOversampler, printOversampler, clipOversampler })
+        if (os != nullptr)
+            os->reset();
+    padBuffer.clear();
+    padWrite = 0;
+    organDelay.clear();
+    organDelayWrite = 0;
+    chainFade.setCurrentAndTargetValue(chainFade.getTargetValue());
+    chainFadeRemaining = 0;
+}
+
+void WaverEngine::process(std::span<float> left, std::span<float> right, const juce::MidiBuffer& midi) noexcept
+{
+    profiler.beginBlock();
+
+    // The oversamplers and scratch buffers hold maximumBlockSize samples, so
+    // larger host blocks are rendered in chunks of at most that size.
+    const int numSamples = static_cast<int>(left.size());
+    const int maxChunk = std::max(1, static_cast<int>(hostSpec.maximumBlockSize));
+    auto nextEvent = midi.begin();
+    int chunkStart = 0;
+    do
+    {
+        // Quality change: fade out on the current chain and end the chunk
+        // where the fade reaches zero, so the next one swaps and fades in
+        // without a silent gap.
+        updateChainSwap();
+        int chunkLength = std::min(maxChunk, numSamples - chunkStart);
+        if (chainFadeRemaining > 0 && chainFade.getTargetValue() <= 0.0f)
+            chunkLength = std::min(chunkLength, chainFadeRemaining);
+
+        const auto start = static_cast<std::size_t>(chunkStart);
+        const auto length = static_cast<std::size_t>(chunkLength);
+        processChunk(left.subspan(start, length), right.subspan(start, length),
+                     chunkStart, chunkStart + chunkLength == numSamples, nextEvent, midi.end());
+        chunkStart += chunkLength;
+    } while (chunkStart < numSamples);
+
+    profiler.endBlock(left.size(), stageProfile);
+}
+
+void WaverEngine::processChunk(std::span<float> left, std::span<float> right, int hostOffset, bool lastChunk,
+                               juce::MidiBufferIterator& nextEvent, juce::MidiBufferIterator endEvent) noexcept
+{
+    blockLeft = left;
+    blockRight = right;
+    segmentStart = 0;
+    numTimedEvents = 0;
+
+    // Arp gate edges are generated between MIDI events, so held-note changes
+    // land before the steps that follow them. Events past the host block end
+    // are clamped into the last chunk.
+    const int numSamples = static_cast<int>(left.size());
+    int cursor = 0;
+    if (trace != nullptr)
+        trace->begin("midi");
+    for (; nextEvent != endEvent; ++nextEvent)
+    {
+        const auto metadata = *nextEvent;
+        if (!lastChunk && metadata.samplePosition - hostOffset >= numSamples)
+            break;
+
+        const int position = juce::jlimit(cursor, numSamples, metadata.samplePosition - hostOffset);
+        if (arpEnabled)
+            queueArpEvents(cursor, position);
+        queueMidiEvent(metadata.getMessage(), position);
+        cursor = position;
+    }
+    if (arpEnabled)
+        queueArpEvents(cursor, numSamples);
+    if (trace != nullptr)
+        trace->end("midi");
+
+    renderSegment(left.subspan(static_cast<std::size_t>(segmentStart)),
+                  right.subspan(static_cast<std::size_t>(segmentStart)));
 }
 
-void WaverEngine::process(std::span<float> left, std::span<float> right) noexcept
+void WaverEngine::pushTimedEvent(int hostSample, TimedEventType type, int noteNumber, float value) noexcept
 {
-    if (arpEnabled)
+    // Event list full: render up to this event and start a new segment.
+    if (numTimedEvents == kMaxTimedEvents)
+    {
+        const auto start = static_cast<std::size_t>(segmentStart);
+        const auto length = static_cast<std::size_t>(hostSample - segmentStart);
+        renderSegment(blockLeft.subspan(start, length), blockRight.subspan(start, length));
+        segmentStart = hostSample;
+    }
+
+    timedEvents[numTimedEvents++] = { hostSample - segmentStart, type, noteNumber, value };
+}
+
+void WaverEngine::queueArpEvents(int startSample, int endSample) noexcept
+{
+    // Slices hold at most one or two arp steps at the fastest rate, so the
+    // event buffer never fills however long the host block is.
+    std::array<ArpEngine::NoteEvent, 32> arpEvents;
+    for (int sliceStart = startSample; sliceStart < endSample; sliceStart += kArpSliceSamples)
+    {
+        const int sliceLength = std::min(kArpSliceSamples, endSample - sliceStart);
+        const int count = arp.advance(sliceLength, arpEvents);
+        for (int i = 0; i < count; ++i)
+        {
+            const auto& event = arpEvents[static_cast<std::size_t>(i)];
+            pushTimedEvent(sliceStart + event.sampleOffset,
+                           event.isNoteOn ? TimedEventType::noteOn : TimedEventType::noteOff,
+                           event.noteNumber, event.velocity);
+        }
+    }
+}
+
+void WaverEngine::queueMidiEvent(const juce::MidiMessage& message, int hostSample) noexcept
+{
+    const auto push = [this, hostSample](TimedEventType type, int noteNumber, float value) noexcept {
+        pushTimedEvent(hostSample, type, noteNumber, value);
+    };
+
+    if (message.isNoteOn())
+    {
+        if (arpEnabled)
+            arp.noteOn(message.getNoteNumber(), message.getFloatVelocity());
+        else
+            push(TimedEventType::noteOn, message.getNoteNumber(), message.getFloatVelocity());
+    }
+    else if (message.isNoteOff())
+    {
+        if (arpEnabled)
+            arp.noteOff(message.getNoteNumber());
+        else
+            push(TimedEventType::noteOff, message.getNoteNumber(), 0.0f);
+    }
+    else if (message.isPitchWheel())
+    {
+        constexpr float kBendRange = 2.0f;
+        const float bend = (static_cast<float>(message.getPitchWheelValue()) - 8192.0f) / 8192.0f;
+        push(TimedEventType::pitchBend, 0, bend * kBendRange);
+    }
+    else if (message.isChannelPressure())
+    {
+        const float pressure = static_cast<float>(message.getChannelPressureValue()) / 127.0f;
+        push(TimedEventType::aftertouch, 0, pressure * 4000.0f);
+    }
+    else if (message.isController())
+    {
+        const int cc = message.getControllerNumber();
+        const float val01 = static_cast<float>(message.getControllerValue()) / 127.0f;
+
+        if (cc == 64)
+            push(TimedEventType::sustain, 0, message.getControllerValue() >= 64 ? 1.0f : 0.0f);
+        else if (cc == 1)
+            push(TimedEventType::modWheel, 0, val01);
+        else if (cc == 123 || cc == 120)
+            arp.allNotesOff();
+    }
+}
+
+void WaverEngine::applyVoiceEvent(const TimedEvent& event) noexcept
+{
+    switch (event.type)
+    {
+        case TimedEventType::noteOn:
+        {
+            const auto steals = voiceAllocator.getStealCount();
+            voiceAllocator.noteOn(event.noteNumber, event.value);
+            if (trace != nullptr && voiceAllocator.getStealCount() != steals)
+                trace->instant("voiceSteal", static_cast<float>(event.noteNumber));
+            break;
+        }
+        case TimedEventType::noteOff:    voiceAllocator.noteOff(event.noteNumber); break;
+        case TimedEventType::sustain:    voiceAllocator.setSustainPedal(event.value > 0.5f); break;
+        case TimedEventType::pitchBend:  voiceAllocator.setPitchBendSemitones(event.value); break;
+        case TimedEventType::aftertouch: voiceAllocator.setAftertouchCutoffOffset(event.value); break;
+        case TimedEventType::modWheel:   voiceAllocator.setModWheelDepth(event.value); break;
+        default: break;
+    }
+}
+
+void WaverEngine::renderSegment(std::span<float> left, std::span<float> right) noexcept
+{
+    renderVoices(left, right);
+    mixOrgan(left, right);
+    numTimedEvents = 0;
+
+    // BBD chorus (stereo widening).
+    {
+        const Profiler::Scope timer(profiler, WaverStage::chorus);
+        chorus.process(left.data(), right.data(), static_cast<int>(left.size()));
+    }
+
+    // Print chain (overdrive -> tape -> wow/flutter -> noise floor).
+    processPrintChain(left, right);
+
+    // --- Master output chain ---
+    {
+        const Profiler::Scope timer(profiler, WaverStage::master);
+
+        // 1. Subsonic HPF (4th-order Butterworth, 45 Hz, 24 dB/oct), whole block.
+        subsonicHpf.process({ left.data(), right.data() }, static_cast<int>(left.size()));
+
+        for (std::size_t i = 0; i < left.size(); ++i)
+        {
+            // 2. Low-end mono collapse (highpass the side channel at 200 Hz).
+            const float mid = 0.5f * (left[i] + right[i]);
+            const float side = 0.5f * (left[i] - right[i]);
+            const float sideHigh = side - monoCollapseSide.processSample(side);
+            std::array<float, 2> frame { mid + sideHigh, mid - sideHigh };
+
+            // 3. HF rolloff (one-pole LP, 18 kHz).
+            hfRolloff.processFrame(frame);
+            left[i] = frame[0];
+            right[i] = frame[1];
+        }
+    }
+
+    // 4. Soft clipper (tanh waveshaper).
+    applyClipper(left, right);
+
+    const Profiler::Scope timer(profiler, WaverStage::master);
+    applyChainOutput(left, right);
+}
+
+void WaverEngine::applyChainOutput(std::span<float> left, std::span<float> right) noexcept
+{
+    if (latencyPad > 0)
     {
-        bool first = true;
-        for (int safety = 0; safety < 10; ++safety)
+        const int padSize = padBuffer.getNumSamples();
+        float* padLeft = padBuffer.getWritePointer(0);
+        float* padRight = padBuffer.getWritePointer(1);
+        for (std::size_t i = 0; i < left.size(); ++i)
         {
-            auto event = arp.advance(first ? static_cast<int>(left.size()) : 0);
-            first = false;
-            if (event.noteNumber < 0)
-                break;
+            const int readIndex = (padWrite + padSize - latencyPad) % padSize;
+            padLeft[padWrite] = left[i];
+            padRight[padWrite] = right[i];
+            left[i] = padLeft[readIndex];
+            right[i] = padRight[readIndex];
+            padWrite = (padWrite + 1) % padSize;
+        }
+    }
+
+    if (!chainFade.isSmoothing() && chainFade.getTargetValue() >= 1.0f)
+        return;
+
+    chainFadeRemaining = std::max(0, chainFadeRemaining - static_cast<int>(left.size()));
+    for (std::size_t i = 0; i < left.size(); ++i)
+    {
+        const float gain = chainFade.getNextValue();
+        left[i] *= gain;
+        right[i] *= gain;
+    }
+}
 
-            if (event.isNoteOn)
+void WaverEngine::renderVoices(std::span<float> left, std::span<float> right) noexcept
+{
+    // The voice bus is mono, rendered into left and copied to right.
+    float* channels[] = { left.data() };
+    juce::dsp::AudioBlock<float> hostBlock(channels, 1, left.size());
+    // Oversampled, the voices render straight into the resampler's top-rate
+    // buffer and only the down pass runs. They write every sample, so the
+    // buffer needs no clearing.
+    std::span<float> voiceBus = left;
+    if (voiceOversampler != nullptr)
+        voiceBus = std::span<float>(voiceOversampledBus, left.size() << oversamplingStages);
+
+    {
+        const Profiler::Scope timer(profiler, WaverStage::voices);
+
+        // Events land on their host sample scaled into the oversampled domain.
+        const std::size_t factor = std::size_t { 1 } << oversamplingStages;
+        std::size_t cursor = 0;
+        for (std::size_t e = 0; e < numTimedEvents; ++e)
+        {
+            const auto& event = timedEvents[e];
+            const std::size_t position = std::min(voiceBus.size(), static_cast<std::size_t>(event.sample) * factor);
+            if (position > cursor)
             {
-                voiceAllocator.noteOn(event.noteNumber, event.velocity);
-                organ.noteOn(event.noteNumber);
+                const auto segment = voiceBus.subspan(cursor, position - cursor);
+                voiceAllocator.render(segment, segment);
+                cursor = position;
             }
-            else
+            applyVoiceEvent(event);
+        }
+        if (cursor < voiceBus.size())
+        {
+            const auto segment = voiceBus.subspan(cursor);
+            voiceAllocator.render(segment, segment);
+        }
+    }
+
+    if (voiceOversampler != nullptr)
+    {
+        const Profiler::Scope timer(profiler, WaverStage::oversampling);
+        voiceOversampler->processSamplesDown(hostBlock);
+    }
+
+    if (right.data() != left.data())
+        std::copy(left.begin(), left.end(), right.begin());
+}
+
+void WaverEngine::mixOrgan(std::span<float> left, std::span<float> right) noexcept
+{
+    const Profiler::Scope timer(profiler, WaverStage::organ);
+    std::size_t cursor = 0;
+    const auto renderTo = [&](std::size_t end) noexcept {
+        for (; cursor < end; ++cursor)
+        {
+            float organSample = organ.processSample() * organLevel.getNextValue();
+            if (organDelaySamples > 0)
             {
-                voiceAllocator.noteOff(event.noteNumber);
-                organ.noteOff(event.noteNumber);
+                const int delaySize = organDelay.getNumSamples();
+                float* delayLine = organDelay.getWritePointer(0);
+                const int readIndex = (organDelayWrite + delaySize - organDelaySamples) % delaySize;
+                delayLine[organDelayWrite] = organSample;
+                organSample = delayLine[readIndex];
+                organDelayWrite = (organDelayWrite + 1) % delaySize;
             }
+            left[cursor] += organSample;
+            right[cursor] += organSample;
         }
+    };
+
+    for (std::size_t e = 0; e < numTimedEvents; ++e)
+    {
+        const auto& event = timedEvents[e];
+        if (event.type != TimedEventType::noteOn && event.type != TimedEventType::noteOff)
+            continue;
+
+        renderTo(std::min(left.size(), static_cast<std::size_t>(event.sample)));
+        if (event.type == TimedEventType::noteOn)
+            organ.noteOn(event.noteNumber);
+        else
+            organ.noteOff(event.noteNumber);
     }
+    renderTo(left.size());
+}
 
-    voiceAllocator.render(left, right);
+void WaverEngine::processPrintChain(std::span<float> left, std::span<float> right) noexcept
+{
+    const int numSamples = static_cast<int>(left.size());
+    if (printOversampler == nullptr)
+    {
+        const Profiler::Scope timer(profiler, WaverStage::print);
+        printChain.process(left.data(), right.data(), numSamples);
+        return;
+    }
 
-    for (std::size_t i = 0; i < left.size(); ++i)
+    float* wetLeft = printWet.getWritePointer(0);
+    float* wetRight = printWet.getWritePointer(1);
+    float* channels[] = { left.data(), right.data(), wetLeft, wetRight };
+
+    // Bypassed: the dry pair still takes the round trip so latency does not
+    // change when the print mix reaches zero.
+    if (!printChain.beginBlock())
     {
-        const float organSample = organ.processSample() * organLevel.getNextValue();
-        left[i] += organSample;
-        right[i] += organSample;
+        const Profiler::Scope timer(profiler, WaverStage::oversampling);
+        juce::dsp::AudioBlock<float> dryBlock(channels, 2, left.size());
+        printOversampler->processSamplesUp(dryBlock);
+        printOversampler->processSamplesDown(dryBlock);
+        return;
     }
 
-    // BBD chorus (stereo widening).
-    chorus.process(left.data(), right.data(), static_cast<int>(left.size()));
+    std::copy(left.begin(), left.end(), wetLeft);
+    std::copy(right.begin(), right.end(), wetRight);
 
-    // Print chain (overdrive -> tape -> wow/flutter -> noise floor).
-    printChain.process(left.data(), right.data(), static_cast<int>(left.size()));
+    juce::dsp::AudioBlock<float> hostBlock(channels, 4, left.size());
+    juce::dsp::AudioBlock<float> up;
+    {
+        const Profiler::Scope timer(profiler, WaverStage::oversampling);
+        up = printOversampler->processSamplesUp(hostBlock);
+    }
+    {
+        const Profiler::Scope timer(profiler, WaverStage::print);
+        printChain.processSaturation(up.getChannelPointer(2), up.getChannelPointer(3),
+                                     static_cast<int>(up.getNumSamples()));
+    }
+    {
+        const Profiler::Scope timer(profiler, WaverStage::oversampling);
+        printOversampler->processSamplesDown(hostBlock);
+    }
 
-    // --- Master output chain ---
-    auto applyBiquad = [](BiquadStage& s, float in, float& s1, float& s2) {
-        const float out = s.b0 * in + s1;
-        s1 = s.b1 * in - s.a1 * out + s2;
-        s2 = s.b2 * in - s.a2 * out;
-        return out;
+    const Profiler::Scope timer(profiler, WaverStage::print);
+    printChain.processPrint(left.data(), right.data(), wetLeft, wetRight, numSamples);
+}
+
+void WaverEngine::applyClipper(std::span<float> left, std::span<float> right) noexcept
+{
+    const auto clip = [](float* data, std::size_t numSamples) noexcept {
+        for (std::size_t i = 0; i < numSamples; ++i)
+            data[i] = fastTanh(data[i]);
     };
 
-    for (std::size_t i = 0; i < left.size(); ++i)
+    if (clipOversampler == nullptr)
+    {
+        const Profiler::Scope timer(profiler, WaverStage::master);
+        clip(left.data(), left.size());
+        clip(right.data(), right.size());
+        return;
+    }
+
+    float* channels[] = { left.data(), right.data() };
+    juce::dsp::AudioBlock<float> hostBlock(channels, 2, left.size());
+    juce::dsp::AudioBlock<float> up;
+    {
+        const Profiler::Scope timer(profiler, WaverStage::oversampling);
+        up = clipOversampler->processSamplesUp(hostBlock);
+    }
     {
-        float L = left[i];
-        float R = right[i];
-
-        // 1. Subsonic HPF (4th-order Butterworth, 45 Hz, 24 dB/oct).
-        L = applyBiquad(hpfStage1, L, hpfStage1.s1L, hpfStage1.s2L);
-        L = applyBiquad(hpfStage2, L, hpfStage2.s1L, hpfStage2.s2L);
-        R = applyBiquad(hpfStage1, R, hpfStage1.s1R, hpfStage1.s2R);
-        R = applyBiquad(hpfStage2, R, hpfStage2.s1R, hpfStage2.s2R);
-
-        // 2. Low-end mono collapse (highpass the side channel at 200 Hz).
-        const float mid = 0.5f * (L + R);
-        const float side = 0.5f * (L - R);
-        const float sideLow = applyBiquad(monoCollapseSide, side, monoCollapseSide.s1L, monoCollapseSide.s2L);
-        const float sideHigh = side - sideLow;
-        L = mid + sideHigh;
-        R = mid - sideHigh;
-
-        // 3. HF rolloff (one-pole LP, 18 kHz).
-        hfStateL += hfCoeff * (L - hfStateL);
-        L = hfStateL;
-        hfStateR += hfCoeff * (R - hfStateR);
-        R = hfStateR;
-
-        // 4. Soft clipper (tanh waveshaper).
-        left[i] = std::tanh(L);
-        right[i] = std::tanh(R);
+        const Profiler::Scope timer(profiler, WaverStage::master);
+        clip(up.getChannelPointer(0), up.getNumSamples());
+        clip(up.getChannelPointer(1), up.getNumSamples());
     }
+    const Profiler::Scope timer(profiler, WaverStage::oversampling);
+    clipOversampler->processSamplesDown(hostBlock);
 }
 
 void WaverEngine::noteOn(int midiNote, float velocity) noexcept
@@ -305,6 +707,11 @@ void WaverEngine::setAftertouchCutoffOffset(float offsetHz) noexcept
     voiceAllocator.setAftertouchCutoffOffset(offsetHz);
 }
 
+void WaverEngine::setUnison(int voiceCount, float detuneCents) noexcept
+{
+    voiceAllocator.setUnison(voiceCount, detuneCents);
+}
+
 void WaverEngine::setOrganDrawbars(float sub16, float fund8, float harm4, float mixture) noexcept
 {
     organ.setDrawbars(sub16, fund8, harm4, mixture);
@@ -359,36 +766,8 @@ void WaverEngine::setArpPuck(float puckX, float puckY) noexcept
     arp.setPuckParams(puckX, puckY);
 }
 
-void WaverEngine::setArpHostTempo(double bpm) noexcept
-{
-    arp.setHostTempo(bpm);
-}
-
-void WaverEngine::arpNoteOn(int midiNote, float velocity) noexcept
-{
-    if (arpEnabled)
-        arp.noteOn(midiNote, velocity);
-    else
-    {
-        voiceAllocator.noteOn(midiNote, velocity);
-        organ.noteOn(midiNote);
-    }
-}
-
-void WaverEngine::arpNoteOff(int midiNote, float velocity) noexcept
-{
-    juce::ignoreUnused(velocity);
-    if (arpEnabled)
-        arp.noteOff(midiNote);
-    else
-    {
-        voiceAllocator.noteOff(midiNote);
-        organ.noteOff(midiNote);
-    }
-}
-
-void WaverEngine::arpAllNotesOff() noexcept
+void WaverEngine::setArpHostPosition(double ppqPosition, double bpm, bool isPlaying) noexcept
 {
-    arp.allNotesOff();
+    arp.setHostPosition(ppqPosition, bpm, isPlaying);
 }
 } // namespace threadbare::dsp
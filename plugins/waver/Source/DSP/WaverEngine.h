@@ -1,23 +1,67 @@
 #pragma once
 
 #include <juce_dsp/juce_dsp.h>
+#include <array>
 #include <cstdint>
+#include <memory>
 #include <span>
 
 #include "ArpEngine.h"
 #include "BbdChorus.h"
+#include "BiquadCascade.h"
 #include "OrganEngine.h"
 #include "PrintChain.h"
+#include "StageProfiler.h"
+#include "TraceBuffer.h"
 #include "WaverVoiceAllocator.h"
 
 namespace threadbare::dsp
 {
+// Block stages timed by THREADBARE_STAGE_PROFILING builds. oversampling is
+// every resampler up/down pass; the stage it wraps is timed without it.
+enum class WaverStage : std::uint8_t
+{
+    voices,
+    organ,
+    chorus,
+    print,
+    master,
+    oversampling,
+    count
+};
+
+inline constexpr std::array<const char*, static_cast<std::size_t>(WaverStage::count)> kWaverStageNames {
+    "voices", "organ", "chorus", "print", "master", "oversampling"
+};
+
+using WaverStageProfile = threadbare::core::StageProfile<static_cast<std::size_t>(WaverStage::count)>;
+
 class WaverEngine
 {
 public:
-    void prepare(const juce::dsp::ProcessSpec& spec, std::uint32_t driftSeed) noexcept;
+    // spec is the host rate. oversamplingStages (0 = off, 1 = 2x, 2 = 4x)
+    // applies only to the aliasing-prone stages: the voice bank, the print
+    // saturation and the master clipper. Organ, chorus, wow/flutter, noise
+    // and the master filters always run at the host rate; the organ is
+    // delayed by the voice resampler's latency so the two stay aligned.
+    //
+    // prepare builds the oversampled segments for every factor up front.
+    // setOversampling is realtime-safe: the output fades out over 5 ms, the
+    // preallocated chain is swapped in at the sample where the fade ends and
+    // the output fades back up. The voice bank is re-rated in place, so notes,
+    // filter state and LFO phase carry across the swap.
+    void prepare(const juce::dsp::ProcessSpec& spec, std::uint32_t driftSeed, int oversamplingStages);
+    void setOversampling(int oversamplingStages) noexcept;
+
+    // Constant across quality modes: lighter chains are padded to the
+    // latency of the 4x chain, so switching never moves host PDC.
+    int getLatencySamples() const noexcept { return reportedLatency; }
     void reset() noexcept;
-    void process(std::span<float> left, std::span<float> right) noexcept;
+    // Renders one host block, in chunks of at most spec.maximumBlockSize.
+    // MIDI is consumed at its sample position (scaled into the oversampled
+    // domain for the voice bank), so each resampler runs once per chunk
+    // however dense the events are.
+    void process(std::span<float> left, std::span<float> right, const juce::MidiBuffer& midi) noexcept;
     void noteOn(int midiNote, float velocity) noexcept;
     void noteOff(int midiNote, float velocity) noexcept;
     void setSustainPedal(bool isDown) noexcept;
@@ -44,6 +88,7 @@ public:
     void setPitchBendSemitones(float semitones) noexcept;
     void setModWheelDepth(float depth01) noexcept;
     void setAftertouchCutoffOffset(float offsetHz) noexcept;
+    void setUnison(int voiceCount, float detuneCents) noexcept;
 
     void setOrganDrawbars(float sub16, float fund8, float harm4, float mixture) noexcept;
     void setOrganLevel(float level) noexcept;
@@ -57,12 +102,104 @@ public:
 
     void setArpEnabled(bool on) noexcept;
     void setArpPuck(float puckX, float puckY) noexcept;
-    void setArpHostTempo(double bpm) noexcept;
-    void arpNoteOn(int midiNote, float velocity) noexcept;
-    void arpNoteOff(int midiNote, float velocity) noexcept;
-    void arpAllNotesOff() noexcept;
+    void setArpHostPosition(double ppqPosition, double bpm, bool isPlaying) noexcept;
+
+    // Stage breakdown of the last process() call (all zero unless profiling).
+    const WaverStageProfile& getStageProfile() const noexcept { return stageProfile; }
+
+    // Organ drawbar tables are built off the audio thread: drawbar moves
+    // notify the signal, and its worker calls serviceBackgroundWork().
+    void setWorkSignal(threadbare::core::WorkSignal* signal) noexcept { organ.setTableSignal(signal); }
+    void serviceBackgroundWork() noexcept { organ.buildPendingTable(); }
+
+    // Optional trace ring for MIDI handling and voice steals; owned by the caller.
+    void setTrace(threadbare::core::TraceBuffer* traceToUse) noexcept { trace = traceToUse; }
 
 private:
+    using Profiler = threadbare::core::StageProfiler<WaverStage>;
+    using Oversampler = juce::dsp::Oversampling<float>;
+
+    enum class TimedEventType : std::uint8_t
+    {
+        noteOn,
+        noteOff,
+        sustain,
+        pitchBend,
+        aftertouch,
+        modWheel
+    };
+
+    // MIDI and arp gate edges, timestamped relative to the segment start.
+    struct TimedEvent
+    {
+        int sample = 0;
+        TimedEventType type = TimedEventType::noteOn;
+        int noteNumber = 0;
+        float value = 0.0f;
+    };
+
+    static constexpr std::size_t kMaxTimedEvents = 256;
+    static constexpr int kArpSliceSamples = 256;
+
+    void pushTimedEvent(int hostSample, TimedEventType type, int noteNumber, float value) noexcept;
+    void queueMidiEvent(const juce::MidiMessage& message, int hostSample) noexcept;
+    void processChunk(std::span<float> left, std::span<float> right, int hostOffset, bool lastChunk,
+                      juce::MidiBufferIterator& nextEvent, juce::MidiBufferIterator endEvent) noexcept;
+    void queueArpEvents(int startSample, int endSample) noexcept;
+    void applyVoiceEvent(const TimedEvent& event) noexcept;
+    void renderSegment(std::span<float> left, std::span<float> right) noexcept;
+    void renderVoices(std::span<float> left, std::span<float> right) noexcept;
+    void mixOrgan(std::span<float> left, std::span<float> right) noexcept;
+    void processPrintChain(std::span<float> left, std::span<float> right) noexcept;
+    void applyClipper(std::span<float> left, std::span<float> right) noexcept;
+    void applyChainOutput(std::span<float> left, std::span<float> right) noexcept;
+    void startChainFade(float target) noexcept;
+    void updateChainSwap() noexcept;
+    void activateChain(int stages) noexcept;
+    static float* captureVoiceBus(Oversampler& oversampler, juce::uint32 maximumBlockSize);
+
+    // Oversampled segments for one factor (all null at 1x). The voice bus is
+    // mono; the print segment carries dry L/R alongside the saturated pair so
+    // the dry/wet mix stays phase-aligned after decimation.
+    struct OversampledChain
+    {
+        std::unique_ptr<Oversampler> voice;
+        float* voiceBus = nullptr; // voice's top-rate buffer, rendered into directly
+        std::unique_ptr<Oversampler> print;
+        std::unique_ptr<Oversampler> clip;
+        int latencySamples = 0;
+        int voiceLatencySamples = 0;
+    };
+
+    juce::dsp::ProcessSpec hostSpec { 44100.0, 512, 2 };
+    std::array<OversampledChain, 3> chains;
+    int oversamplingStages = 0;
+    int requestedStages = 0;
+    Oversampler* voiceOversampler = nullptr;
+    float* voiceOversampledBus = nullptr;
+    Oversampler* printOversampler = nullptr;
+    Oversampler* clipOversampler = nullptr;
+    juce::AudioBuffer<float> printWet;
+
+    // Latency padding up to reportedLatency, and the fade around chain swaps.
+    int reportedLatency = 0;
+    int latencyPad = 0;
+    juce::AudioBuffer<float> padBuffer;
+    int padWrite = 0;
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> chainFade;
+    int chainFadeLength = 1;
+    int chainFadeRemaining = 0;
+
+    // Delays the host-rate organ by the active voice resampler's latency.
+    juce::AudioBuffer<float> organDelay;
+    int organDelaySamples = 0;
+    int organDelayWrite = 0;
+
+    std::array<TimedEvent, kMaxTimedEvents> timedEvents{};
+    std::size_t numTimedEvents = 0;
+    std::span<float> blockLeft, blockRight;
+    int segmentStart = 0;
+
     WaverVoiceAllocator voiceAllocator;
     ArpEngine arp;
     BbdChorus chorus;
@@ -71,24 +208,19 @@ private:
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> organLevel;
     bool arpEnabled = false;
 
-    struct BiquadStage
-    {
-        float b0 = 1.0f, b1 = -2.0f, b2 = 1.0f;
-        float a1 = 0.0f, a2 = 0.0f;
-        float s1L = 0.0f, s2L = 0.0f;
-        float s1R = 0.0f, s2R = 0.0f;
-    };
-
-    // 4th-order Butterworth HPF (two cascaded biquad sections).
-    BiquadStage hpfStage1, hpfStage2;
+    // 4th-order Butterworth HPF (two cascaded biquad sections, L/R lanes).
+    threadbare::core::BiquadCascade<2, 2> subsonicHpf;
 
     // Low-end mono collapse (2nd-order Butterworth LP at 200 Hz on side channel).
     // We lowpass the side and subtract it, effectively highpassing the side so bass is mono
     // without time-varying cancellation artifacts.
-    BiquadStage monoCollapseSide;
+    threadbare::core::BiquadCascade<1, 1> monoCollapseSide;
+
+    // Gentle HF rolloff (one-pole LP at 18 kHz, L/R lanes).
+    threadbare::core::BiquadCascade<2, 1> hfRolloff;
 
-    // Gentle HF rolloff (one-pole LP at 18 kHz).
-    float hfCoeff = 0.0f;
-    float hfStateL = 0.0f, hfStateR = 0.0f;
+    Profiler profiler;
+    WaverStageProfile stageProfile;
+    threadbare::core::TraceBuffer* trace = nullptr;
 };
 } // namespace threadbare::dsp
@@ -6,10 +6,15 @@
 namespace threadbare::dsp
 {
 void WaverLFO::prepare(double newSampleRate) noexcept
+{
+    setSampleRate(newSampleRate);
+    reset();
+}
+
+void WaverLFO::setSampleRate(double newSampleRate) noexcept
 {
     sampleRate = std::max(1.0, newSampleRate);
     setRateHz(rateHz);
-    reset();
 }
 
 void WaverLFO::reset() noexcept
@@ -29,12 +34,12 @@ void WaverLFO::setShape(Shape s) noexcept
     shape = s;
 }
 
-float WaverLFO::processSample() noexcept
+float WaverLFO::advance(int numSamples) noexcept
 {
-    const bool wrapped = (phase + increment) >= 1.0f;
-    phase += increment;
-    if (phase >= 1.0f)
-        phase -= 1.0f;
+    phase += increment * static_cast<float>(numSamples);
+    const bool wrapped = phase >= 1.0f;
+    if (wrapped)
+        phase -= std::floor(phase);
 
     switch (shape)
     {
@@ -59,7 +64,6 @@ float WaverLFO::processSample() noexcept
 
 float WaverLFO::random01() noexcept
 {
-    rng = rng * 1664525u + 1013904223u;
-    return static_cast<float>((rng >> 8) & 0x00FFFFFFu) / static_cast<float>(0x00FFFFFFu);
+    return rng.nextUnipolar();
 }
 } // namespace threadbare::dsp
@@ -4,6 +4,8 @@
 #include <array>
 #include <cstdint>
 
+#include "NoiseSource.h"
+
 namespace threadbare::dsp
 {
 class WaverLFO
@@ -18,10 +20,15 @@ public:
     };
 
     void prepare(double newSampleRate) noexcept;
+    // Changes rate without moving the phase.
+    void setSampleRate(double newSampleRate) noexcept;
     void reset() noexcept;
     void setRateHz(float hz) noexcept;
     void setShape(Shape s) noexcept;
-    float processSample() noexcept;
+    float processSample() noexcept { return advance(1); }
+
+    // Advances numSamples at once (control-rate use) and returns the new value.
+    float advance(int numSamples) noexcept;
 
 private:
     float random01() noexcept;
@@ -32,6 +39,6 @@ private:
     float increment = 0.0f;
     float heldSample = 0.0f;
     Shape shape = Shape::tri;
-    std::uint32_t rng = 0x12345678u;
+    threadbare::core::NoiseGenerator rng { 0x12345678u };
 };
 } // namespace threadbare::dsp
@@ -24,11 +24,11 @@ void ComponentTolerances::computeFromSeed(std::uint32_t seed) noexcept
     envReleaseScale = 1.0f + next() * 0.04f;
 }
 
-void WaverVoice::prepare(double newSampleRate, int voiceIndex, std::uint32_t driftSeed) noexcept
+void WaverVoice::prepare(double newSampleRate, int voiceIndex, std::uint32_t driftSeed, ToyEngine& toyBank,
+                         const WaverVoiceShared& sharedSettings) noexcept
 {
     sampleRate = std::max(1.0, newSampleRate);
     adsr.setSampleRate(sampleRate);
-    adsr.setParameters(adsrParameters);
     otaFilter.prepare(sampleRate);
     otaFilter.setCutoffHz(8000.0f);
     otaFilter.setResonance(0.15f);
@@ -41,12 +41,18 @@ void WaverVoice::prepare(double newSampleRate, int voiceIndex, std::uint32_t dri
     moogLadder.setCutoffHz(8000.0f);
     moogLadder.setResonance(0.15f);
 
+    controlInterval = std::max(1, static_cast<int>(std::lround(sampleRate / threadbare::tuning::waver::kModulationControlRateHz)));
+    controlIntervalInverse = 1.0f / static_cast<float>(controlInterval);
+
     lfo.prepare(sampleRate);
     lfo.setRateHz(3.0f);
     lfo.setShape(WaverLFO::Shape::tri);
 
-    ouDrift.prepare(sampleRate, driftSeed + static_cast<std::uint32_t>(voiceIndex) * 0x9E3779B9u);
-    toyEngine.prepare(sampleRate);
+    ouDrift.prepare(sampleRate / static_cast<double>(controlInterval), driftSeed + static_cast<std::uint32_t>(voiceIndex) * 0x9E3779B9u);
+    dcoStack.prepare(driftSeed ^ (static_cast<std::uint32_t>(voiceIndex) * 0x85EBCA6Bu));
+    toyEngine = &toyBank;
+    shared = &sharedSettings;
+    toyLane = voiceIndex;
     layerDcoLevel.reset(sampleRate, 0.015);
     layerToyLevel.reset(sampleRate, 0.015);
     layerDcoLevel.setCurrentAndTargetValue(1.0f);
@@ -59,15 +65,58 @@ void WaverVoice::prepare(double newSampleRate, int voiceIndex, std::uint32_t dri
 
     const std::uint32_t tolSeed = driftSeed ^ (static_cast<std::uint32_t>(voiceIndex) * 2654435761u);
     tolerances.computeFromSeed(tolSeed);
+    applyEnvelopeParameters();
 
     dcBlockerR = std::exp((-2.0f * std::numbers::pi_v<float> * 10.0f) / static_cast<float>(sampleRate));
     reset();
 }
 
+void WaverVoice::setSampleRate(double newSampleRate) noexcept
+{
+    const double previousRate = sampleRate;
+    sampleRate = std::max(1.0, newSampleRate);
+    const double ratio = sampleRate / previousRate;
+
+    adsr.setSampleRate(sampleRate);
+    applyEnvelopeParameters();
+    otaFilter.setSampleRate(sampleRate);
+    moogLadder.setSampleRate(sampleRate);
+
+    controlInterval = std::max(1, static_cast<int>(std::lround(sampleRate / threadbare::tuning::waver::kModulationControlRateHz)));
+    controlIntervalInverse = 1.0f / static_cast<float>(controlInterval);
+    controlCountdown = 0;
+
+    lfo.setSampleRate(sampleRate);
+    ouDrift.setStepRate(sampleRate / static_cast<double>(controlInterval));
+
+    layerDcoLevel.reset(sampleRate, 0.015);
+    layerToyLevel.reset(sampleRate, 0.015);
+    filterCutoffSmoothed.reset(sampleRate, 0.06);
+    filterResSmoothed.reset(sampleRate, 0.06);
+    dcBlockerR = std::exp((-2.0f * std::numbers::pi_v<float> * 10.0f) / static_cast<float>(sampleRate));
+
+    // Per-sample increments and ramp lengths keep their duration in seconds.
+    phaseIncrement = static_cast<float>(phaseIncrement / ratio);
+    subPhaseIncrement = static_cast<float>(subPhaseIncrement / ratio);
+    const auto rescale = [ratio](std::uint32_t samples) noexcept {
+        return static_cast<std::uint32_t>(static_cast<double>(samples) * ratio);
+    };
+    stealRampRemaining = rescale(stealRampRemaining);
+    stealRampTotal = rescale(stealRampTotal);
+    onsetRampRemaining = rescale(onsetRampRemaining);
+    onsetRampTotal = rescale(onsetRampTotal);
+    retriggerRampRemaining = rescale(retriggerRampRemaining);
+    retriggerRampTotal = rescale(retriggerRampTotal);
+    // The toy lane's ramp was in the old rate's samples; the next control
+    // tick (countdown 0) retargets it.
+    if (toyEngine != nullptr)
+        toyEngine->setLaneIncrement(toyLane, phaseIncrement);
+}
+
 void WaverVoice::reset() noexcept
 {
     adsr.reset();
-    phase = 0.0f;
+    dcoStack.reset();
     subPhase = 0.0f;
     phaseIncrement = 0.0f;
     subPhaseIncrement = 0.0f;
@@ -84,7 +133,6 @@ void WaverVoice::reset() noexcept
     retriggerRampRemaining = 0;
     retriggerRampTotal = 0;
     ageCounter = 0;
-    noiseState = 0xA341316Cu;
     midiNote = -1;
     active = false;
     held = false;
@@ -97,15 +145,20 @@ void WaverVoice::reset() noexcept
     layerToyLevel.setCurrentAndTargetValue(0.0f);
     filterCutoffSmoothed.setCurrentAndTargetValue(filterCutoffSmoothed.getTargetValue());
     filterResSmoothed.setCurrentAndTargetValue(filterResSmoothed.getTargetValue());
-    pinkB0 = 0.0f;
-    pinkB1 = 0.0f;
-    pinkB2 = 0.0f;
+    pendingDrift = 0.0f;
+    pendingEnvelope = 0.0f;
+    pendingDco = 0.0f;
+    pendingSub = 0.0f;
     ouDrift.reset();
-    toyEngine.reset();
+    controlCountdown = 0;
+    controlPrimed = false;
+    if (toyEngine != nullptr)
+        toyEngine->resetLane(toyLane);
 }
 
 void WaverVoice::noteOn(int noteNumber, float velocity, bool stolen) noexcept
 {
+    const bool wasActive = active;
     midiNote = noteNumber;
     velocityGain = juce::jlimit(0.0f, 1.0f, velocity);
     updateFrequencyFromMidi();
@@ -116,19 +169,23 @@ void WaverVoice::noteOn(int noteNumber, float velocity, bool stolen) noexcept
     active = true;
     ageCounter = 0;
 
-    toyEngine.setNote(targetFrequencyHz);
-
     if (stolen)
     {
-        phase = 0.0f;
+        dcoStack.reset();
         subPhase = 0.0f;
         lfo.reset();
         otaFilter.reset();
         moogLadder.reset();
-        toyEngine.reset();
-        toyEngine.setNote(targetFrequencyHz);
+        if (toyEngine != nullptr)
+            toyEngine->resetLane(toyLane);
     }
 
+    // A new note starts the toy lane on its pitch rather than ramping over
+    // from the last one; legato notes follow at the next control tick.
+    if (toyEngine != nullptr && (stolen || !wasActive))
+        toyEngine->setLaneIncrement(toyLane, currentFrequencyHz * driftPitchRamp.value * pitchModRamp.value
+                                                 / static_cast<float>(sampleRate));
+
     if (stolen)
     {
         stealRampTotal = static_cast<std::uint32_t>(sampleRate * 0.003);
@@ -146,12 +203,7 @@ void WaverVoice::noteOn(int noteNumber, float velocity, bool stolen) noexcept
     retriggerRampRemaining = retriggerRampTotal;
     retriggerStartSample = lastOutputSample;
 
-    adsr.setParameters({
-        adsrParameters.attack * tolerances.envAttackScale,
-        adsrParameters.decay,
-        adsrParameters.sustain,
-        adsrParameters.release * tolerances.envReleaseScale
-    });
+    applyEnvelopeParameters();
     adsr.noteOn();
 }
 
@@ -176,76 +228,116 @@ void WaverVoice::releaseFromSustain() noexcept
     adsr.noteOff();
 }
 
-float WaverVoice::processSample() noexcept
+void WaverVoice::beginSample(float noiseSample) noexcept
 {
     if (!active)
-        return 0.0f;
-
-    // OU drift: per-sample advance for determinism.
-    const float drift = ouDrift.processSample(driftAmount, ageParam);
+        return;
 
-    // Drift -> pitch: ±2-8 cents scaled by driftAmount.
-    const float pitchCents = drift *
-        (threadbare::tuning::waver::kDriftMinCents +
-         driftAmount * (threadbare::tuning::waver::kDriftMaxCents - threadbare::tuning::waver::kDriftMinCents));
-    const float pitchMultiplier = std::pow(2.0f, pitchCents / 1200.0f);
+    // Drift and LFO run at control rate; their shaped results ramp per sample.
+    if (--controlCountdown <= 0)
+    {
+        controlCountdown = controlInterval;
+        updateControlRate();
+    }
 
-    // LFO vibrato: pitch modulation in cents.
-    const float lfoValue = lfo.processSample();
-    const float effectiveVibrato = lfoToVibratoCents * modWheelDepth;
-    const float vibratoMultiplier = std::pow(2.0f, (effectiveVibrato * lfoValue) / 1200.0f);
-    const float pitchBendMultiplier = std::pow(2.0f, pitchBendSemitones / 12.0f);
+    const float drift = driftRamp.next();
+    const float pitchMultiplier = driftPitchRamp.next();
+    const float pitchModMultiplier = pitchModRamp.next();
+    const float pw = pulseWidthRamp.next();
 
     currentFrequencyHz += (targetFrequencyHz - currentFrequencyHz) * (1.0f - glideCoeff);
-    const float driftedFreq = currentFrequencyHz * pitchMultiplier * vibratoMultiplier * pitchBendMultiplier;
+    const float driftedFreq = currentFrequencyHz * pitchMultiplier * pitchModMultiplier;
     phaseIncrement = driftedFreq / static_cast<float>(sampleRate);
     const float subFreq = currentFrequencyHz * pitchMultiplier;
-    subPhaseIncrement = (subFreq * subOctaveMultiplier) / static_cast<float>(sampleRate);
+    subPhaseIncrement = (subFreq * shared->subOctaveMultiplier) / static_cast<float>(sampleRate);
 
-    // DCO oscillator.
-    float saw = 2.0f * phase - 1.0f;
-    saw -= polyBlep(phase, phaseIncrement);
-
-    const float pwRaw = (basePulseWidth + lfoToPwmDepth * lfoValue - 0.5f) * 2.22f;
-    const float pw = 0.5f + std::tanh(pwRaw) * 0.45f;
-    float pulse = phase < pw ? 1.0f : -1.0f;
-    pulse += polyBlamp(phase, phaseIncrement);
-    float fallingEdge = phase - pw;
-    if (fallingEdge < 0.0f)
-        fallingEdge += 1.0f;
-    pulse -= polyBlamp(fallingEdge, phaseIncrement);
+    // DCO oscillator (unison stack; a single lane is the classic DCO).
+    float dcoOut = dcoStack.process(phaseIncrement, pw, shared->waveBlend);
 
     subPhase += subPhaseIncrement;
     if (subPhase >= 1.0f)
         subPhase -= 1.0f;
 
     const float sub = std::sin(2.0f * std::numbers::pi_v<float> * subPhase);
-    noiseState = noiseState * 1664525u + 1013904223u;
-    const float white = (static_cast<float>((noiseState >> 8) & 0x00FFFFFFu) / static_cast<float>(0x00FFFFFFu)) * 2.0f - 1.0f;
-    pinkB0 = 0.99765f * pinkB0 + white * 0.0990460f;
-    pinkB1 = 0.96300f * pinkB1 + white * 0.2965164f;
-    pinkB2 = 0.57000f * pinkB2 + white * 1.0526913f;
-    const float pink = (pinkB0 + pinkB1 + pinkB2 + white * 0.1848f) * 0.22f;
-    const float noise = white + noiseColorMix * (pink - white);
-
-    phase += phaseIncrement;
-    if (phase >= 1.0f)
-        phase -= 1.0f;
-
-    float dcoOut = saw * (1.0f - waveBlend) + pulse * waveBlend;
-    dcoOut += noise * noiseLevel;
-
-    // Toy engine: shares envelope for AM, tracks same note.
-    toyEngine.setNote(driftedFreq);
-    float envelope = adsr.getNextSample();
+
+    // Noise arrives levelled and colored from the allocator's shared lanes.
+    dcoOut += noiseSample;
+
+    const float envelope = adsr.getNextSample();
     if (!adsr.isActive())
     {
         active = false;
         currentLevel = 0.0f;
-        return 0.0f;
+        // Stop the lane's increment ramp; nothing retargets it now.
+        toyEngine->setLaneIncrement(toyLane, phaseIncrement);
+        return;
+    }
+
+    // Toy engine: shares envelope for AM; its pitch ramps from updateControlRate.
+    toyEngine->setLaneEnvelope(toyLane, envelope);
+
+    pendingDrift = drift;
+    pendingEnvelope = envelope;
+    pendingDco = dcoOut;
+    pendingSub = sub;
+}
+
+void WaverVoice::updateControlRate() noexcept
+{
+    // OU drift: one seeded step per control tick for determinism.
+    const float drift = ouDrift.processSample(shared->driftAmount, shared->age);
+
+    // Drift -> pitch: ±2-8 cents scaled by driftAmount.
+    const float pitchCents = drift *
+        (threadbare::tuning::waver::kDriftMinCents +
+         shared->driftAmount * (threadbare::tuning::waver::kDriftMaxCents - threadbare::tuning::waver::kDriftMinCents));
+    const float pitchMultiplier = std::pow(2.0f, pitchCents / 1200.0f);
+
+    // LFO vibrato: pitch modulation in cents.
+    const float lfoValue = lfo.advance(controlInterval);
+    const float effectiveVibrato = shared->lfoToVibratoCents * shared->modWheelDepth;
+    const float vibratoMultiplier = std::pow(2.0f, (effectiveVibrato * lfoValue) / 1200.0f);
+    const float pitchBendMultiplier = shared->pitchBendMultiplier;
+
+    const float pwRaw = (basePulseWidth + shared->lfoToPwmDepth * lfoValue - 0.5f) * 2.22f;
+    const float pw = 0.5f + std::tanh(pwRaw) * 0.45f;
+
+    const float pitchMod = vibratoMultiplier * pitchBendMultiplier;
+    const float invSampleRate = 1.0f / static_cast<float>(sampleRate);
+
+    if (!controlPrimed)
+    {
+        driftRamp.snap(drift);
+        driftPitchRamp.snap(pitchMultiplier);
+        pitchModRamp.snap(pitchMod);
+        pulseWidthRamp.snap(pw);
+        toyEngine->setLaneIncrement(toyLane, currentFrequencyHz * pitchMultiplier * pitchMod * invSampleRate);
+        controlPrimed = true;
+        return;
     }
 
-    const float toyOut = toyEngine.processSample(envelope);
+    driftRamp.setTarget(drift, controlIntervalInverse);
+    driftPitchRamp.setTarget(pitchMultiplier, controlIntervalInverse);
+    pitchModRamp.setTarget(pitchMod, controlIntervalInverse);
+    pulseWidthRamp.setTarget(pw, controlIntervalInverse);
+
+    // The toy lane ramps to the pitch the DCO reaches at the end of this
+    // interval (glide included), so the lane is touched once per tick.
+    const float glideRemaining = std::pow(glideCoeff, static_cast<float>(controlInterval));
+    const float frequencyAtTick = targetFrequencyHz + (currentFrequencyHz - targetFrequencyHz) * glideRemaining;
+    toyEngine->rampLaneIncrement(toyLane, frequencyAtTick * pitchMultiplier * pitchMod * invSampleRate,
+                                 controlIntervalInverse);
+}
+
+float WaverVoice::finishSample(float toyOut) noexcept
+{
+    if (!active)
+        return 0.0f;
+
+    const float drift = pendingDrift;
+    const float sub = pendingSub;
+    float envelope = pendingEnvelope;
+    const float dcoOut = pendingDco;
 
     // Layer mix.
     const float dcoLevel = layerDcoLevel.getNextValue();
@@ -255,14 +347,14 @@ float WaverVoice::processSample() noexcept
     // Filter with drift, key tracking, envelope modulation, and component tolerances.
     const float filterDriftScale = 1.0f + drift *
         (threadbare::tuning::waver::kFilterDriftMin +
-         driftAmount * (threadbare::tuning::waver::kFilterDriftMax - threadbare::tuning::waver::kFilterDriftMin));
-    const float keyTrackSemitones = static_cast<float>(midiNote - 60) * filterKeyTrackAmount;
+         shared->driftAmount * (threadbare::tuning::waver::kFilterDriftMax - threadbare::tuning::waver::kFilterDriftMin));
+    const float keyTrackSemitones = static_cast<float>(midiNote - 60) * shared->filterKeyTrackAmount;
     const float keyTrackScale = std::pow(2.0f, keyTrackSemitones / 12.0f);
-    const float envFilterScale = 1.0f + envToFilterAmount * envelope * 4.0f;
+    const float envFilterScale = 1.0f + shared->envToFilterAmount * envelope * 4.0f;
     const float effectiveCutoff = filterCutoffSmoothed.getNextValue()
         * filterDriftScale * tolerances.filterCutoffScale
         * keyTrackScale * std::max(envFilterScale, 0.05f)
-        + aftertouchCutoffHz;
+        + shared->aftertouchCutoffHz;
     const float effectiveRes = filterResSmoothed.getNextValue() * tolerances.filterResScale;
 
     otaFilter.setCutoffHz(std::clamp(effectiveCutoff, 20.0f, 20000.0f));
@@ -270,11 +362,11 @@ float WaverVoice::processSample() noexcept
     moogLadder.setCutoffHz(std::clamp(effectiveCutoff, 20.0f, 20000.0f));
     moogLadder.setResonance(std::clamp(effectiveRes, 0.0f, 1.0f));
 
-    float filtered = useLadderFilter ? moogLadder.process(layerMixed) : otaFilter.process(layerMixed);
+    float filtered = shared->useLadderFilter ? moogLadder.process(layerMixed) : otaFilter.process(layerMixed);
 
     // Sub bypasses the filter to avoid resonant amplitude pumping from
     // filter cutoff drift/modulation at low frequencies.
-    filtered += sub * subLevel * dcoLevel;
+    filtered += sub * shared->subLevel * dcoLevel;
 
     const float dcBlocked = filtered - dcX1 + dcBlockerR * dcY1;
     dcX1 = filtered;
@@ -310,46 +402,6 @@ float WaverVoice::processSample() noexcept
     return output;
 }
 
-float WaverVoice::polyBlep(float t, float dt) noexcept
-{
-    if (dt <= 0.0f)
-        return 0.0f;
-
-    if (t < dt)
-    {
-        t /= dt;
-        return t + t - t * t - 1.0f;
-    }
-
-    if (t > 1.0f - dt)
-    {
-        t = (t - 1.0f) / dt;
-        return t * t + t + t + 1.0f;
-    }
-
-    return 0.0f;
-}
-
-float WaverVoice::polyBlamp(float t, float dt) noexcept
-{
-    if (dt <= 0.0f)
-        return 0.0f;
-
-    if (t < dt)
-    {
-        t /= dt;
-        return t - 0.5f * t * t - 0.5f;
-    }
-
-    if (t > 1.0f - dt)
-    {
-        t = (t - 1.0f) / dt;
-        return 0.5f * t * t + t + 0.5f;
-    }
-
-    return 0.0f;
-}
-
 void WaverVoice::updateFrequencyFromMidi() noexcept
 {
     const float note = static_cast<float>(midiNote);
@@ -357,7 +409,17 @@ void WaverVoice::updateFrequencyFromMidi() noexcept
     if (currentFrequencyHz <= 0.0f)
         currentFrequencyHz = targetFrequencyHz;
     phaseIncrement = currentFrequencyHz / static_cast<float>(sampleRate);
-    subPhaseIncrement = (currentFrequencyHz * subOctaveMultiplier) / static_cast<float>(sampleRate);
+    subPhaseIncrement = (currentFrequencyHz * shared->subOctaveMultiplier) / static_cast<float>(sampleRate);
+}
+
+void WaverVoice::applyEnvelopeParameters() noexcept
+{
+    adsr.setParameters({
+        adsrParameters.attack * tolerances.envAttackScale,
+        adsrParameters.decay,
+        adsrParameters.sustain,
+        adsrParameters.release * tolerances.envReleaseScale
+    });
 }
 
 void WaverVoice::setPortamento(float glideMs, bool alwaysMode) noexcept
@@ -383,42 +445,10 @@ void WaverVoice::setGlideStartFrequency(float hz) noexcept
         currentFrequencyHz = hz;
 }
 
-void WaverVoice::setFilter(float cutoffHz, float resonanceValue, bool ladderMode) noexcept
+void WaverVoice::setFilter(float cutoffHz, float resonanceValue) noexcept
 {
     filterCutoffSmoothed.setTargetValue(cutoffHz);
     filterResSmoothed.setTargetValue(resonanceValue);
-    useLadderFilter = ladderMode;
-}
-
-void WaverVoice::setWaveBlend(float blend) noexcept
-{
-    waveBlend = juce::jlimit(0.0f, 1.0f, blend);
-}
-
-void WaverVoice::setLfoToPwm(float depth) noexcept
-{
-    lfoToPwmDepth = juce::jlimit(0.0f, 1.0f, depth);
-}
-
-void WaverVoice::setDriftAmount(float amount) noexcept
-{
-    driftAmount = std::clamp(amount, 0.0f, 1.0f);
-}
-
-void WaverVoice::setAge(float age) noexcept
-{
-    ageParam = std::clamp(age, 0.0f, 1.0f);
-    toyEngine.setEnvelopeStepping(ageParam * 0.8f);
-}
-
-void WaverVoice::setSubLevel(float level) noexcept
-{
-    subLevel = std::clamp(level, 0.0f, 1.0f);
-}
-
-void WaverVoice::setNoiseLevel(float level) noexcept
-{
-    noiseLevel = std::clamp(level, 0.0f, 1.0f);
 }
 
 void WaverVoice::setLfoRate(float hz) noexcept
@@ -431,18 +461,6 @@ void WaverVoice::setLfoShape(int shape) noexcept
     lfo.setShape(static_cast<WaverLFO::Shape>(std::clamp(shape, 0, 3)));
 }
 
-void WaverVoice::setLfoToVibrato(float cents) noexcept
-{
-    lfoToVibratoCents = std::clamp(cents, 0.0f, 50.0f);
-}
-
-void WaverVoice::setToyParams(float modIndex, float ratioNorm, float feedback) noexcept
-{
-    toyEngine.setModIndex(modIndex * 4.0f);
-    toyEngine.setRatioNorm(ratioNorm);
-    toyEngine.setFeedback(feedback);
-}
-
 void WaverVoice::setLayerLevels(float dco, float toy) noexcept
 {
     layerDcoLevel.setTargetValue(std::clamp(dco, 0.0f, 1.0f));
@@ -455,46 +473,12 @@ void WaverVoice::setEnvelopeParams(float attack, float decay, float sustain, flo
     adsrParameters.decay = decay;
     adsrParameters.sustain = sustain;
     adsrParameters.release = release;
-    adsr.setParameters({
-        attack * tolerances.envAttackScale,
-        decay,
-        sustain,
-        release * tolerances.envReleaseScale
-    });
-}
-
-void WaverVoice::setFilterKeyTrack(float amount) noexcept
-{
-    filterKeyTrackAmount = std::clamp(amount, 0.0f, 1.0f);
-}
-
-void WaverVoice::setEnvToFilter(float amount) noexcept
-{
-    envToFilterAmount = std::clamp(amount, -1.0f, 1.0f);
-}
-
-void WaverVoice::setNoiseColor(float color) noexcept
-{
-    noiseColorMix = std::clamp(color, 0.0f, 1.0f);
-}
-
-void WaverVoice::setSubOctave(int octaveChoice) noexcept
-{
-    subOctaveMultiplier = (octaveChoice == 1) ? 0.25f : 0.5f;
-}
-
-void WaverVoice::setPitchBendSemitones(float semitones) noexcept
-{
-    pitchBendSemitones = semitones;
-}
-
-void WaverVoice::setModWheelDepth(float depth01) noexcept
-{
-    modWheelDepth = std::clamp(depth01, 0.0f, 1.0f);
+    applyEnvelopeParameters();
 }
 
-void WaverVoice::setAftertouchCutoffOffset(float offsetHz) noexcept
+void WaverVoice::setUnison(int voiceCount, float detuneCents) noexcept
 {
-    aftertouchCutoffHz = std::max(0.0f, offsetHz);
+    dcoStack.setVoiceCount(voiceCount);
+    dcoStack.setDetuneCents(detuneCents);
 }
 } // namespace threadbare::dsp
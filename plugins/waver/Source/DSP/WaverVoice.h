@@ -9,6 +9,7 @@
 #include "OtaFilter.h"
 #include "OuDrift.h"
 #include "ToyEngine.h"
+#include "UnisonOscillator.h"
 #include "WaverLFO.h"
 
 namespace threadbare::dsp
@@ -25,10 +26,34 @@ struct ComponentTolerances
     void computeFromSeed(std::uint32_t seed) noexcept;
 };
 
+// Settings that are identical for every voice. WaverVoiceAllocator owns one
+// copy and each voice reads it through a pointer, so a change is a single
+// store instead of a fan-out.
+struct WaverVoiceShared
+{
+    float waveBlend = 0.0f;
+    float lfoToPwmDepth = 0.0f;
+    float subLevel = 0.2f;
+    bool useLadderFilter = false;
+    float driftAmount = 0.0f;
+    float age = 0.0f;
+    float lfoToVibratoCents = 0.0f;
+    float filterKeyTrackAmount = 0.0f;
+    float envToFilterAmount = 0.0f;
+    float subOctaveMultiplier = 0.5f;
+    float pitchBendMultiplier = 1.0f;
+    float modWheelDepth = 0.0f;
+    float aftertouchCutoffHz = 0.0f;
+};
+
 class WaverVoice
 {
 public:
-    void prepare(double newSampleRate, int voiceIndex, std::uint32_t driftSeed) noexcept;
+    void prepare(double newSampleRate, int voiceIndex, std::uint32_t driftSeed, ToyEngine& toyBank,
+                 const WaverVoiceShared& sharedSettings) noexcept;
+    // Re-rates a prepared voice without dropping its note. Envelope, phases,
+    // glide, filter state and LFO phase all carry over.
+    void setSampleRate(double newSampleRate) noexcept;
     void reset() noexcept;
 
     void noteOn(int noteNumber, float velocity, bool stolen) noexcept;
@@ -36,28 +61,20 @@ public:
     void releaseFromSustain() noexcept;
     void setPortamento(float glideMs, bool alwaysMode) noexcept;
     void setGlideStartFrequency(float hz) noexcept;
-    void setFilter(float cutoffHz, float resonance, bool ladderMode) noexcept;
-    void setWaveBlend(float blend) noexcept;
-    void setLfoToPwm(float depth) noexcept;
-    void setDriftAmount(float amount) noexcept;
-    void setAge(float age) noexcept;
-    void setSubLevel(float level) noexcept;
-    void setNoiseLevel(float level) noexcept;
+    // Per-voice state only (smoothers, envelope, LFO, unison stack); shared
+    // settings live in WaverVoiceShared.
+    void setFilter(float cutoffHz, float resonance) noexcept;
     void setLfoRate(float hz) noexcept;
     void setLfoShape(int shape) noexcept;
-    void setLfoToVibrato(float cents) noexcept;
-    void setToyParams(float modIndex, float ratioNorm, float feedback) noexcept;
     void setLayerLevels(float dco, float toy) noexcept;
     void setEnvelopeParams(float attack, float decay, float sustain, float release) noexcept;
-    void setFilterKeyTrack(float amount) noexcept;
-    void setEnvToFilter(float amount) noexcept;
-    void setNoiseColor(float color) noexcept;
-    void setSubOctave(int octaveChoice) noexcept;
-    void setPitchBendSemitones(float semitones) noexcept;
-    void setModWheelDepth(float depth01) noexcept;
-    void setAftertouchCutoffOffset(float offsetHz) noexcept;
+    void setUnison(int voiceCount, float detuneCents) noexcept;
 
-    float processSample() noexcept;
+    // Per-sample rendering is split around the shared toy layer: beginSample
+    // feeds this voice's ToyEngine lane, finishSample mixes the lane output.
+    // noiseSample is this voice's noise lane, already colored and levelled.
+    void beginSample(float noiseSample) noexcept;
+    float finishSample(float toyOut) noexcept;
 
     bool isActive() const noexcept { return active; }
     bool isHeld() const noexcept { return held; }
@@ -68,15 +85,26 @@ public:
     float getOuState() const noexcept { return ouDrift.getState(); }
 
 private:
-    static float polyBlep(float t, float dt) noexcept;
-    static float polyBlamp(float t, float dt) noexcept;
     void updateFrequencyFromMidi() noexcept;
+    void updateControlRate() noexcept;
+    // adsrParameters with this voice's attack/release tolerances applied.
+    void applyEnvelopeParameters() noexcept;
+
+    // Per-sample linear ramp toward the latest control-rate value.
+    struct ControlRamp
+    {
+        float value = 0.0f;
+        float step = 0.0f;
+
+        void snap(float target) noexcept { value = target; step = 0.0f; }
+        void setTarget(float target, float intervalInverse) noexcept { step = (target - value) * intervalInverse; }
+        float next() noexcept { value += step; return value; }
+    };
 
     juce::ADSR adsr;
     juce::ADSR::Parameters adsrParameters { 0.01f, 0.2f, 0.7f, 0.4f };
 
     double sampleRate = 44100.0;
-    float phase = 0.0f;
     float subPhase = 0.0f;
     float phaseIncrement = 0.0f;
     float subPhaseIncrement = 0.0f;
@@ -93,47 +121,48 @@ private:
     std::uint32_t retriggerRampRemaining = 0;
     std::uint32_t retriggerRampTotal = 0;
     std::uint64_t ageCounter = 0;
-    std::uint32_t noiseState = 0xA341316Cu;
 
     int midiNote = -1;
     bool active = false;
     bool held = false;
     bool sustained = false;
 
-    float waveBlend = 0.0f;
     float basePulseWidth = 0.5f;
-    float lfoToPwmDepth = 0.0f;
-    float subLevel = 0.2f;
-    float noiseLevel = 0.1f;
-    bool useLadderFilter = false;
     float dcBlockerR = 0.995f;
     float dcX1 = 0.0f;
     float dcY1 = 0.0f;
     float retriggerStartSample = 0.0f;
     float lastOutputSample = 0.0f;
 
-    float driftAmount = 0.0f;
-    float ageParam = 0.0f;
-    float lfoToVibratoCents = 0.0f;
-    float filterKeyTrackAmount = 0.0f;
-    float envToFilterAmount = 0.0f;
-    float noiseColorMix = 0.0f;
-    float subOctaveMultiplier = 0.5f;
-    float pitchBendSemitones = 0.0f;
-    float modWheelDepth = 0.0f;
-    float aftertouchCutoffHz = 0.0f;
-    float pinkB0 = 0.0f, pinkB1 = 0.0f, pinkB2 = 0.0f;
+    int controlInterval = 1;
+    float controlIntervalInverse = 1.0f;
+    int controlCountdown = 0;
+    bool controlPrimed = false;
+    ControlRamp driftRamp;
+    ControlRamp driftPitchRamp;
+    ControlRamp pitchModRamp;
+    ControlRamp pulseWidthRamp;
+
+    // Carried from beginSample to finishSample.
+    float pendingDrift = 0.0f;
+    float pendingEnvelope = 0.0f;
+    float pendingDco = 0.0f;
+    float pendingSub = 0.0f;
+
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> layerDcoLevel;
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> layerToyLevel;
 
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Multiplicative> filterCutoffSmoothed;
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> filterResSmoothed;
 
+    UnisonOscillator dcoStack;
     OtaFilter otaFilter;
     MoogLadder moogLadder;
     WaverLFO lfo;
     OuDrift ouDrift;
-    ToyEngine toyEngine;
+    ToyEngine* toyEngine = nullptr;
+    const WaverVoiceShared* shared = nullptr;
+    int toyLane = 0;
     ComponentTolerances tolerances;
 };
 } // namespace threadbare::dsp
@@ -8,17 +8,40 @@ namespace threadbare::dsp
 {
 void WaverVoiceAllocator::prepare(double sampleRate, std::uint32_t driftSeed) noexcept
 {
+    toyEngine.prepare(sampleRate);
+    noise.prepare(driftSeed ^ 0xA341316Cu);
     for (int i = 0; i < static_cast<int>(kVoiceCount); ++i)
     {
-        voices[static_cast<std::size_t>(i)].prepare(sampleRate, i, driftSeed);
+        voices[static_cast<std::size_t>(i)].prepare(sampleRate, i, driftSeed, toyEngine, shared);
         voices[static_cast<std::size_t>(i)].setPortamento(glideMs, glideAlwaysMode);
     }
+    invalidateAppliedSettings();
+}
+
+void WaverVoiceAllocator::invalidateAppliedSettings() noexcept
+{
+    applied = {};
+}
+
+void WaverVoiceAllocator::setSampleRate(double sampleRate) noexcept
+{
+    for (auto& voice : voices)
+    {
+        voice.setSampleRate(sampleRate);
+        voice.setPortamento(glideMs, glideAlwaysMode);
+    }
 }
 
 void WaverVoiceAllocator::reset() noexcept
 {
     for (auto& voice : voices)
+    {
         voice.reset();
+        voice.setPortamento(glideMs, glideAlwaysMode);
+    }
+    toyEngine.reset();
+    noise.reset();
+    invalidateAppliedSettings();
 }
 
 void WaverVoiceAllocator::noteOn(int noteNumber, float velocity) noexcept
@@ -46,6 +69,7 @@ void WaverVoiceAllocator::noteOn(int noteNumber, float velocity) noexcept
 
     if (auto* stolenVoice = chooseVoiceToSteal())
     {
+        ++stealCount;
         if (shouldGlide)
             stolenVoice->setGlideStartFrequency(lastTriggerHz);
         stolenVoice->noteOn(noteNumber, velocity, true);
@@ -88,7 +112,11 @@ void WaverVoiceAllocator::setSustainPedal(bool isDown) noexcept
 
 void WaverVoiceAllocator::setPortamento(float newGlideMs, bool alwaysMode) noexcept
 {
-    glideMs = std::clamp(newGlideMs, 0.0f, 2000.0f);
+    const float clampedMs = std::clamp(newGlideMs, 0.0f, 2000.0f);
+    if (clampedMs == glideMs && alwaysMode == glideAlwaysMode)
+        return;
+
+    glideMs = clampedMs;
     glideAlwaysMode = alwaysMode;
     for (auto& voice : voices)
         voice.setPortamento(glideMs, glideAlwaysMode);
@@ -96,117 +124,159 @@ void WaverVoiceAllocator::setPortamento(float newGlideMs, bool alwaysMode) noexc
 
 void WaverVoiceAllocator::setFilter(float cutoffHz, float resonance, bool ladderMode) noexcept
 {
+    shared.useLadderFilter = ladderMode;
+    if (!updateApplied(applied.filter, FilterSettings { cutoffHz, resonance }))
+        return;
+
     for (auto& voice : voices)
-        voice.setFilter(cutoffHz, resonance, ladderMode);
+        voice.setFilter(cutoffHz, resonance);
 }
 
 void WaverVoiceAllocator::setWaveBlend(float blend) noexcept
 {
-    for (auto& voice : voices)
-        voice.setWaveBlend(blend);
+    shared.waveBlend = std::clamp(blend, 0.0f, 1.0f);
 }
 
 void WaverVoiceAllocator::setLfoToPwm(float depth) noexcept
 {
-    for (auto& voice : voices)
-        voice.setLfoToPwm(depth);
+    shared.lfoToPwmDepth = std::clamp(depth, 0.0f, 1.0f);
 }
 
 void WaverVoiceAllocator::setDriftAmount(float amount) noexcept
 {
-    for (auto& voice : voices)
-        voice.setDriftAmount(amount);
+    shared.driftAmount = std::clamp(amount, 0.0f, 1.0f);
 }
 
 void WaverVoiceAllocator::setAge(float age) noexcept
 {
-    for (auto& voice : voices)
-        voice.setAge(age);
+    shared.age = std::clamp(age, 0.0f, 1.0f);
+    if (updateApplied(applied.age, shared.age))
+        toyEngine.setEnvelopeStepping(shared.age * 0.8f);
 }
 
 void WaverVoiceAllocator::setSubLevel(float level) noexcept
 {
-    for (auto& voice : voices)
-        voice.setSubLevel(level);
+    shared.subLevel = std::clamp(level, 0.0f, 1.0f);
 }
 
 void WaverVoiceAllocator::setNoiseLevel(float level) noexcept
 {
-    for (auto& voice : voices)
-        voice.setNoiseLevel(level);
+    noiseLevel = std::clamp(level, 0.0f, 1.0f);
 }
 
 void WaverVoiceAllocator::setLfoRate(float hz) noexcept
 {
+    if (!updateApplied(applied.lfoRate, hz))
+        return;
+
     for (auto& voice : voices)
         voice.setLfoRate(hz);
 }
 
 void WaverVoiceAllocator::setLfoShape(int shape) noexcept
 {
+    if (!updateApplied(applied.lfoShape, shape))
+        return;
+
     for (auto& voice : voices)
         voice.setLfoShape(shape);
 }
 
 void WaverVoiceAllocator::setLfoToVibrato(float cents) noexcept
 {
-    for (auto& voice : voices)
-        voice.setLfoToVibrato(cents);
+    shared.lfoToVibratoCents = std::clamp(cents, 0.0f, 50.0f);
 }
 
 void WaverVoiceAllocator::setToyParams(float modIndex, float ratioNorm, float feedback) noexcept
 {
-    for (auto& voice : voices)
-        voice.setToyParams(modIndex, ratioNorm, feedback);
+    if (!updateApplied(applied.toy, ToySettings { modIndex, ratioNorm, feedback }))
+        return;
+
+    toyEngine.setModIndex(modIndex * 4.0f);
+    toyEngine.setRatioNorm(ratioNorm);
+    toyEngine.setFeedback(feedback);
 }
 
 void WaverVoiceAllocator::setLayerLevels(float dco, float toy) noexcept
 {
+    if (!updateApplied(applied.layers, LayerSettings { dco, toy }))
+        return;
+
     for (auto& voice : voices)
         voice.setLayerLevels(dco, toy);
 }
 
 void WaverVoiceAllocator::setEnvelopeParams(float attack, float decay, float sustain, float release) noexcept
 {
+    if (!updateApplied(applied.envelope, EnvelopeSettings { attack, decay, sustain, release }))
+        return;
+
     for (auto& voice : voices)
         voice.setEnvelopeParams(attack, decay, sustain, release);
 }
 
 void WaverVoiceAllocator::setFilterKeyTrack(float amount) noexcept
 {
-    for (auto& voice : voices)
-        voice.setFilterKeyTrack(amount);
+    shared.filterKeyTrackAmount = std::clamp(amount, 0.0f, 1.0f);
 }
 
 void WaverVoiceAllocator::setEnvToFilter(float amount) noexcept
 {
-    for (auto& voice : voices)
-        voice.setEnvToFilter(amount);
+    shared.envToFilterAmount = std::clamp(amount, -1.0f, 1.0f);
 }
 
 void WaverVoiceAllocator::setNoiseColor(float color) noexcept
 {
-    for (auto& voice : voices)
-        voice.setNoiseColor(color);
+    noiseColor = std::clamp(color, 0.0f, 1.0f);
 }
 
 void WaverVoiceAllocator::setSubOctave(int octaveChoice) noexcept
 {
-    for (auto& voice : voices)
-        voice.setSubOctave(octaveChoice);
+    shared.subOctaveMultiplier = (octaveChoice == 1) ? 0.25f : 0.5f;
 }
 
 void WaverVoiceAllocator::render(std::span<float> left, std::span<float> right) noexcept
 {
+    using threadbare::core::NoiseLanes;
+
     const auto sampleCount = left.size();
-    for (std::size_t i = 0; i < sampleCount; ++i)
+    const bool noiseOn = noiseLevel > 0.0f;
+    const bool withPink = noiseColor > 0.0f;
+
+    for (std::size_t start = 0; start < sampleCount; start += NoiseLanes::kBlockSize)
     {
-        float mixed = 0.0f;
-        for (auto& voice : voices)
-            mixed += voice.processSample();
+        const int chunk = static_cast<int>(std::min<std::size_t>(NoiseLanes::kBlockSize, sampleCount - start));
+
+        // One noise block for all voices; nothing is generated at zero level.
+        if (noiseOn)
+            noise.generate(chunk, withPink);
 
-        left[i] = mixed;
-        right[i] = mixed;
+        for (int n = 0; n < chunk; ++n)
+        {
+            for (std::size_t v = 0; v < kVoiceCount; ++v)
+            {
+                float noiseSample = 0.0f;
+                if (noiseOn)
+                {
+                    const int lane = static_cast<int>(v);
+                    const float white = noise.getWhite(n, lane);
+                    const float colored = withPink ? white + noiseColor * (noise.getPink(n, lane) - white) : white;
+                    noiseSample = colored * noiseLevel;
+                }
+                voices[v].beginSample(noiseSample);
+            }
+
+            // The toy layer renders all voices in one lane-parallel pass.
+            toyEngine.process();
+
+            float mixed = 0.0f;
+            for (std::size_t v = 0; v < kVoiceCount; ++v)
+                mixed += voices[v].finishSample(toyEngine.getLaneOutput(static_cast<int>(v)));
+
+            const auto i = start + static_cast<std::size_t>(n);
+            left[i] = mixed;
+            right[i] = mixed;
+        }
     }
 }
 
@@ -254,6 +324,17 @@ WaverVoice* WaverVoiceAllocator::chooseVoiceToSteal() noexcept
     return best;
 }
 
+int WaverVoiceAllocator::countActiveVoices() const noexcept
+{
+    int active = 0;
+    for (const auto& voice : voices)
+    {
+        if (voice.isActive())
+            ++active;
+    }
+    return active;
+}
+
 int WaverVoiceAllocator::countHeldVoices() const noexcept
 {
     int held = 0;
@@ -267,20 +348,26 @@ int WaverVoiceAllocator::countHeldVoices() const noexcept
 
 void WaverVoiceAllocator::setPitchBendSemitones(float semitones) noexcept
 {
-    for (auto& voice : voices)
-        voice.setPitchBendSemitones(semitones);
+    shared.pitchBendMultiplier = std::pow(2.0f, semitones / 12.0f);
 }
 
 void WaverVoiceAllocator::setModWheelDepth(float depth01) noexcept
 {
-    for (auto& voice : voices)
-        voice.setModWheelDepth(depth01);
+    shared.modWheelDepth = std::clamp(depth01, 0.0f, 1.0f);
 }
 
 void WaverVoiceAllocator::setAftertouchCutoffOffset(float offsetHz) noexcept
 {
+    shared.aftertouchCutoffHz = std::max(0.0f, offsetHz);
+}
+
+void WaverVoiceAllocator::setUnison(int voiceCount, float detuneCents) noexcept
+{
+    if (!updateApplied(applied.unison, UnisonSettings { voiceCount, detuneCents }))
+        return;
+
     for (auto& voice : voices)
-        voice.setAftertouchCutoffOffset(offsetHz);
+        voice.setUnison(voiceCount, detuneCents);
 }
 
 float WaverVoiceAllocator::midiNoteToHz(int noteNumber) noexcept
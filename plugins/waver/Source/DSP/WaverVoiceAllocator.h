@@ -1,9 +1,11 @@
 #pragma once
 
+#include "NoiseSource.h"
 #include "WaverVoice.h"
 
 #include <array>
 #include <cstdint>
+#include <optional>
 #include <span>
 
 namespace threadbare::dsp
@@ -12,8 +14,12 @@ class WaverVoiceAllocator
 {
 public:
     static constexpr std::size_t kVoiceCount = 8;
+    static_assert(kVoiceCount <= static_cast<std::size_t>(ToyEngine::kLanes), "each voice needs a toy lane");
+    static_assert(kVoiceCount <= static_cast<std::size_t>(threadbare::core::NoiseLanes::kLanes), "each voice needs a noise lane");
 
     void prepare(double sampleRate, std::uint32_t driftSeed) noexcept;
+    // Moves sounding voices to a new rate without releasing them.
+    void setSampleRate(double sampleRate) noexcept;
     void reset() noexcept;
 
     void noteOn(int noteNumber, float velocity) noexcept;
@@ -41,10 +47,17 @@ public:
     void setPitchBendSemitones(float semitones) noexcept;
     void setModWheelDepth(float depth01) noexcept;
     void setAftertouchCutoffOffset(float offsetHz) noexcept;
+    void setUnison(int voiceCount, float detuneCents) noexcept;
 
     void render(std::span<float> left, std::span<float> right) noexcept;
 
+    // Setters are called every block with the current parameter values; each
+    // compares against what it last applied and returns early when unchanged.
+
     std::array<WaverVoice, kVoiceCount>& getVoices() noexcept { return voices; }
+    int countActiveVoices() const noexcept;
+    // Running count of note-ons that took a sounding voice (wraps).
+    std::uint32_t getStealCount() const noexcept { return stealCount; }
 
 private:
     WaverVoice* findFreeVoice() noexcept;
@@ -52,11 +65,81 @@ private:
     WaverVoice* chooseVoiceToSteal() noexcept;
     int countHeldVoices() const noexcept;
     static float midiNoteToHz(int noteNumber) noexcept;
+    // Forgets the last applied per-voice settings, e.g. after prepare reset them.
+    void invalidateAppliedSettings() noexcept;
+
+    template <typename T>
+    static bool updateApplied(std::optional<T>& applied, const T& value) noexcept
+    {
+        if (applied == value)
+            return false;
+        applied = value;
+        return true;
+    }
+
+    struct FilterSettings
+    {
+        float cutoffHz = 0.0f;
+        float resonance = 0.0f;
+        bool operator==(const FilterSettings&) const = default;
+    };
+
+    struct LayerSettings
+    {
+        float dco = 0.0f;
+        float toy = 0.0f;
+        bool operator==(const LayerSettings&) const = default;
+    };
+
+    struct EnvelopeSettings
+    {
+        float attack = 0.0f;
+        float decay = 0.0f;
+        float sustain = 0.0f;
+        float release = 0.0f;
+        bool operator==(const EnvelopeSettings&) const = default;
+    };
+
+    struct ToySettings
+    {
+        float modIndex = 0.0f;
+        float ratioNorm = 0.0f;
+        float feedback = 0.0f;
+        bool operator==(const ToySettings&) const = default;
+    };
+
+    struct UnisonSettings
+    {
+        int voiceCount = 1;
+        float detuneCents = 0.0f;
+        bool operator==(const UnisonSettings&) const = default;
+    };
+
+    // Last values pushed into the voices (or the toy bank); empty until the
+    // first call after prepare.
+    struct AppliedSettings
+    {
+        std::optional<FilterSettings> filter;
+        std::optional<LayerSettings> layers;
+        std::optional<EnvelopeSettings> envelope;
+        std::optional<ToySettings> toy;
+        std::optional<UnisonSettings> unison;
+        std::optional<float> lfoRate;
+        std::optional<int> lfoShape;
+        std::optional<float> age;
+    };
 
     std::array<WaverVoice, kVoiceCount> voices;
+    WaverVoiceShared shared;
+    AppliedSettings applied;
+    ToyEngine toyEngine;
+    threadbare::core::NoiseLanes noise;
+    float noiseLevel = 0.1f;
+    float noiseColor = 0.0f;
     bool sustainPedalDown = false;
     float glideMs = 0.0f;
     bool glideAlwaysMode = false;
     float lastTriggerHz = 0.0f;
+    std::uint32_t stealCount = 0;
 };
 } // namespace threadbare::dsp
@@ -22,25 +22,19 @@ void WowFlutter::prepare(double sr, std::size_t /*maxBlockSize*/) noexcept
     flutterPhase = 0.0f;
     noiseLpZ = 0.0f;
 
+    // One-pole LP at ~3Hz for slow noise.
+    noiseLpCoeff = 1.0f - std::exp(-2.0f * std::numbers::pi_v<float> * 3.0f / static_cast<float>(sampleRate));
+
     transitionDelayTarget = 0.0f;
     transitionDelayCurrent = 0.0f;
     constexpr float smoothHz = 8.0f;
     transitionDelayCoeff = 1.0f - std::exp(-2.0f * std::numbers::pi_v<float> * smoothHz
                                            / static_cast<float>(sampleRate));
 
-    constexpr float xoverCutoff = 100.0f;
-    const float srF = static_cast<float>(sampleRate);
-    const float w0 = 2.0f * std::numbers::pi_v<float> * xoverCutoff / srF;
-    const float cosW0 = std::cos(w0);
-    const float sinW0 = std::sin(w0);
-    const float alpha = sinW0 / std::sqrt(2.0f); // Q = 1/sqrt(2) for Butterworth
-    const float a0 = 1.0f + alpha;
-    const float lpB0 = ((1.0f - cosW0) * 0.5f) / a0;
-    const float lpB1 = (1.0f - cosW0) / a0;
-    const float lpA1 = (-2.0f * cosW0) / a0;
-    const float lpA2 = (1.0f - alpha) / a0;
-    xoverL = { lpB0, lpB1, lpB0, lpA1, lpA2, 0.0f, 0.0f };
-    xoverR = { lpB0, lpB1, lpB0, lpA1, lpA2, 0.0f, 0.0f };
+    constexpr double xoverCutoff = 100.0;
+    crossoverLp.setSection(0, threadbare::core::BiquadCoefficients::lowpass(sampleRate, xoverCutoff,
+                                                                          std::numbers::sqrt2 * 0.5)); // Butterworth
+    crossoverLp.reset();
 }
 
 void WowFlutter::reset() noexcept
@@ -53,8 +47,7 @@ void WowFlutter::reset() noexcept
     noiseLpZ = 0.0f;
     transitionDelayTarget = 0.0f;
     transitionDelayCurrent = 0.0f;
-    xoverL.s1 = xoverL.s2 = 0.0f;
-    xoverR.s1 = xoverR.s2 = 0.0f;
+    crossoverLp.reset();
 }
 
 void WowFlutter::setWowDepth(float depth01) noexcept
@@ -78,6 +71,17 @@ void WowFlutter::setTransitionDelay(float delayMs) noexcept
 }
 
 void WowFlutter::process(float* left, float* right, int numSamples) noexcept
+{
+    for (int i = 0; i < numSamples; ++i)
+    {
+        StereoFrame frame { left[i], right[i] };
+        processSample(frame);
+        left[i] = frame[0];
+        right[i] = frame[1];
+    }
+}
+
+void WowFlutter::processSample(StereoFrame& frame) noexcept
 {
     if (delaySize < 4)
         return;
@@ -86,52 +90,46 @@ void WowFlutter::process(float* left, float* right, int numSamples) noexcept
     const float srF = static_cast<float>(sampleRate);
     const float stochasticScale = 0.3f + ageParam * 0.7f;
 
-    for (int i = 0; i < numSamples; ++i)
-    {
-        const float inL = left[i];
-        const float inR = right[i];
+    const float inL = frame[0];
+    const float inR = frame[1];
 
-        // Extract sub-bass via 2nd-order Butterworth LP (transposed-direct-form II).
-        const float subL = xoverL.b0 * inL + xoverL.s1;
-        xoverL.s1 = xoverL.b1 * inL - xoverL.a1 * subL + xoverL.s2;
-        xoverL.s2 = xoverL.b2 * inL - xoverL.a2 * subL;
+    // Extract sub-bass via 2nd-order Butterworth LP, both lanes at once.
+    StereoFrame sub = frame;
+    crossoverLp.processFrame(sub);
+    const float subL = sub[0];
+    const float subR = sub[1];
 
-        const float subR = xoverR.b0 * inR + xoverR.s1;
-        xoverR.s1 = xoverR.b1 * inR - xoverR.a1 * subR + xoverR.s2;
-        xoverR.s2 = xoverR.b2 * inR - xoverR.a2 * subR;
+    // Only the upper band enters the modulated delay.
+    delayL[static_cast<std::size_t>(writePos)] = inL - subL;
+    delayR[static_cast<std::size_t>(writePos)] = inR - subR;
 
-        // Only the upper band enters the modulated delay.
-        delayL[static_cast<std::size_t>(writePos)] = inL - subL;
-        delayR[static_cast<std::size_t>(writePos)] = inR - subR;
+    const float noise = nextNoise() * stochasticScale;
 
-        const float noise = nextNoise() * stochasticScale;
+    const float wowMod = std::sin(twoPi * wowPhase) + noise * 0.3f;
+    const float flutterMod = std::sin(twoPi * flutterPhase) + noise * 0.15f;
 
-        const float wowMod = std::sin(twoPi * wowPhase) + noise * 0.3f;
-        const float flutterMod = std::sin(twoPi * flutterPhase) + noise * 0.15f;
+    transitionDelayCurrent += transitionDelayCoeff * (transitionDelayTarget - transitionDelayCurrent);
 
-        transitionDelayCurrent += transitionDelayCoeff * (transitionDelayTarget - transitionDelayCurrent);
+    const float baseDelayMs = wowDepthMs * 1.35f + flutterDepthMs * 1.25f + transitionDelayCurrent;
+    const float totalDelayMs = baseDelayMs + wowDepthMs * wowMod + flutterDepthMs * flutterMod;
+    const float delaySamples = std::max(1.0f, totalDelayMs * 0.001f * srF);
 
-        const float baseDelayMs = wowDepthMs * 1.35f + flutterDepthMs * 1.25f + transitionDelayCurrent;
-        const float totalDelayMs = baseDelayMs + wowDepthMs * wowMod + flutterDepthMs * flutterMod;
-        const float delaySamples = std::max(1.0f, totalDelayMs * 0.001f * srF);
+    const int intDelay = static_cast<int>(delaySamples);
+    const float frac = delaySamples - static_cast<float>(intDelay);
+    const int readPos = ((writePos - intDelay - 1) + delaySize * 4) % delaySize;
 
-        const int intDelay = static_cast<int>(delaySamples);
-        const float frac = delaySamples - static_cast<float>(intDelay);
-        const int readPos = ((writePos - intDelay - 1) + delaySize * 4) % delaySize;
+    // Recombine: clean sub-bass + modulated upper band.
+    frame[0] = subL + cubicHermite(delayL.data(), delaySize, frac, readPos);
+    frame[1] = subR + cubicHermite(delayR.data(), delaySize, frac, readPos);
 
-        // Recombine: clean sub-bass + modulated upper band.
-        left[i] = subL + cubicHermite(delayL.data(), delaySize, frac, readPos);
-        right[i] = subR + cubicHermite(delayR.data(), delaySize, frac, readPos);
+    wowPhase += wowInc;
+    if (wowPhase >= 1.0f)
+        wowPhase -= 1.0f;
+    flutterPhase += flutterInc;
+    if (flutterPhase >= 1.0f)
+        flutterPhase -= 1.0f;
 
-        wowPhase += wowInc;
-        if (wowPhase >= 1.0f)
-            wowPhase -= 1.0f;
-        flutterPhase += flutterInc;
-        if (flutterPhase >= 1.0f)
-            flutterPhase -= 1.0f;
-
-        writePos = (writePos + 1) % delaySize;
-    }
+    writePos = (writePos + 1) % delaySize;
 }
 
 float WowFlutter::cubicHermite(const float* buf, int size, float frac, int index) const noexcept
@@ -155,11 +153,8 @@ float WowFlutter::cubicHermite(const float* buf, int size, float frac, int index
 
 float WowFlutter::nextNoise() noexcept
 {
-    rngState = rngState * 1664525u + 1013904223u;
-    const float raw = (static_cast<float>((rngState >> 8) & 0xFFFFu) / 65535.0f) * 2.0f - 1.0f;
-    // One-pole LP at ~3Hz for slow noise.
-    const float coeff = 1.0f - std::exp(-2.0f * std::numbers::pi_v<float> * 3.0f / static_cast<float>(sampleRate));
-    noiseLpZ += coeff * (raw - noiseLpZ);
+    const float raw = rng.nextBipolar();
+    noiseLpZ += noiseLpCoeff * (raw - noiseLpZ);
     return noiseLpZ;
 }
 
@@ -4,6 +4,10 @@
 #include <cstdint>
 #include <vector>
 
+#include "FastMath.h"
+#include "BiquadCascade.h"
+#include "NoiseSource.h"
+
 namespace threadbare::dsp
 {
 
@@ -18,6 +22,7 @@ public:
     void setAge(float age) noexcept;
     void setTransitionDelay(float delayMs) noexcept;
     void process(float* left, float* right, int numSamples) noexcept;
+    void processSample(StereoFrame& frame) noexcept;
 
 private:
     float cubicHermite(const float* buf, int size, float frac, int index) const noexcept;
@@ -42,8 +47,9 @@ private:
     int writePos = 0;
     int delaySize = 0;
 
-    std::uint32_t rngState = 0x12345678u;
+    threadbare::core::NoiseGenerator rng { 0x12345678u };
     float noiseLpZ = 0.0f;
+    float noiseLpCoeff = 0.0f;
 
     float transitionDelayTarget = 0.0f;
     float transitionDelayCurrent = 0.0f;
@@ -51,13 +57,7 @@ private:
 
     // Sub-bass crossover (2nd-order Butterworth LP at 100 Hz).
     // Sub-bass bypasses the modulated delay to prevent audible pitch wobble.
-    struct CrossoverLp
-    {
-        float b0 = 0.0f, b1 = 0.0f, b2 = 0.0f;
-        float a1 = 0.0f, a2 = 0.0f;
-        float s1 = 0.0f, s2 = 0.0f;
-    };
-    CrossoverLp xoverL, xoverR;
+    threadbare::core::BiquadCascade<2, 1> crossoverLp;
 };
 
 } // namespace threadbare::dsp
@@ -1,5 +1,18 @@
 #include "WaverProcessor.h"
-#include "../UI/WaverEditor.h"
+#include "../WaverFactoryPresets.h"
+#if ! THREADBARE_HEADLESS
+ #include "../UI/WaverEditor.h"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <string_view>
+
+namespace
+{
+// Child of the saved state holding the morph as played.
+const juce::Identifier kMorphStateType { "MORPH" };
+} // namespace
 
 WaverProcessor::WaverProcessor()
     : ProcessorBase(
@@ -11,6 +24,27 @@ WaverProcessor::WaverProcessor()
     determinismState.globalSeed = static_cast<std::uint64_t>(rng.nextInt64());
     if (determinismState.globalSeed == 0)
         determinismState.globalSeed = 0xDEADBEEF42u;
+    momentSeed = static_cast<std::uint32_t>(determinismState.globalSeed & 0xFFFFFFFFu);
+    morphHeard.seed.store(momentSeed, std::memory_order_relaxed);
+
+    morphSlotForParam.fill(-1);
+    for (std::size_t slot = 0; slot < RbfMorph::kNumParams; ++slot)
+    {
+        const auto& ids = threadbare::waver::WaverGeneratedParams::kIdsByIndex;
+        const auto found = std::find_if(ids.begin(), ids.end(), [slot](const char* id) {
+            return std::string_view(id) == RbfMorph::Surfaces::kParamIds[slot];
+        });
+        jassert(found != ids.end());
+        const auto index = static_cast<std::size_t>(std::distance(ids.begin(), found));
+        morphParamIndex[slot] = static_cast<ParamIndex>(index);
+        morphSlotForParam[index] = static_cast<int>(slot);
+    }
+
+    engine.setTrace(&trace);
+   #if ! THREADBARE_HEADLESS
+    engine.setWorkSignal(&backgroundWorker->getSignal());
+    backgroundWorker->add(*this);
+   #endif
 
     initialiseFactoryPresets();
     if (!factoryPresets.empty())
@@ -23,6 +57,13 @@ WaverProcessor::WaverProcessor()
     }
 }
 
+WaverProcessor::~WaverProcessor()
+{
+   #if ! THREADBARE_HEADLESS
+    backgroundWorker->remove(*this);
+   #endif
+}
+
 void WaverProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
     rateDependent = threadbare::tuning::waver::recalculate(sampleRate);
@@ -34,52 +75,67 @@ void WaverProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
         preparedBlockSize,
         preparedChannels
     };
-    configureOversampling(qualityMode);
-    if (oversampling != nullptr)
-    {
-        const auto osFactor = static_cast<double>(oversampling->getOversamplingFactor());
-        spec.sampleRate = rateDependent.sampleRate * osFactor;
-        spec.maximumBlockSize = static_cast<juce::uint32>(preparedBlockSize * oversampling->getOversamplingFactor());
-    }
-    engine.prepare(spec, static_cast<std::uint32_t>(determinismState.globalSeed & 0xFFFFFFFFu));
+    // Hosts prepare before a bounce, so offline renders start on the HQ chain.
+    qualityMode = targetQualityMode();
+    engine.prepare(spec, static_cast<std::uint32_t>(determinismState.globalSeed & 0xFFFFFFFFu),
+                   oversamplingStagesFor(qualityMode));
     outputGainSmoothed.reset(rateDependent.sampleRate, 0.02);
     outputGainSmoothed.setCurrentAndTargetValue(
-        juce::Decibels::decibelsToGain(apvts.getRawParameterValue("outputGain")->load()));
-    applyQualityMode(qualityMode);
-    lastQualityModeParam = static_cast<int>(qualityMode);
+        juce::Decibels::decibelsToGain(paramValue(ParamIndex::outputGain)));
+    setLatencySamples(engine.getLatencySamples());
     transitionFade.reset(rateDependent.sampleRate, 0.30);
     transitionFade.setCurrentAndTargetValue(1.0f);
     transitionPhase = TransitionPhase::idle;
-    arpLatchGain.reset(rateDependent.sampleRate, 0.05);
-    arpLatchGain.setCurrentAndTargetValue(1.0f);
+    arpLatchDip.reset(rateDependent.sampleRate, 0.075);
+    arpLatchDip.setCurrentAndTargetValue(1.0f);
+    arpLatchRecover.reset(rateDependent.sampleRate, 0.22);
+    arpLatchRecover.setCurrentAndTargetValue(1.0f);
     arpLatchPhase = ArpLatchPhase::idle;
     pendingPresetIndex.store(-1, std::memory_order_relaxed);
+    prepareMorph();
     stateQueue.reset();
     uiEventQueue.reset();
 }
 
 void WaverProcessor::releaseResources() {}
 
+void WaverProcessor::setTransitionPhase(TransitionPhase next) noexcept
+{
+    if (next == transitionPhase)
+        return;
+
+    // One trace span per phase, so a preset switch reads as fadeOut -> fadeIn.
+    const auto spanName = [](TransitionPhase phase) {
+        return phase == TransitionPhase::fadeOut ? "transition.fadeOut" : "transition.fadeIn";
+    };
+    if (transitionPhase != TransitionPhase::idle)
+        trace.endSpan(spanName(transitionPhase));
+    if (next != TransitionPhase::idle)
+        trace.beginSpan(spanName(next));
+    transitionPhase = next;
+}
+
 void WaverProcessor::reset()
 {
     engine.reset();
     outputGainSmoothed.setCurrentAndTargetValue(
-        juce::Decibels::decibelsToGain(apvts.getRawParameterValue("outputGain")->load()));
+        juce::Decibels::decibelsToGain(paramValue(ParamIndex::outputGain)));
     transitionFade.setCurrentAndTargetValue(1.0f);
     transitionPhase = TransitionPhase::idle;
-    arpLatchGain.setCurrentAndTargetValue(1.0f);
+    arpLatchDip.setCurrentAndTargetValue(1.0f);
+    arpLatchRecover.setCurrentAndTargetValue(1.0f);
     arpLatchPhase = ArpLatchPhase::idle;
     stateQueue.reset();
     uiEventQueue.reset();
 }
 
-void WaverProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+void WaverProcessor::processAudio(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
     drainUiEvents();
 
-    const float apvtsPuckX = apvts.getRawParameterValue("puckX")->load();
-    const float apvtsPuckY = apvts.getRawParameterValue("puckY")->load();
+    const float apvtsPuckX = params.puckX();
+    const float apvtsPuckY = params.puckY();
     latestState.puckX = apvtsPuckX;
     latestState.puckY = apvtsPuckY;
     latestState.mix = morphBlend.load(std::memory_order_relaxed);
@@ -88,36 +144,40 @@ void WaverProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBu
     auto* left = buffer.getWritePointer(0);
     auto* right = buffer.getNumChannels() > 1 ? buffer.getWritePointer(1) : left;
 
-    const float portaTimeMs = apvts.getRawParameterValue("portaTime")->load();
-    const int portaMode = static_cast<int>(apvts.getRawParameterValue("portaMode")->load());
-    const int chorusMode = static_cast<int>(apvts.getRawParameterValue("chorusMode")->load());
-    const float filterCutoff = apvts.getRawParameterValue("filterCutoff")->load();
-    const float filterRes = apvts.getRawParameterValue("filterRes")->load();
-    const int filterMode = static_cast<int>(apvts.getRawParameterValue("filterMode")->load());
-    const float outputGainDb = apvts.getRawParameterValue("outputGain")->load();
-    const int qualityModeParam = static_cast<int>(apvts.getRawParameterValue("qualityMode")->load());
-    const float macroShape = apvts.getRawParameterValue("macroShape")->load();
-    const float lfoToPwm = apvts.getRawParameterValue("lfoToPwm")->load();
-    const float driftAmt = apvts.getRawParameterValue("driftAmount")->load();
+    updateMorph(apvtsPuckX, apvtsPuckY, prevArpOn, numSamples);
+    latestState.morph.values = morphResult.values;
+    latestState.morph.present = morphOwned;
+
+    const float portaTimeMs = paramValue(ParamIndex::portaTime);
+    const int portaMode = static_cast<int>(paramValue(ParamIndex::portaMode));
+    const int chorusMode = static_cast<int>(paramValue(ParamIndex::chorusMode));
+    const float filterCutoff = paramValue(ParamIndex::filterCutoff);
+    const float filterRes = paramValue(ParamIndex::filterRes);
+    const int filterMode = static_cast<int>(paramValue(ParamIndex::filterMode));
+    const float outputGainDb = paramValue(ParamIndex::outputGain);
+    const float macroShape = paramValue(ParamIndex::macroShape);
+    const float lfoToPwm = paramValue(ParamIndex::lfoToPwm);
+    const float driftAmt = paramValue(ParamIndex::driftAmount);
     const float puckY = apvtsPuckY;
-    const float dcoSubLvl = apvts.getRawParameterValue("dcoSubLevel")->load();
-    const float noiseLvl = apvts.getRawParameterValue("noiseLevel")->load();
-    const float lfoRateHz = apvts.getRawParameterValue("lfoRate")->load();
-    const int lfoShapeIdx = static_cast<int>(apvts.getRawParameterValue("lfoShape")->load());
-    const float lfoVibrato = apvts.getRawParameterValue("lfoToVibrato")->load();
-    const float toyIdx = apvts.getRawParameterValue("toyIndex")->load();
-    const float toyRat = apvts.getRawParameterValue("toyRatio")->load();
-    const float layDco = apvts.getRawParameterValue("layerDco")->load();
-    const float layToy = apvts.getRawParameterValue("layerToy")->load();
-    const float envA = apvts.getRawParameterValue("envAttack")->load();
-    const float envD = apvts.getRawParameterValue("envDecay")->load();
-    const float envS = apvts.getRawParameterValue("envSustain")->load();
-    const float envR = apvts.getRawParameterValue("envRelease")->load();
+    const float dcoSubLvl = paramValue(ParamIndex::dcoSubLevel);
+    const float noiseLvl = paramValue(ParamIndex::noiseLevel);
+    const float lfoRateHz = paramValue(ParamIndex::lfoRate);
+    const int lfoShapeIdx = params.lfoShape();
+    const float lfoVibrato = paramValue(ParamIndex::lfoToVibrato);
+    const float toyIdx = paramValue(ParamIndex::toyIndex);
+    const float toyRat = paramValue(ParamIndex::toyRatio);
+    const float layDco = paramValue(ParamIndex::layerDco);
+    const float layToy = paramValue(ParamIndex::layerToy);
+    const float envA = paramValue(ParamIndex::envAttack);
+    const float envD = paramValue(ParamIndex::envDecay);
+    const float envS = paramValue(ParamIndex::envSustain);
+    const float envR = paramValue(ParamIndex::envRelease);
 
     const float ageNorm = (puckY + 1.0f) * 0.5f;
     bool isPlaying = false;
     bool isRecording = false;
     double hostBpm = 0.0;
+    std::optional<double> hostPpq;
     if (auto* playHead = getPlayHead())
     {
         if (auto pos = playHead->getPosition())
@@ -126,6 +186,7 @@ void WaverProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBu
             isRecording = pos->getIsRecording();
             if (auto bpm = pos->getBpm())
                 hostBpm = *bpm;
+            hostPpq = pos->getPpqPosition();
         }
     }
     const bool transportActive = isPlaying || isRecording;
@@ -133,23 +194,18 @@ void WaverProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBu
     latestState.isRecording = isRecording;
     latestState.transportActive = transportActive;
 
-    const bool requestedArpOn = apvts.getRawParameterValue("arpEnabled")->load() > 0.5f;
+    const bool requestedArpOn = params.arpEnabled();
     const bool arpOn = transportActive ? prevArpOn : requestedArpOn;
-    const int clampedQualityMode = juce::jlimit(0, 2, qualityModeParam);
-    if (clampedQualityMode != lastQualityModeParam)
-    {
-        applyQualityMode(static_cast<QualityMode>(clampedQualityMode));
-        lastQualityModeParam = clampedQualityMode;
-    }
+    if (const auto targetQuality = targetQualityMode(); targetQuality != qualityMode)
+        applyQualityMode(targetQuality);
     const bool arpStateChanged = arpOn != prevArpOn;
     if (arpOn && !prevArpOn)
         frozenAgeNorm = ageNorm;
     if (arpStateChanged)
     {
         arpLatchPhase = ArpLatchPhase::dip;
-        arpLatchGain.reset(rateDependent.sampleRate, 0.075);
-        arpLatchGain.setCurrentAndTargetValue(1.0f);
-        arpLatchGain.setTargetValue(0.90f);
+        arpLatchDip.setCurrentAndTargetValue(1.0f);
+        arpLatchDip.setTargetValue(0.90f);
     }
     prevArpOn = arpOn;
     latestState.arpEnabled = arpOn;
@@ -159,13 +215,13 @@ void WaverProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBu
     {
         if (transitionPhase == TransitionPhase::idle)
         {
-            transitionPhase = TransitionPhase::fadeOut;
+            setTransitionPhase(TransitionPhase::fadeOut);
             transitionFade.setTargetValue(0.0f);
             engine.setTransitionDelay(25.0f);
         }
         else if (transitionPhase == TransitionPhase::fadeIn)
         {
-            transitionPhase = TransitionPhase::fadeOut;
+            setTransitionPhase(TransitionPhase::fadeOut);
             transitionFade.setTargetValue(0.0f);
             engine.setTransitionDelay(25.0f);
         }
@@ -174,14 +230,19 @@ void WaverProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBu
     {
         const int idx = pendingPresetIndex.exchange(-1, std::memory_order_acq_rel);
         if (idx >= 0 && idx < static_cast<int>(factoryPresets.size()))
+        {
             applyPreset(factoryPresets[static_cast<size_t>(idx)]);
-        transitionPhase = TransitionPhase::fadeIn;
+            momentSeed = momentSeed * 1664525u + 1013904223u;
+            resetMorph(idx);
+            shareMorph();
+        }
+        setTransitionPhase(TransitionPhase::fadeIn);
         transitionFade.setTargetValue(1.0f);
         engine.setTransitionDelay(0.0f);
     }
     if (transitionPhase == TransitionPhase::fadeIn && transitionFade.getCurrentValue() > 0.999f)
     {
-        transitionPhase = TransitionPhase::idle;
+        setTransitionPhase(TransitionPhase::idle);
         transitionFade.setCurrentAndTargetValue(1.0f);
     }
 
@@ -197,25 +258,27 @@ void WaverProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBu
     engine.setLfoRate(lfoRateHz);
     engine.setLfoShape(lfoShapeIdx);
     engine.setLfoToVibrato(lfoVibrato);
-    const float layOrgan = apvts.getRawParameterValue("layerOrgan")->load();
-    const float org16 = apvts.getRawParameterValue("organ16")->load();
-    const float org8 = apvts.getRawParameterValue("organ8")->load();
-    const float org4 = apvts.getRawParameterValue("organ4")->load();
-    const float orgMix = apvts.getRawParameterValue("organMix")->load();
-    const float driveGn = apvts.getRawParameterValue("driveGain")->load();
-    const float tapeSt = apvts.getRawParameterValue("tapeSat")->load();
-    const float wowDp = apvts.getRawParameterValue("wowDepth")->load();
-    const float flutDp = apvts.getRawParameterValue("flutterDepth")->load();
-    const float hissLv = apvts.getRawParameterValue("hissLevel")->load();
-    const int humIdx = static_cast<int>(apvts.getRawParameterValue("humFreq")->load());
-    const float printMx = apvts.getRawParameterValue("printMix")->load();
+    const float layOrgan = paramValue(ParamIndex::layerOrgan);
+    const float org16 = paramValue(ParamIndex::organ16);
+    const float org8 = paramValue(ParamIndex::organ8);
+    const float org4 = paramValue(ParamIndex::organ4);
+    const float orgMix = paramValue(ParamIndex::organMix);
+    const float driveGn = paramValue(ParamIndex::driveGain);
+    const float tapeSt = paramValue(ParamIndex::tapeSat);
+    const float wowDp = paramValue(ParamIndex::wowDepth);
+    const float flutDp = paramValue(ParamIndex::flutterDepth);
+    const float hissLv = paramValue(ParamIndex::hissLevel);
+    const int humIdx = params.humFreq();
+    const float printMx = paramValue(ParamIndex::printMix);
     const float humHz = humIdx == 0 ? 50.0f : 60.0f;
 
-    const float filterKeyTrk = apvts.getRawParameterValue("filterKeyTrack")->load();
-    const float envToFilt = apvts.getRawParameterValue("envToFilter")->load();
-    const float noiseClr = apvts.getRawParameterValue("noiseColor")->load();
-    const float stereoWd = apvts.getRawParameterValue("stereoWidth")->load();
-    const int subOctChoice = static_cast<int>(apvts.getRawParameterValue("dcoSubOctave")->load());
+    const float filterKeyTrk = params.filterKeyTrack();
+    const float envToFilt = params.envToFilter();
+    const float noiseClr = params.noiseColor();
+    const float stereoWd = params.stereoWidth();
+    const int subOctChoice = params.dcoSubOctave();
+    const int unisonChoice = params.unisonVoices();
+    const float unisonDetune = params.unisonDetune();
 
     engine.setToyParams(toyIdx, toyRat, 0.0f);
     engine.setLayerLevels(layDco, layToy);
@@ -225,81 +288,30 @@ void WaverProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBu
     engine.setNoiseColor(noiseClr);
     engine.setStereoWidth(stereoWd);
     engine.setSubOctave(subOctChoice);
+    engine.setUnison(unisonChoice + 1, unisonDetune);
     engine.setOrganDrawbars(org16, org8, org4, orgMix);
+   #if THREADBARE_HEADLESS
+    // No background worker in headless builds: build a queued drawbar table
+    // inline so golden renders do not depend on thread scheduling.
+    engine.serviceBackgroundWork();
+   #endif
     engine.setOrganLevel(layOrgan);
     engine.setPrintParams(driveGn, tapeSt, wowDp, flutDp, hissLv, humHz, printMx);
 
+    // Without a PPQ position the arp free-runs even while the host plays.
+    engine.setArpHostPosition(hostPpq.value_or(0.0), hostBpm, isPlaying && hostPpq.has_value());
     engine.setArpEnabled(arpOn);
     if (arpOn)
         engine.setArpPuck(latestState.puckX, latestState.puckY);
-    engine.setArpHostTempo(hostBpm);
-
-    const auto renderRange = [&](int startSample, int endSample)
-    {
-        if (endSample <= startSample)
-            return;
 
-        const auto rangeSamples = static_cast<std::size_t>(endSample - startSample);
-        if (oversampling != nullptr)
-        {
-            juce::dsp::AudioBlock<float> block(buffer);
-            auto sub = block.getSubBlock(static_cast<std::size_t>(startSample), rangeSamples);
-            auto up = oversampling->processSamplesUp(sub);
-            auto* upLeft = up.getChannelPointer(0);
-            auto* upRight = up.getNumChannels() > 1 ? up.getChannelPointer(1) : upLeft;
-            engine.process(
-                std::span<float>(upLeft, up.getNumSamples()),
-                std::span<float>(upRight, up.getNumSamples()));
-            oversampling->processSamplesDown(sub);
-            return;
-        }
-
-        engine.process(
-            std::span<float>(left + startSample, rangeSamples),
-            std::span<float>(right + startSample, rangeSamples));
-    };
-
-    const auto handleMidiMessage = [&](const juce::MidiMessage& message)
-    {
-        if (message.isNoteOn())
-            engine.arpNoteOn(message.getNoteNumber(), message.getFloatVelocity());
-        else if (message.isNoteOff())
-            engine.arpNoteOff(message.getNoteNumber(), message.getFloatVelocity());
-        else if (message.isPitchWheel())
-        {
-            constexpr float kBendRange = 2.0f;
-            const float bend = (static_cast<float>(message.getPitchWheelValue()) - 8192.0f) / 8192.0f;
-            engine.setPitchBendSemitones(bend * kBendRange);
-        }
-        else if (message.isChannelPressure())
-        {
-            const float pressure = static_cast<float>(message.getChannelPressureValue()) / 127.0f;
-            engine.setAftertouchCutoffOffset(pressure * 4000.0f);
-        }
-        else if (message.isController())
-        {
-            const int cc = message.getControllerNumber();
-            const float val01 = static_cast<float>(message.getControllerValue()) / 127.0f;
-
-            if (cc == 64)
-                engine.setSustainPedal(message.getControllerValue() >= 64);
-            else if (cc == 1)
-                engine.setModWheelDepth(val01);
-            else if (cc == 123 || cc == 120)
-                engine.arpAllNotesOff();
-        }
-    };
-
-    int cursor = 0;
-    for (const auto metadata : midiMessages)
-    {
-        const int eventSample = juce::jlimit(0, numSamples, metadata.samplePosition);
-        renderRange(cursor, eventSample);
-        handleMidiMessage(metadata.getMessage());
-        cursor = eventSample;
-    }
-    renderRange(cursor, numSamples);
+    trace.begin("engine");
+    engine.process(std::span<float>(left, static_cast<std::size_t>(numSamples)),
+                   std::span<float>(right, static_cast<std::size_t>(numSamples)),
+                   midiMessages);
+    trace.end("engine");
+    trace.counter("activeVoices", static_cast<float>(engine.getAllocator().countActiveVoices()));
     midiMessages.clear();
+    latestState.stageProfile = engine.getStageProfile();
 
     outputGainSmoothed.setTargetValue(juce::Decibels::decibelsToGain(outputGainDb));
     const bool transitioning = transitionPhase != TransitionPhase::idle;
@@ -313,18 +325,20 @@ void WaverProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBu
             const float t = transitionFade.getNextValue();
             gain *= t * t * (3.0f - 2.0f * t);
         }
-        const float latchGain = arpLatchGain.getNextValue();
+        const float latchGain = arpLatchPhase == ArpLatchPhase::recover ? arpLatchRecover.getNextValue()
+                                                                          : arpLatchDip.getNextValue();
         gain *= latchGain;
         if (arpLatchPhase == ArpLatchPhase::dip && latchGain <= 0.901f)
         {
             arpLatchPhase = ArpLatchPhase::recover;
-            arpLatchGain.reset(rateDependent.sampleRate, 0.22);
-            arpLatchGain.setTargetValue(1.0f);
+            arpLatchRecover.setCurrentAndTargetValue(latchGain);
+            arpLatchRecover.setTargetValue(1.0f);
         }
         else if (arpLatchPhase == ArpLatchPhase::recover && latchGain >= 0.999f)
         {
             arpLatchPhase = ArpLatchPhase::idle;
-            arpLatchGain.setCurrentAndTargetValue(1.0f);
+            arpLatchDip.setCurrentAndTargetValue(1.0f);
+            arpLatchRecover.setCurrentAndTargetValue(1.0f);
         }
         left[sample] *= gain;
         right[sample] *= gain;
@@ -352,7 +366,11 @@ void WaverProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBu
 
 juce::AudioProcessorEditor* WaverProcessor::createEditor()
 {
+   #if THREADBARE_HEADLESS
+    return nullptr;
+   #else
     return new WaverEditor(*this);
+   #endif
 }
 
 int WaverProcessor::getNumPrograms()
@@ -375,6 +393,9 @@ void WaverProcessor::setCurrentProgram(int index)
         return;
 
     currentProgramIndex = clamped;
+    // Published before the puck moves so the audio thread never morphs the
+    // new puck position on the outgoing surface.
+    pendingPresetIndex.store(currentProgramIndex, std::memory_order_release);
     const auto& preset = factoryPresets[static_cast<size_t>(currentProgramIndex)];
     if (auto* px = apvts.getParameter("puckX"))
     {
@@ -388,7 +409,6 @@ void WaverProcessor::setCurrentProgram(int index)
         py->setValueNotifyingHost(py->convertTo0to1(preset.puckY));
         py->endChangeGesture();
     }
-    pendingPresetIndex.store(currentProgramIndex, std::memory_order_release);
     pushCurrentState();
 }
 
@@ -421,6 +441,21 @@ void WaverProcessor::onSaveState(juce::ValueTree& state)
                           determinismState.ouStates[i],
                           nullptr);
     }
+
+    // The morph as played. Parameters keep their own values, so the host
+    // never sees (or records) what the audio thread computed.
+    juce::ValueTree morphState(kMorphStateType);
+    const auto ownedMask = morphHeard.ownedMask.load(std::memory_order_acquire);
+    morphState.setProperty("puckX", morphHeard.puckX.load(std::memory_order_relaxed), nullptr);
+    morphState.setProperty("puckY", morphHeard.puckY.load(std::memory_order_relaxed), nullptr);
+    morphState.setProperty("momentSeed", static_cast<juce::int64>(morphHeard.seed.load(std::memory_order_relaxed)), nullptr);
+    for (std::size_t slot = 0; slot < RbfMorph::kNumParams; ++slot)
+    {
+        if (((ownedMask >> slot) & 1u) != 0)
+            morphState.setProperty(RbfMorph::Surfaces::kParamIds[slot],
+                                   morphHeard.values[slot].load(std::memory_order_relaxed), nullptr);
+    }
+    state.appendChild(morphState, nullptr);
 }
 
 void WaverProcessor::onRestoreState(const juce::ValueTree& tree)
@@ -445,6 +480,25 @@ void WaverProcessor::onRestoreState(const juce::ValueTree& tree)
         if (tree.hasProperty(ouKey))
             determinismState.ouStates[i] = static_cast<float>(tree.getProperty(ouKey));
     }
+
+    // Handed to the audio thread under morphEpoch (see setStateInformation).
+    const auto morphState = tree.getChildWithName(kMorphStateType);
+    std::uint64_t ownedMask = 0;
+    for (std::size_t slot = 0; slot < RbfMorph::kNumParams; ++slot)
+    {
+        const juce::Identifier id { RbfMorph::Surfaces::kParamIds[slot] };
+        if (!morphState.hasProperty(id))
+            continue;
+        ownedMask |= std::uint64_t { 1 } << slot;
+        morphRestore.values[slot].store(static_cast<float>(morphState.getProperty(id)), std::memory_order_relaxed);
+    }
+    const auto fallbackSeed = static_cast<juce::int64>(determinismState.globalSeed & 0xFFFFFFFFu);
+    morphRestore.ownedMask.store(ownedMask, std::memory_order_relaxed);
+    morphRestore.puckX.store(static_cast<float>(morphState.getProperty("puckX", 0.0f)), std::memory_order_relaxed);
+    morphRestore.puckY.store(static_cast<float>(morphState.getProperty("puckY", 0.0f)), std::memory_order_relaxed);
+    morphRestore.seed.store(static_cast<std::uint32_t>(static_cast<juce::int64>(morphState.getProperty("momentSeed", fallbackSeed))),
+                            std::memory_order_relaxed);
+    morphRestoreProgram.store(currentProgramIndex, std::memory_order_relaxed);
 }
 
 void WaverProcessor::onStateRestored()
@@ -458,8 +512,14 @@ void WaverProcessor::setStateInformation(const void* data, int sizeInBytes)
     if (!tree.isValid())
         return;
 
+    // The morph comes back as it was saved, so the audio thread resyncs to
+    // morphRestore instead of morphing over drawer edits. The morph child
+    // stays out of the parameter state.
+    morphEpoch.fetch_add(1, std::memory_order_acq_rel);
     onRestoreState(tree);
+    tree.removeChild(tree.getChildWithName(kMorphStateType), nullptr);
     apvts.replaceState(tree);
+    morphEpoch.fetch_add(1, std::memory_order_acq_rel);
 
     if (!hasRestoredInitialState)
     {
@@ -474,6 +534,9 @@ bool WaverProcessor::popVisualState(WaverState& out) noexcept
     bool popped = false;
     while (stateQueue.pop(latest))
     {
+        // Stage timings keep the worst block since the last frame.
+        if (popped)
+            latest.stageProfile.mergeMax(out.stageProfile);
         out = latest;
         popped = true;
     }
@@ -485,15 +548,153 @@ void WaverProcessor::setMorphSnapshot(float /*puckX*/, float /*puckY*/, float bl
     morphBlend.store(juce::jlimit(0.15f, 0.60f, blend), std::memory_order_relaxed);
 }
 
+void WaverProcessor::updateMorph(float puckX, float puckY, bool arpOn, int numSamples) noexcept
+{
+    // Mid-restore the owned slots hold their morph; afterwards everything
+    // resyncs to the restored values.
+    const auto epoch = morphEpoch.load(std::memory_order_acquire);
+    if ((epoch & 1u) != 0)
+        return;
+    if (epoch != morphSeenEpoch)
+    {
+        const int program = morphRestoreProgram.load(std::memory_order_relaxed);
+        const auto seed = morphRestore.seed.load(std::memory_order_relaxed);
+        const auto ownedMask = morphRestore.ownedMask.load(std::memory_order_relaxed);
+        const float restoredX = morphRestore.puckX.load(std::memory_order_relaxed);
+        const float restoredY = morphRestore.puckY.load(std::memory_order_relaxed);
+        RbfMorph::Result restored;
+        for (std::size_t slot = 0; slot < RbfMorph::kNumParams; ++slot)
+        {
+            restored.values[slot] = morphRestore.values[slot].load(std::memory_order_relaxed);
+            restored.present[slot] = ((ownedMask >> slot) & 1u) != 0;
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (morphEpoch.load(std::memory_order_relaxed) != epoch)
+            return;
+
+        morphSeenEpoch = epoch;
+        momentSeed = seed;
+        resetMorph(program);
+        if (ownedMask != 0)
+        {
+            morphResult = restored;
+            morphOwned = restored.present;
+            morphPuckX = restoredX;
+            morphPuckY = restoredY;
+        }
+        shareMorph();
+        return;
+    }
+
+    bool released = false;
+    for (std::size_t slot = 0; slot < RbfMorph::kNumParams; ++slot)
+    {
+        const float raw = params.get(morphParamIndex[slot]);
+        if (raw != morphLastRaw[slot])
+        {
+            morphLastRaw[slot] = raw;
+            released = released || morphOwned[slot];
+            morphOwned[slot] = false;
+        }
+    }
+    if (released)
+        shareMorph();
+
+    // The puck drives the arp while it is on, and a preset change moves the
+    // puck before its surface is active; neither should morph.
+    const bool presetPending = transitionPhase != TransitionPhase::idle
+                               || pendingPresetIndex.load(std::memory_order_acquire) >= 0;
+    if (!arpOn && !presetPending && (puckX != morphPuckX || puckY != morphPuckY))
+        morphPending = true;
+
+    morphCountdown = std::max(0, morphCountdown - numSamples);
+    if (!morphPending || morphCountdown > 0)
+        return;
+
+    morphPending = false;
+    morphCountdown = static_cast<int>(rateDependent.sampleRate * threadbare::tuning::waver::kMorphIntervalSeconds);
+    morphPuckX = puckX;
+    morphPuckY = puckY;
+    morph.evaluate(puckX, puckY, morphResult);
+    morphOwned = morphResult.present;
+    shareMorph();
+}
+
+void WaverProcessor::resetMorph(int programIndex) noexcept
+{
+    morph.setSurface(surfaceIndexForProgram(programIndex));
+    morph.setMomentSeed(momentSeed);
+    for (std::size_t slot = 0; slot < RbfMorph::kNumParams; ++slot)
+        morphLastRaw[slot] = params.get(morphParamIndex[slot]);
+    morphOwned.fill(false);
+    morphPuckX = params.puckX();
+    morphPuckY = params.puckY();
+    morphPending = false;
+    morphCountdown = 0;
+}
+
+void WaverProcessor::prepareMorph() noexcept
+{
+    // A restore since the last block resyncs on the first block instead.
+    const bool restored = morphEpoch.load(std::memory_order_acquire) != morphSeenEpoch;
+    if (restored || std::none_of(morphOwned.begin(), morphOwned.end(), [](bool owned) { return owned; }))
+    {
+        resetMorph(currentProgramIndex);
+        shareMorph();
+        return;
+    }
+
+    // Owned slots keep playing the morph they had; edits made while stopped
+    // still show up as raw changes on the next block and release their slot.
+    morph.setSurface(surfaceIndexForProgram(currentProgramIndex));
+    morph.setMomentSeed(momentSeed);
+    morphCountdown = 0;
+}
+
+void WaverProcessor::shareMorph() noexcept
+{
+    std::uint64_t ownedMask = 0;
+    for (std::size_t slot = 0; slot < RbfMorph::kNumParams; ++slot)
+    {
+        morphHeard.values[slot].store(morphResult.values[slot], std::memory_order_relaxed);
+        if (morphOwned[slot])
+            ownedMask |= std::uint64_t { 1 } << slot;
+    }
+    morphHeard.puckX.store(morphPuckX, std::memory_order_relaxed);
+    morphHeard.puckY.store(morphPuckY, std::memory_order_relaxed);
+    morphHeard.seed.store(momentSeed, std::memory_order_relaxed);
+    morphHeard.ownedMask.store(ownedMask, std::memory_order_release);
+}
+
+float WaverProcessor::paramValue(ParamIndex index) const noexcept
+{
+    const int slot = morphSlotForParam[static_cast<std::size_t>(index)];
+    if (slot >= 0 && morphOwned[static_cast<std::size_t>(slot)])
+        return morphResult.values[static_cast<std::size_t>(slot)];
+    return params.get(index);
+}
+
+int WaverProcessor::surfaceIndexForProgram(int programIndex) noexcept
+{
+    // Factory presets come in threes per category, one surface per category.
+    const int lastSurface = static_cast<int>(RbfMorph::Surfaces::kSurfaces.size()) - 1;
+    return std::clamp(programIndex / 3, 0, lastSurface);
+}
+
 void WaverProcessor::pushCurrentState() noexcept
 {
     WaverState state{};
-    state.puckX = apvts.getRawParameterValue("puckX")->load();
-    state.puckY = apvts.getRawParameterValue("puckY")->load();
+    state.puckX = params.puckX();
+    state.puckY = params.puckY();
     state.mix   = morphBlend.load(std::memory_order_relaxed);
     stateQueue.push(state);
 }
 
+void WaverProcessor::runJob()
+{
+    engine.serviceBackgroundWork();
+}
+
 void WaverProcessor::enqueueMomentTrigger() noexcept
 {
     uiEventQueue.push(UiEvent { EventType::momentTrigger, 1.0f });
@@ -517,47 +718,32 @@ void WaverProcessor::drainUiEvents() noexcept
 
 void WaverProcessor::applyQualityMode(QualityMode mode)
 {
+    // Realtime-safe: the engine fades over to a chain built in prepareToPlay,
+    // and reported latency is the same for every mode.
     qualityMode = mode;
-    switch (qualityMode)
-    {
-        case QualityMode::lite:
-            configureOversampling(qualityMode);
-            setLatencySamples(0);
-            break;
-        case QualityMode::standard:
-            configureOversampling(qualityMode);
-            setLatencySamples(oversampling != nullptr ? static_cast<int>(oversampling->getLatencyInSamples()) : 0);
-            break;
-        case QualityMode::hq:
-            configureOversampling(qualityMode);
-            setLatencySamples(oversampling != nullptr ? static_cast<int>(oversampling->getLatencyInSamples()) : 0);
-            break;
-        default:
-            setLatencySamples(0);
-            break;
-    }
+    engine.setOversampling(oversamplingStagesFor(qualityMode));
 }
 
-void WaverProcessor::configureOversampling(QualityMode mode)
+WaverProcessor::QualityMode WaverProcessor::targetQualityMode() const noexcept
 {
-    if (preparedChannels == 0 || preparedBlockSize == 0)
-        return;
+    // No deadline offline, so bounces never pay for Lite/Standard aliasing.
+    // Latency is the same for every mode, and a mid-stream switch takes the
+    // engine's gap-free chain fade with voice and filter state carried over,
+    // so the render only differs from playback in aliasing.
+    if (isNonRealtime())
+        return QualityMode::hq;
+    return static_cast<QualityMode>(juce::jlimit(0, 2, params.qualityMode()));
+}
 
-    if (mode == QualityMode::lite)
+int WaverProcessor::oversamplingStagesFor(QualityMode mode) noexcept
+{
+    switch (mode)
     {
-        oversampling.reset();
-        return;
+        case QualityMode::standard: return 1;
+        case QualityMode::hq:       return 2;
+        case QualityMode::lite:
+        default:                    return 0;
     }
-
-    const std::size_t stages = mode == QualityMode::hq ? 2u : 1u;
-    oversampling = std::make_unique<juce::dsp::Oversampling<float>>(
-        preparedChannels,
-        stages,
-        juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR,
-        true,
-        false);
-    oversampling->reset();
-    oversampling->initProcessing(preparedBlockSize);
 }
 
 bool WaverProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
@@ -571,188 +757,14 @@ bool WaverProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
 
 void WaverProcessor::initialiseFactoryPresets()
 {
-    factoryPresets = {
-
-        // --- AMBER (warm pads, lush, breathing) ---
-        {"pad for opening scene", {
-            {"macroShape", 0.15f}, {"layerDco", 0.85f}, {"layerToy", 0.0f}, {"layerOrgan", 0.0f},
-            {"filterCutoff", 3200.0f}, {"filterRes", 0.2f}, {"filterMode", 0.0f},
-            {"dcoSubLevel", 0.3f}, {"noiseLevel", 0.02f},
-            {"lfoRate", 2.5f}, {"lfoToPwm", 0.15f}, {"lfoToVibrato", 3.0f},
-            {"chorusMode", 1.0f}, {"driftAmount", 0.25f},
-            {"envAttack", 0.4f}, {"envDecay", 1.5f}, {"envSustain", 0.75f}, {"envRelease", 2.5f},
-            {"driveGain", 0.05f}, {"tapeSat", 0.15f}, {"wowDepth", 0.08f}, {"flutterDepth", 0.03f},
-            {"hissLevel", 0.05f}, {"printMix", 0.6f}, {"outputGain", -1.0f}
-        }, -0.35f, -0.15f},
-
-        {"pad but a little brighter", {
-            {"macroShape", 0.35f}, {"layerDco", 0.7f}, {"layerToy", 0.15f}, {"layerOrgan", 0.1f},
-            {"filterCutoff", 4500.0f}, {"filterRes", 0.25f}, {"filterMode", 0.0f},
-            {"dcoSubLevel", 0.2f}, {"noiseLevel", 0.04f},
-            {"lfoRate", 1.8f}, {"lfoToPwm", 0.2f}, {"lfoToVibrato", 5.0f},
-            {"chorusMode", 2.0f}, {"driftAmount", 0.35f},
-            {"envAttack", 0.6f}, {"envDecay", 2.0f}, {"envSustain", 0.65f}, {"envRelease", 4.0f},
-            {"driveGain", 0.1f}, {"tapeSat", 0.25f}, {"wowDepth", 0.12f}, {"flutterDepth", 0.05f},
-            {"hissLevel", 0.08f}, {"printMix", 0.7f}, {"outputGain", -1.0f}
-        }, 0.25f, 0.0f},
-
-        {"classroom pad no panic", {
-            {"macroShape", 0.05f}, {"layerDco", 0.9f}, {"layerToy", 0.0f}, {"layerOrgan", 0.15f},
-            {"filterCutoff", 2000.0f}, {"filterRes", 0.1f}, {"filterMode", 1.0f},
-            {"dcoSubLevel", 0.45f}, {"noiseLevel", 0.01f},
-            {"lfoRate", 0.8f}, {"lfoToPwm", 0.0f}, {"lfoToVibrato", 2.0f},
-            {"chorusMode", 3.0f}, {"driftAmount", 0.2f},
-            {"envAttack", 1.2f}, {"envDecay", 3.0f}, {"envSustain", 0.8f}, {"envRelease", 5.0f},
-            {"driveGain", 0.0f}, {"tapeSat", 0.1f}, {"wowDepth", 0.06f}, {"flutterDepth", 0.02f},
-            {"hissLevel", 0.03f}, {"printMix", 0.5f}, {"outputGain", -1.0f}
-        }, -0.45f, 0.35f},
-
-        // --- DRIFT (movement, modulation, evolving) ---
-        {"slow drift for verses", {
-            {"macroShape", 0.25f}, {"layerDco", 0.8f}, {"layerToy", 0.0f}, {"layerOrgan", 0.0f},
-            {"filterCutoff", 5000.0f}, {"filterRes", 0.35f}, {"filterMode", 0.0f},
-            {"dcoSubLevel", 0.15f}, {"noiseLevel", 0.03f},
-            {"lfoRate", 0.4f}, {"lfoToPwm", 0.3f}, {"lfoToVibrato", 8.0f},
-            {"chorusMode", 1.0f}, {"driftAmount", 0.7f},
-            {"envAttack", 0.8f}, {"envDecay", 2.0f}, {"envSustain", 0.6f}, {"envRelease", 3.5f},
-            {"driveGain", 0.05f}, {"tapeSat", 0.2f}, {"wowDepth", 0.2f}, {"flutterDepth", 0.08f},
-            {"hissLevel", 0.06f}, {"printMix", 0.65f}, {"outputGain", -1.0f}
-        }, -0.2f, 0.2f},
-
-        {"glide lead not flashy", {
-            {"macroShape", 0.5f}, {"layerDco", 0.6f}, {"layerToy", 0.2f}, {"layerOrgan", 0.0f},
-            {"filterCutoff", 6000.0f}, {"filterRes", 0.3f}, {"filterMode", 0.0f},
-            {"dcoSubLevel", 0.1f}, {"noiseLevel", 0.05f},
-            {"lfoRate", 3.5f}, {"lfoToPwm", 0.4f}, {"lfoToVibrato", 12.0f},
-            {"chorusMode", 2.0f}, {"driftAmount", 0.6f},
-            {"portaTime", 350.0f}, {"portaMode", 0.0f},
-            {"envAttack", 0.3f}, {"envDecay", 1.0f}, {"envSustain", 0.5f}, {"envRelease", 2.0f},
-            {"driveGain", 0.09f}, {"tapeSat", 0.26f}, {"wowDepth", 0.15f}, {"flutterDepth", 0.06f},
-            {"hissLevel", 0.07f}, {"printMix", 0.66f}, {"outputGain", -1.0f}
-        }, 0.45f, -0.05f},
-
-        {"wobbly memory pad", {
-            {"macroShape", 0.4f}, {"layerDco", 0.75f}, {"layerToy", 0.1f}, {"layerOrgan", 0.05f},
-            {"filterCutoff", 3500.0f}, {"filterRes", 0.4f}, {"filterMode", 0.0f},
-            {"dcoSubLevel", 0.25f}, {"noiseLevel", 0.06f},
-            {"lfoRate", 1.2f}, {"lfoToPwm", 0.25f}, {"lfoToVibrato", 15.0f},
-            {"chorusMode", 3.0f}, {"driftAmount", 0.85f},
-            {"envAttack", 0.5f}, {"envDecay", 2.5f}, {"envSustain", 0.55f}, {"envRelease", 4.0f},
-            {"driveGain", 0.08f}, {"tapeSat", 0.27f}, {"wowDepth", 0.16f}, {"flutterDepth", 0.06f},
-            {"hissLevel", 0.1f}, {"printMix", 0.74f}, {"outputGain", -2.0f}
-        }, 0.1f, 0.55f},
-
-        // --- HUSH (quiet, intimate, barely there) ---
-        {"quiet keys for intro", {
-            {"macroShape", 0.0f}, {"layerDco", 0.5f}, {"layerToy", 0.0f}, {"layerOrgan", 0.0f},
-            {"filterCutoff", 1800.0f}, {"filterRes", 0.05f}, {"filterMode", 1.0f},
-            {"dcoSubLevel", 0.5f}, {"noiseLevel", 0.0f},
-            {"lfoRate", 0.5f}, {"lfoToPwm", 0.0f}, {"lfoToVibrato", 1.5f},
-            {"chorusMode", 0.0f}, {"driftAmount", 0.15f},
-            {"envAttack", 0.08f}, {"envDecay", 0.8f}, {"envSustain", 0.3f}, {"envRelease", 1.5f},
-            {"driveGain", 0.0f}, {"tapeSat", 0.05f}, {"wowDepth", 0.03f}, {"flutterDepth", 0.01f},
-            {"hissLevel", 0.02f}, {"printMix", 0.4f}, {"outputGain", -1.0f}
-        }, -0.45f, -0.55f},
-
-        {"soft organ for feelings", {
-            {"macroShape", 0.0f}, {"layerDco", 0.3f}, {"layerToy", 0.0f}, {"layerOrgan", 0.6f},
-            {"organ16", 3.0f}, {"organ8", 5.0f}, {"organ4", 1.0f}, {"organMix", 2.0f},
-            {"filterCutoff", 2500.0f}, {"filterRes", 0.1f}, {"filterMode", 0.0f},
-            {"dcoSubLevel", 0.0f}, {"noiseLevel", 0.0f},
-            {"lfoRate", 1.0f}, {"lfoToPwm", 0.0f}, {"lfoToVibrato", 2.0f},
-            {"chorusMode", 1.0f}, {"driftAmount", 0.2f},
-            {"envAttack", 0.8f}, {"envDecay", 3.0f}, {"envSustain", 0.7f}, {"envRelease", 6.0f},
-            {"driveGain", 0.0f}, {"tapeSat", 0.1f}, {"wowDepth", 0.05f}, {"flutterDepth", 0.02f},
-            {"hissLevel", 0.04f}, {"printMix", 0.55f}, {"outputGain", -2.0f}
-        }, -0.2f, 0.1f},
-
-        {"tape pad after midnight", {
-            {"macroShape", 0.1f}, {"layerDco", 0.65f}, {"layerToy", 0.0f}, {"layerOrgan", 0.2f},
-            {"organ16", 4.0f}, {"organ8", 3.0f}, {"organ4", 0.0f}, {"organMix", 1.0f},
-            {"filterCutoff", 1500.0f}, {"filterRes", 0.15f}, {"filterMode", 1.0f},
-            {"dcoSubLevel", 0.4f}, {"noiseLevel", 0.02f},
-            {"lfoRate", 0.3f}, {"lfoToPwm", 0.0f}, {"lfoToVibrato", 3.0f},
-            {"chorusMode", 1.0f}, {"driftAmount", 0.3f},
-            {"envAttack", 1.5f}, {"envDecay", 4.0f}, {"envSustain", 0.6f}, {"envRelease", 8.0f},
-            {"driveGain", 0.0f}, {"tapeSat", 0.2f}, {"wowDepth", 0.15f}, {"flutterDepth", 0.04f},
-            {"hissLevel", 0.08f}, {"printMix", 0.75f}, {"outputGain", -1.0f}
-        }, -0.35f, 0.65f},
-
-        // --- SIGNAL (brighter, present, cutting through) ---
-        {"toy lead for obvious hook", {
-            {"macroShape", 0.6f}, {"layerDco", 0.2f}, {"layerToy", 0.8f}, {"layerOrgan", 0.0f},
-            {"toyIndex", 0.5f}, {"toyRatio", 0.3f},
-            {"filterCutoff", 10000.0f}, {"filterRes", 0.15f}, {"filterMode", 0.0f},
-            {"dcoSubLevel", 0.0f}, {"noiseLevel", 0.0f},
-            {"lfoRate", 5.0f}, {"lfoToPwm", 0.0f}, {"lfoToVibrato", 0.0f},
-            {"chorusMode", 0.0f}, {"driftAmount", 0.1f},
-            {"envAttack", 0.005f}, {"envDecay", 0.4f}, {"envSustain", 0.2f}, {"envRelease", 0.3f},
-            {"driveGain", 0.05f}, {"tapeSat", 0.15f}, {"wowDepth", 0.04f}, {"flutterDepth", 0.02f},
-            {"hissLevel", 0.03f}, {"printMix", 0.5f}, {"outputGain", 0.0f}
-        }, 0.35f, -0.55f},
-
-        {"bell lead mildly broken", {
-            {"macroShape", 0.7f}, {"layerDco", 0.15f}, {"layerToy", 0.7f}, {"layerOrgan", 0.0f},
-            {"toyIndex", 0.7f}, {"toyRatio", 0.6f},
-            {"filterCutoff", 8000.0f}, {"filterRes", 0.2f}, {"filterMode", 0.0f},
-            {"dcoSubLevel", 0.0f}, {"noiseLevel", 0.02f},
-            {"lfoRate", 4.0f}, {"lfoToPwm", 0.0f}, {"lfoToVibrato", 4.0f},
-            {"chorusMode", 1.0f}, {"driftAmount", 0.2f},
-            {"envAttack", 0.001f}, {"envDecay", 1.2f}, {"envSustain", 0.0f}, {"envRelease", 1.0f},
-            {"driveGain", 0.1f}, {"tapeSat", 0.2f}, {"wowDepth", 0.06f}, {"flutterDepth", 0.03f},
-            {"hissLevel", 0.04f}, {"printMix", 0.6f}, {"outputGain", 0.0f}
-        }, 0.1f, -0.3f},
-
-        {"pulse lead for the chorus", {
-            {"macroShape", 0.85f}, {"layerDco", 0.9f}, {"layerToy", 0.0f}, {"layerOrgan", 0.0f},
-            {"filterCutoff", 6500.0f}, {"filterRes", 0.45f}, {"filterMode", 0.0f},
-            {"dcoSubLevel", 0.35f}, {"noiseLevel", 0.0f},
-            {"lfoRate", 6.0f}, {"lfoToPwm", 0.35f}, {"lfoToVibrato", 6.0f},
-            {"chorusMode", 0.0f}, {"driftAmount", 0.15f},
-            {"portaTime", 250.0f}, {"portaMode", 0.0f},
-            {"envAttack", 0.01f}, {"envDecay", 0.5f}, {"envSustain", 0.6f}, {"envRelease", 0.4f},
-            {"driveGain", 0.12f}, {"tapeSat", 0.1f}, {"wowDepth", 0.03f}, {"flutterDepth", 0.01f},
-            {"hissLevel", 0.02f}, {"printMix", 0.45f}, {"outputGain", -1.0f}
-        }, 0.65f, -0.35f},
-
-        // --- WEIGHT (deep, heavy, grounding) ---
-        {"low bed for serious parts", {
-            {"macroShape", 0.0f}, {"layerDco", 0.7f}, {"layerToy", 0.0f}, {"layerOrgan", 0.5f},
-            {"organ16", 8.0f}, {"organ8", 6.0f}, {"organ4", 2.0f}, {"organMix", 4.0f},
-            {"filterCutoff", 1200.0f}, {"filterRes", 0.3f}, {"filterMode", 1.0f},
-            {"dcoSubLevel", 0.6f}, {"noiseLevel", 0.0f},
-            {"lfoRate", 0.6f}, {"lfoToPwm", 0.0f}, {"lfoToVibrato", 1.0f},
-            {"chorusMode", 1.0f}, {"driftAmount", 0.3f},
-            {"envAttack", 0.15f}, {"envDecay", 1.0f}, {"envSustain", 0.85f}, {"envRelease", 2.0f},
-            {"driveGain", 0.12f}, {"tapeSat", 0.3f}, {"wowDepth", 0.1f}, {"flutterDepth", 0.04f},
-            {"hissLevel", 0.06f}, {"printMix", 0.7f}, {"outputGain", -2.0f}
-        }, -0.55f, -0.35f},
-
-        {"organ for final chorus", {
-            {"macroShape", 0.0f}, {"layerDco", 0.0f}, {"layerToy", 0.0f}, {"layerOrgan", 0.9f},
-            {"organ16", 6.0f}, {"organ8", 8.0f}, {"organ4", 4.0f}, {"organMix", 5.0f},
-            {"filterCutoff", 4000.0f}, {"filterRes", 0.1f}, {"filterMode", 0.0f},
-            {"dcoSubLevel", 0.0f}, {"noiseLevel", 0.0f},
-            {"lfoRate", 1.0f}, {"lfoToPwm", 0.0f}, {"lfoToVibrato", 0.0f},
-            {"chorusMode", 2.0f}, {"driftAmount", 0.4f},
-            {"envAttack", 0.01f}, {"envDecay", 0.5f}, {"envSustain", 0.9f}, {"envRelease", 0.5f},
-            {"driveGain", 0.07f}, {"tapeSat", 0.28f}, {"wowDepth", 0.16f}, {"flutterDepth", 0.06f},
-            {"hissLevel", 0.12f}, {"printMix", 0.75f}, {"outputGain", -2.0f}
-        }, 0.0f, 0.35f},
-
-        {"tape weight for ending", {
-            {"macroShape", 0.2f}, {"layerDco", 0.6f}, {"layerToy", 0.1f}, {"layerOrgan", 0.3f},
-            {"organ16", 5.0f}, {"organ8", 4.0f}, {"organ4", 2.0f}, {"organMix", 3.0f},
-            {"filterCutoff", 2800.0f}, {"filterRes", 0.2f}, {"filterMode", 0.0f},
-            {"dcoSubLevel", 0.4f}, {"noiseLevel", 0.08f},
-            {"lfoRate", 2.0f}, {"lfoToPwm", 0.1f}, {"lfoToVibrato", 4.0f},
-            {"chorusMode", 3.0f}, {"driftAmount", 0.5f},
-            {"envAttack", 0.1f}, {"envDecay", 1.5f}, {"envSustain", 0.65f}, {"envRelease", 3.0f},
-            {"driveGain", 0.08f}, {"tapeSat", 0.26f}, {"wowDepth", 0.16f}, {"flutterDepth", 0.06f},
-            {"hissLevel", 0.15f}, {"printMix", 0.74f}, {"outputGain", -2.0f}
-        }, -0.2f, 0.7f},
-
-    };
+    factoryPresets.clear();
+    for (const auto& factory : threadbare::waver::getFactoryPresets())
+    {
+        Preset preset { factory.name, {}, factory.puckX, factory.puckY };
+        for (const auto& [id, value] : factory.parameters)
+            preset.parameters[id] = value;
+        factoryPresets.push_back(std::move(preset));
+    }
 }
 
 void WaverProcessor::applyPreset(const Preset& preset)
@@ -773,27 +785,16 @@ void WaverProcessor::applyPreset(const Preset& preset)
         applyParam(id, value);
 
     // Ensure every parameter has a deterministic value after a preset load.
-    // Factory presets that omit a parameter get the params.json default,
-    // preventing "carry-over" from the previously loaded preset.
-    const auto has = [&](const char* id) { return preset.parameters.find(id) != preset.parameters.end(); };
-    if (!has("portaTime"))      applyParam("portaTime",      0.0f);
-    if (!has("portaMode"))      applyParam("portaMode",      0.0f);
-    if (!has("toyIndex"))       applyParam("toyIndex",       0.25f);
-    if (!has("toyRatio"))       applyParam("toyRatio",       0.5f);
-    if (!has("organ16"))        applyParam("organ16",        5.0f);
-    if (!has("organ8"))         applyParam("organ8",         4.0f);
-    if (!has("organ4"))         applyParam("organ4",         2.0f);
-    if (!has("organMix"))       applyParam("organMix",       3.0f);
-    if (!has("lfoShape"))       applyParam("lfoShape",       0.0f);
-    if (!has("humFreq"))        applyParam("humFreq",        1.0f);
-    if (!has("filterKeyTrack")) applyParam("filterKeyTrack", 0.5f);
-    if (!has("envToFilter"))    applyParam("envToFilter",    0.3f);
-    if (!has("noiseColor"))     applyParam("noiseColor",     0.35f);
-    if (!has("stereoWidth"))    applyParam("stereoWidth",    0.8f);
-    if (!has("dcoSubOctave"))   applyParam("dcoSubOctave",   0.0f);
+    for (const auto& [id, value] : threadbare::waver::kPresetFallbacks)
+    {
+        if (preset.parameters.find(id) == preset.parameters.end())
+            applyParam(id, value);
+    }
 }
 
+#if ! THREADBARE_HEADLESS
 juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
 {
     return new WaverProcessor();
 }
+#endif
@@ -10,22 +10,25 @@
 
 #include "../WaverGeneratedParams.h"
 #include "../WaverTuning.h"
+#include "../DSP/RbfMorph.h"
 #include "../DSP/WaverEngine.h"
+#include "BackgroundWorker.h"
 #include "ProcessorBase.h"
 
-class WaverProcessor final : public threadbare::core::ProcessorBase
+class WaverProcessor final : public threadbare::core::ProcessorBase,
+                             private threadbare::core::BackgroundWorker::Job
 {
 public:
     WaverProcessor();
-    ~WaverProcessor() override = default;
+    ~WaverProcessor() override;
 
     void prepareToPlay(double sampleRate, int samplesPerBlock) override;
     void releaseResources() override;
     void reset() override;
-    void processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages) override;
+    void processAudio(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages) override;
 
     juce::AudioProcessorEditor* createEditor() override;
-    bool hasEditor() const override { return true; }
+    bool hasEditor() const override { return ! THREADBARE_HEADLESS; }
     const juce::String getName() const override { return "Waver"; }
     double getTailLengthSeconds() const override { return 15.5; }
 
@@ -52,6 +55,10 @@ public:
         bool isPlaying = false;
         bool isRecording = false;
         bool transportActive = false;
+        // The morph being played; present marks the slots it owns, which the
+        // drawer shows instead of their parameter values.
+        threadbare::dsp::RbfMorph::Result morph;
+        threadbare::dsp::WaverStageProfile stageProfile;
     };
 
     struct DeterminismState
@@ -102,9 +109,29 @@ private:
         hq = 2
     };
 
+    using ParamIndex = threadbare::waver::WaverGeneratedParams::Index;
+    using RbfMorph = threadbare::dsp::RbfMorph;
+
     void drainUiEvents() noexcept;
     void pushCurrentState() noexcept;
 
+    // Shared worker: builds organ drawbar tables the engine has queued.
+    void runJob() override;
+
+    // Puck morph. A morph target follows the morph from the last puck move
+    // until its own parameter changes (drawer edit, automation, preset load).
+    // The audio thread plays the morph at once. It is processor state, not
+    // parameter values: onSaveState stores it and the drawer gets it through
+    // the state queue, so the host never records lanes for it.
+    void updateMorph(float puckX, float puckY, bool arpOn, int numSamples) noexcept;
+    void resetMorph(int programIndex) noexcept;
+    // prepareToPlay: keeps ownership and the morph it was playing.
+    void prepareMorph() noexcept;
+    // Audio thread: copies the morph being played to morphHeard.
+    void shareMorph() noexcept;
+    float paramValue(ParamIndex index) const noexcept;
+    static int surfaceIndexForProgram(int programIndex) noexcept;
+
     struct Preset
     {
         juce::String name;
@@ -116,20 +143,28 @@ private:
     void initialiseFactoryPresets();
     void applyPreset(const Preset& preset);
     void applyQualityMode(QualityMode mode);
-    void configureOversampling(QualityMode mode);
+    // The qualityMode parameter during playback; always HQ for offline renders
+    // (switched through the same chain fade as a mode change).
+    QualityMode targetQualityMode() const noexcept;
+    static int oversamplingStagesFor(QualityMode mode) noexcept;
 
     enum class TransitionPhase : std::uint8_t { idle, fadeOut, fadeIn };
     enum class ArpLatchPhase : std::uint8_t { idle, dip, recover };
 
+    // Audio thread: moves the preset transition on and traces the phase.
+    void setTransitionPhase(TransitionPhase next) noexcept;
+
+    threadbare::waver::WaverGeneratedParams::ParamCache params { apvts };
     threadbare::dsp::WaverEngine engine;
+   #if ! THREADBARE_HEADLESS
+    juce::SharedResourcePointer<threadbare::core::BackgroundWorker> backgroundWorker;
+   #endif
     threadbare::core::StateQueue<WaverState> stateQueue;
     threadbare::core::StateQueue<UiEvent, 64> uiEventQueue;
     WaverState latestState;
     DeterminismState determinismState;
     threadbare::tuning::waver::RateDependent rateDependent;
     QualityMode qualityMode = QualityMode::standard;
-    int lastQualityModeParam = static_cast<int>(QualityMode::standard);
-    std::unique_ptr<juce::dsp::Oversampling<float>> oversampling;
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Multiplicative> outputGainSmoothed;
     std::uint32_t preparedBlockSize = 0;
     std::uint32_t preparedChannels = 0;
@@ -142,8 +177,42 @@ private:
     TransitionPhase transitionPhase = TransitionPhase::idle;
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> transitionFade;
     ArpLatchPhase arpLatchPhase = ArpLatchPhase::idle;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> arpLatchGain;
+    // The dip and the recovery ramp at different speeds; both lengths are set in prepareToPlay.
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> arpLatchDip;
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> arpLatchRecover;
     std::atomic<int> pendingPresetIndex { -1 };
+
+    RbfMorph morph;
+    RbfMorph::Result morphResult;
+    std::array<ParamIndex, RbfMorph::kNumParams> morphParamIndex {};
+    std::array<int, threadbare::waver::WaverGeneratedParams::kNumParams> morphSlotForParam {};
+    std::array<bool, RbfMorph::kNumParams> morphOwned {};
+    std::array<float, RbfMorph::kNumParams> morphLastRaw {};
+    float morphPuckX = 0.0f;
+    float morphPuckY = 0.0f;
+    bool morphPending = false;
+    int morphCountdown = 0;
+    std::uint32_t momentSeed = 1;
+
+    // The morph as saved state, shared without locks. Slots are read one by
+    // one, so a save racing an evaluation can mix two neighbouring results.
+    struct SharedMorph
+    {
+        std::array<std::atomic<float>, RbfMorph::kNumParams> values {};
+        std::atomic<std::uint64_t> ownedMask { 0 };
+        std::atomic<float> puckX { 0.0f };
+        std::atomic<float> puckY { 0.0f };
+        std::atomic<std::uint32_t> seed { 1 };
+    };
+    static_assert(RbfMorph::kNumParams <= 64, "ownedMask holds one bit per morph slot");
+
+    SharedMorph morphHeard;   // audio thread -> onSaveState
+    SharedMorph morphRestore; // onRestoreState -> audio thread, under morphEpoch
+    std::atomic<int> morphRestoreProgram { 0 };
+    // Even while settled, odd while setStateInformation replaces the state.
+    // The audio thread resyncs to morphRestore (no evaluation) when it moves.
+    std::atomic<std::uint32_t> morphEpoch { 0 };
+    std::uint32_t morphSeenEpoch = 0;
     bool hasRestoredInitialState = false;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WaverProcessor)
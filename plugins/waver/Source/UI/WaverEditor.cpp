@@ -149,6 +149,31 @@ threadbare::core::NativeFunctionMap createNativeFunctions(WaverProcessor& proces
                 }
                 completion(false);
             }
+        },
+        {
+            "resetDeadlineStats",
+            [processorPtr](const juce::Array<juce::var>&, juce::WebBrowserComponent::NativeFunctionCompletion completion)
+            {
+                processorPtr->resetDeadlineStats();
+                completion({});
+            }
+        },
+        {
+            "setTraceRecording",
+            [processorPtr](const juce::Array<juce::var>& args, juce::WebBrowserComponent::NativeFunctionCompletion completion)
+            {
+                auto& session = processorPtr->getTraceSession();
+                if (args.size() >= 1)
+                    session.setRecording(static_cast<bool>(args[0]));
+                completion(session.isRecording());
+            }
+        },
+        {
+            "exportTrace",
+            [processorPtr](const juce::Array<juce::var>&, juce::WebBrowserComponent::NativeFunctionCompletion completion)
+            {
+                completion(processorPtr->getTraceSession().exportTrace().getFullPathName());
+            }
         }
     };
 }
@@ -206,7 +231,25 @@ void WaverEditor::handleUpdate()
     obj->setProperty("isRecording", transportStateIsStale ? false : state.isRecording);
     obj->setProperty("transportActive", transportStateIsStale ? false : state.transportActive);
 
+    // Morph slots show what is heard: the morph where it owns the slot,
+    // otherwise the parameter. The drawer reads them by parameter id.
+    for (std::size_t slot = 0; slot < threadbare::dsp::RbfMorph::kNumParams; ++slot)
+    {
+        const char* id = threadbare::dsp::RbfMorph::Surfaces::kParamIds[slot];
+        if (state.morph.present[slot])
+            obj->setProperty(id, state.morph.values[slot]);
+        else if (const auto* raw = processorRef.getValueTreeState().getRawParameterValue(id))
+            obj->setProperty(id, raw->load(std::memory_order_relaxed));
+    }
+
     obj->setProperty("currentPreset", processorRef.getCurrentProgram());
+    obj->setProperty("deadline", threadbare::core::WebViewBridge::deadlineSnapshotToVar(
+                                     processorRef.getDeadlineSnapshot()));
+
+   #if THREADBARE_STAGE_PROFILING
+    obj->setProperty("stageProfile", threadbare::core::WebViewBridge::stageProfileToVar(
+                                         threadbare::dsp::kWaverStageNames, state.stageProfile));
+   #endif
 
     webView.emitEventIfBrowserIsVisible("updateState", juce::JSON::toString(juce::var(obj)));
 }
@@ -8,7 +8,8 @@ const GROUPS = [
   {
     label: "shape",
     ids: [
-      "macroShape", "dcoSubLevel", "dcoSubOctave", "noiseLevel", "noiseColor",
+      "macroShape", "dcoSubLevel", "dcoSubOctave", "unisonVoices", "unisonDetune",
+      "noiseLevel", "noiseColor",
       "toyIndex", "toyRatio", "layerDco", "layerToy", "layerOrgan",
       "organ16", "organ8", "organ4", "organMix",
     ],
@@ -1,7 +1,7 @@
 // =============================================================================
 // AUTO-GENERATED FILE - DO NOT EDIT MANUALLY
 // Generated from: params.json
-// Generated at: 2026-02-25T00:57:45.920Z
+// Generated at: 2026-10-16T23:04:42.719Z
 // =============================================================================
 
 /**
@@ -134,6 +134,22 @@ export const PARAMS = {
     options: ['-1', '-2'],
     default: 0
   },
+  unisonVoices: {
+    id: 'unisonVoices',
+    name: 'unison',
+    type: 'choice',
+    options: ['1', '2', '3', '4', '5', '6', '7', '8'],
+    default: 0
+  },
+  unisonDetune: {
+    id: 'unisonDetune',
+    name: 'detune',
+    type: 'float',
+    min: 0,
+    max: 50,
+    default: 12,
+    unit: 'cents'
+  },
   noiseLevel: {
     id: 'noiseLevel',
     name: 'noise',
@@ -407,6 +423,8 @@ export const PARAM_IDS = [
   'macroShape',
   'dcoSubLevel',
   'dcoSubOctave',
+  'unisonVoices',
+  'unisonDetune',
   'noiseLevel',
   'noiseColor',
   'toyIndex',
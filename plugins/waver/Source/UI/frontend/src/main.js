@@ -5,7 +5,6 @@ import { createNativeFunctionBridge, createParamSender } from "@threadbare/bridg
 
 import { WaverViz } from "./viz.js"
 import { PARAMS, PARAM_IDS } from "./generated/params.js"
-import { interpolate, generateSigmaOffsets } from "./rbf.js"
 import { FACTORY_SURFACES, getSurfaceByIndex } from "./preset-surfaces.js"
 import { buildDrawer } from "./drawer.js"
 import { WAVER_PALETTE, applyWaverPaletteCssVars } from "./palette.js"
@@ -21,12 +20,8 @@ let morphState = {
   blend: 0.35,
 }
 
+// The puck morph itself runs in the processor; the surface here only picks axis labels.
 let activeSurface = FACTORY_SURFACES.length > 0 ? FACTORY_SURFACES[0] : null
-let momentSeed = ((Date.now() * 2654435761) >>> 0) || 1
-let sigmaOffsets = activeSurface
-  ? generateSigmaOffsets(activeSurface.landmarks.length, momentSeed)
-  : []
-let rbfThrottle = 0
 let lastLoadedPresetIndex = -1
 let arpEnabled = false
 let transportActive = false
@@ -60,38 +55,12 @@ function applyAxisLabels() {
   }
 }
 
-function applyRbfInterpolation(puckX, puckY) {
-  if (!activeSurface) return
-
-  const now = performance.now()
-  if (now - rbfThrottle < 30) return
-  rbfThrottle = now
-
-  const sigma = activeSurface.sigma ?? 0.32
-  const result = interpolate(
-    puckX,
-    puckY,
-    activeSurface.landmarks,
-    sigma,
-    sigmaOffsets,
-  )
-
-  for (const [id, value] of Object.entries(result)) {
-    if (PARAMS[id]) {
-      sendHostParam(id, value)
-    }
-  }
-}
-
 const sendParam = (id, value) => {
   if (id === "puckX" || id === "puckY" || id === "blend") {
     morphState = { ...morphState, [id]: value }
     if (typeof sendMorphSnapshotNative === "function") {
       sendMorphSnapshotNative(morphState.puckX, morphState.puckY, morphState.blend)
     }
-    if ((id === "puckX" || id === "puckY") && !arpEnabled) {
-      applyRbfInterpolation(morphState.puckX, morphState.puckY)
-    }
     if (id === "puckX" || id === "puckY") {
       sendHostParam(id, value)
     }
@@ -123,11 +92,6 @@ function onPresetLoaded(index, puckX, puckY) {
   const surface = getSurfaceByIndex(mappedSurfaceIndex)
   if (surface) {
     activeSurface = surface
-    momentSeed = (momentSeed * 1664525 + 1013904223) >>> 0
-    sigmaOffsets = generateSigmaOffsets(
-      activeSurface.landmarks.length,
-      momentSeed,
-    )
     shell?.viz?.triggerMoment?.()
 
     if (typeof puckX === 'number' && typeof puckY === 'number') {
@@ -242,8 +206,6 @@ function onArpStateChanged(nowEnabled) {
       const normY = (1 - savedPuckState.puckY) * 0.5
       shell?.controls?.setPuckPositionImmediate(normX, normY)
       shell?.controls?.renderReadoutsFromNorm(normX, normY)
-      rbfThrottle = 0
-      applyRbfInterpolation(savedPuckState.puckX, savedPuckState.puckY)
       savedPuckState = null
       isRestoringFromArp = false
     }
@@ -1,11 +1,14 @@
 // =============================================================================
 // AUTO-GENERATED FILE - DO NOT EDIT MANUALLY
 // Generated from: params.json
-// Generated at: 2026-02-25T00:57:45.914Z
+// Generated at: 2026-10-16T23:32:03.000Z
 // =============================================================================
 #pragma once
 
 #include <juce_audio_processors/juce_audio_processors.h>
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -58,6 +61,10 @@ struct WaverGeneratedParams
 
         params.push_back(std::make_unique<juce::AudioParameterChoice>("dcoSubOctave", "sub octave", juce::StringArray{ "-1", "-2" }, 0));
 
+        params.push_back(std::make_unique<juce::AudioParameterChoice>("unisonVoices", "unison", juce::StringArray{ "1", "2", "3", "4", "5", "6", "7", "8" }, 0));
+
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("unisonDetune", "detune", 0.0f, 50.0f, 12.0f));
+
         params.push_back(std::make_unique<juce::AudioParameterFloat>("noiseLevel", "noise", 0.0f, 1.0f, 0.1f));
 
         params.push_back(std::make_unique<juce::AudioParameterFloat>("noiseColor", "color", 0.0f, 1.0f, 0.35f));
@@ -154,6 +161,8 @@ struct WaverGeneratedParams
         static constexpr const char* MACRO_SHAPE = "macroShape";
         static constexpr const char* DCO_SUB_LEVEL = "dcoSubLevel";
         static constexpr const char* DCO_SUB_OCTAVE = "dcoSubOctave";
+        static constexpr const char* UNISON_VOICES = "unisonVoices";
+        static constexpr const char* UNISON_DETUNE = "unisonDetune";
         static constexpr const char* NOISE_LEVEL = "noiseLevel";
         static constexpr const char* NOISE_COLOR = "noiseColor";
         static constexpr const char* TOY_INDEX = "toyIndex";
@@ -232,6 +241,11 @@ struct WaverGeneratedParams
         static constexpr float kDCO_SUB_LEVEL_DEFAULT = 0.2f;
         static constexpr int kDCO_SUB_OCTAVE_DEFAULT = 0;
         static constexpr const char* kDCO_SUB_OCTAVE_OPTIONS = "-1,-2";
+        static constexpr int kUNISON_VOICES_DEFAULT = 0;
+        static constexpr const char* kUNISON_VOICES_OPTIONS = "1,2,3,4,5,6,7,8";
+        static constexpr float kUNISON_DETUNE_MIN = 0.0f;
+        static constexpr float kUNISON_DETUNE_MAX = 50.0f;
+        static constexpr float kUNISON_DETUNE_DEFAULT = 12.0f;
         static constexpr float kNOISE_LEVEL_MIN = 0.0f;
         static constexpr float kNOISE_LEVEL_MAX = 1.0f;
         static constexpr float kNOISE_LEVEL_DEFAULT = 0.1f;
@@ -325,6 +339,189 @@ struct WaverGeneratedParams
         static constexpr float kPRINT_MIX_MAX = 1.0f;
         static constexpr float kPRINT_MIX_DEFAULT = 0.75f;
     };
+
+    // Parameter indices in definition order
+    enum class Index : int
+    {
+        puckX,
+        puckY,
+        blend,
+        momentSeed,
+        momentTrigger,
+        arpEnabled,
+        outputGain,
+        qualityMode,
+        filterCutoff,
+        filterRes,
+        filterMode,
+        filterKeyTrack,
+        envToFilter,
+        macroShape,
+        dcoSubLevel,
+        dcoSubOctave,
+        unisonVoices,
+        unisonDetune,
+        noiseLevel,
+        noiseColor,
+        toyIndex,
+        toyRatio,
+        layerDco,
+        layerToy,
+        layerOrgan,
+        organ16,
+        organ8,
+        organ4,
+        organMix,
+        lfoRate,
+        lfoShape,
+        lfoToVibrato,
+        lfoToPwm,
+        chorusMode,
+        driftAmount,
+        stereoWidth,
+        portaTime,
+        portaMode,
+        envAttack,
+        envDecay,
+        envSustain,
+        envRelease,
+        driveGain,
+        tapeSat,
+        wowDepth,
+        flutterDepth,
+        hissLevel,
+        humFreq,
+        printMix,
+    };
+
+    static constexpr std::size_t kNumParams = 49;
+
+    static constexpr std::array<const char*, kNumParams> kIdsByIndex {
+        "puckX",
+        "puckY",
+        "blend",
+        "momentSeed",
+        "momentTrigger",
+        "arpEnabled",
+        "outputGain",
+        "qualityMode",
+        "filterCutoff",
+        "filterRes",
+        "filterMode",
+        "filterKeyTrack",
+        "envToFilter",
+        "macroShape",
+        "dcoSubLevel",
+        "dcoSubOctave",
+        "unisonVoices",
+        "unisonDetune",
+        "noiseLevel",
+        "noiseColor",
+        "toyIndex",
+        "toyRatio",
+        "layerDco",
+        "layerToy",
+        "layerOrgan",
+        "organ16",
+        "organ8",
+        "organ4",
+        "organMix",
+        "lfoRate",
+        "lfoShape",
+        "lfoToVibrato",
+        "lfoToPwm",
+        "chorusMode",
+        "driftAmount",
+        "stereoWidth",
+        "portaTime",
+        "portaMode",
+        "envAttack",
+        "envDecay",
+        "envSustain",
+        "envRelease",
+        "driveGain",
+        "tapeSat",
+        "wowDepth",
+        "flutterDepth",
+        "hissLevel",
+        "humFreq",
+        "printMix",
+    };
+
+    // Raw value pointers resolved once against the APVTS; reads on the audio
+    // thread are relaxed atomic loads with no string-keyed lookup.
+    class ParamCache
+    {
+    public:
+        explicit ParamCache(juce::AudioProcessorValueTreeState& apvts)
+        {
+            for (std::size_t i = 0; i < kNumParams; ++i)
+            {
+                values[i] = apvts.getRawParameterValue(kIdsByIndex[i]);
+                jassert(values[i] != nullptr);
+            }
+        }
+
+        float get(Index index) const noexcept
+        {
+            return values[static_cast<std::size_t>(index)]->load(std::memory_order_relaxed);
+        }
+
+        std::atomic<float>* raw(Index index) const noexcept { return values[static_cast<std::size_t>(index)]; }
+
+        float puckX() const noexcept { return get(Index::puckX); }
+        float puckY() const noexcept { return get(Index::puckY); }
+        float blend() const noexcept { return get(Index::blend); }
+        float momentSeed() const noexcept { return get(Index::momentSeed); }
+        bool momentTrigger() const noexcept { return get(Index::momentTrigger) > 0.5f; }
+        bool arpEnabled() const noexcept { return get(Index::arpEnabled) > 0.5f; }
+        float outputGain() const noexcept { return get(Index::outputGain); }
+        int qualityMode() const noexcept { return static_cast<int>(get(Index::qualityMode)); }
+        float filterCutoff() const noexcept { return get(Index::filterCutoff); }
+        float filterRes() const noexcept { return get(Index::filterRes); }
+        int filterMode() const noexcept { return static_cast<int>(get(Index::filterMode)); }
+        float filterKeyTrack() const noexcept { return get(Index::filterKeyTrack); }
+        float envToFilter() const noexcept { return get(Index::envToFilter); }
+        float macroShape() const noexcept { return get(Index::macroShape); }
+        float dcoSubLevel() const noexcept { return get(Index::dcoSubLevel); }
+        int dcoSubOctave() const noexcept { return static_cast<int>(get(Index::dcoSubOctave)); }
+        int unisonVoices() const noexcept { return static_cast<int>(get(Index::unisonVoices)); }
+        float unisonDetune() const noexcept { return get(Index::unisonDetune); }
+        float noiseLevel() const noexcept { return get(Index::noiseLevel); }
+        float noiseColor() const noexcept { return get(Index::noiseColor); }
+        float toyIndex() const noexcept { return get(Index::toyIndex); }
+        float toyRatio() const noexcept { return get(Index::toyRatio); }
+        float layerDco() const noexcept { return get(Index::layerDco); }
+        float layerToy() const noexcept { return get(Index::layerToy); }
+        float layerOrgan() const noexcept { return get(Index::layerOrgan); }
+        float organ16() const noexcept { return get(Index::organ16); }
+        float organ8() const noexcept { return get(Index::organ8); }
+        float organ4() const noexcept { return get(Index::organ4); }
+        float organMix() const noexcept { return get(Index::organMix); }
+        float lfoRate() const noexcept { return get(Index::lfoRate); }
+        int lfoShape() const noexcept { return static_cast<int>(get(Index::lfoShape)); }
+        float lfoToVibrato() const noexcept { return get(Index::lfoToVibrato); }
+        float lfoToPwm() const noexcept { return get(Index::lfoToPwm); }
+        int chorusMode() const noexcept { return static_cast<int>(get(Index::chorusMode)); }
+        float driftAmount() const noexcept { return get(Index::driftAmount); }
+        float stereoWidth() const noexcept { return get(Index::stereoWidth); }
+        float portaTime() const noexcept { return get(Index::portaTime); }
+        int portaMode() const noexcept { return static_cast<int>(get(Index::portaMode)); }
+        float envAttack() const noexcept { return get(Index::envAttack); }
+        float envDecay() const noexcept { return get(Index::envDecay); }
+        float envSustain() const noexcept { return get(Index::envSustain); }
+        float envRelease() const noexcept { return get(Index::envRelease); }
+        float driveGain() const noexcept { return get(Index::driveGain); }
+        float tapeSat() const noexcept { return get(Index::tapeSat); }
+        float wowDepth() const noexcept { return get(Index::wowDepth); }
+        float flutterDepth() const noexcept { return get(Index::flutterDepth); }
+        float hissLevel() const noexcept { return get(Index::hissLevel); }
+        int humFreq() const noexcept { return static_cast<int>(get(Index::humFreq)); }
+        float printMix() const noexcept { return get(Index::printMix); }
+
+    private:
+        std::array<std::atomic<float>*, kNumParams> values {};
+    };
 };
 
 } // namespace threadbare::waver
@@ -0,0 +1,428 @@
+// =============================================================================
+// AUTO-GENERATED FILE - DO NOT EDIT MANUALLY
+// Generated from: preset-surfaces.js
+// Generated at: 2026-10-16T23:36:13.937Z
+// =============================================================================
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+namespace threadbare::waver
+{
+
+struct WaverMorphSurfaces
+{
+    enum class Scale : std::uint8_t
+    {
+        linear,
+        log,
+        logMs,
+        choice
+    };
+
+    static constexpr std::size_t kNumParams = 33;
+    static constexpr std::size_t kMaxLandmarksPerSurface = 8;
+
+    // Marks a parameter a landmark does not set.
+    static constexpr float kUnset = std::numeric_limits<float>::quiet_NaN();
+
+    static constexpr std::array<const char*, kNumParams> kParamIds {
+        "macroShape",
+        "filterCutoff",
+        "filterRes",
+        "layerDco",
+        "layerToy",
+        "layerOrgan",
+        "dcoSubLevel",
+        "noiseLevel",
+        "lfoRate",
+        "lfoToPwm",
+        "lfoToVibrato",
+        "chorusMode",
+        "driftAmount",
+        "envAttack",
+        "envDecay",
+        "envSustain",
+        "envRelease",
+        "driveGain",
+        "tapeSat",
+        "wowDepth",
+        "flutterDepth",
+        "hissLevel",
+        "printMix",
+        "outputGain",
+        "organ16",
+        "organ8",
+        "organ4",
+        "organMix",
+        "portaTime",
+        "portaMode",
+        "filterMode",
+        "toyIndex",
+        "toyRatio",
+    };
+
+    static constexpr std::array<Scale, kNumParams> kParamScales {
+        Scale::linear, // macroShape
+        Scale::log, // filterCutoff
+        Scale::linear, // filterRes
+        Scale::linear, // layerDco
+        Scale::linear, // layerToy
+        Scale::linear, // layerOrgan
+        Scale::linear, // dcoSubLevel
+        Scale::linear, // noiseLevel
+        Scale::log, // lfoRate
+        Scale::linear, // lfoToPwm
+        Scale::linear, // lfoToVibrato
+        Scale::choice, // chorusMode
+        Scale::linear, // driftAmount
+        Scale::log, // envAttack
+        Scale::log, // envDecay
+        Scale::linear, // envSustain
+        Scale::log, // envRelease
+        Scale::linear, // driveGain
+        Scale::linear, // tapeSat
+        Scale::linear, // wowDepth
+        Scale::linear, // flutterDepth
+        Scale::linear, // hissLevel
+        Scale::linear, // printMix
+        Scale::linear, // outputGain
+        Scale::linear, // organ16
+        Scale::linear, // organ8
+        Scale::linear, // organ4
+        Scale::linear, // organMix
+        Scale::logMs, // portaTime
+        Scale::choice, // portaMode
+        Scale::choice, // filterMode
+        Scale::linear, // toyIndex
+        Scale::linear, // toyRatio
+    };
+
+    static constexpr int indexOf(std::string_view id) noexcept
+    {
+        for (std::size_t i = 0; i < kNumParams; ++i)
+        {
+            if (id == kParamIds[i])
+                return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    // Raw parameter values, in kParamIds order.
+    struct Landmark
+    {
+        float x = 0.0f;
+        float y = 0.0f;
+        std::array<float, kNumParams> values {};
+    };
+
+    struct Surface
+    {
+        const char* name = "";
+        float sigma = 0.32f;
+        std::size_t firstLandmark = 0;
+        std::size_t numLandmarks = 0;
+    };
+
+    static constexpr std::array<Landmark, 40> kLandmarks {{
+        // Settle
+        { -0.7f, -0.7f, { // warm center
+            0.1f, 2200.0f, 0.12f, 0.85f, 0.05f, 0.1f, 0.3f, 0.01f,
+            1.5f, 0.08f, 2.0f, 1.0f, 0.2f, 0.5f, 2.0f, 0.75f,
+            3.0f, 0.02f, 0.1f, 0.05f, 0.02f, 0.03f, 0.5f, 0.0f,
+            kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, kUnset,
+            kUnset,
+        } },
+        { 0.0f, -0.7f, { // soft bright
+            0.35f, 5000.0f, 0.18f, 0.8f, 0.1f, 0.05f, 0.2f, 0.02f,
+            2.0f, 0.12f, 3.0f, 1.0f, 0.25f, 0.4f, 1.8f, 0.7f,
+            2.5f, 0.05f, 0.12f, 0.06f, 0.02f, 0.04f, 0.55f, 0.0f,
+            kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, kUnset,
+            kUnset,
+        } },
+        { 0.7f, -0.7f, { // present shimmer
+            0.55f, 8000.0f, 0.22f, 0.7f, 0.2f, 0.0f, 0.15f, 0.03f,
+            2.5f, 0.2f, 5.0f, 2.0f, 0.3f, 0.3f, 1.5f, 0.65f,
+            2.0f, 0.08f, 0.15f, 0.08f, 0.03f, 0.05f, 0.6f, -1.0f,
+            kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, kUnset,
+            kUnset,
+        } },
+        { -0.7f, 0.0f, { // muffled warmth
+            0.08f, 1500.0f, 0.1f, 0.8f, 0.0f, 0.2f, 0.4f, 0.02f,
+            0.8f, 0.05f, 2.0f, 1.0f, 0.35f, 0.8f, 2.5f, 0.7f,
+            4.0f, 0.03f, 0.2f, 0.1f, 0.03f, 0.06f, 0.65f, 0.0f,
+            5.0f, 4.0f, 1.0f, 2.0f, kUnset, kUnset, kUnset, kUnset,
+            kUnset,
+        } },
+        { 0.7f, 0.0f, { // golden drive
+            0.5f, 6000.0f, 0.28f, 0.65f, 0.2f, 0.1f, 0.2f, 0.04f,
+            3.0f, 0.25f, 6.0f, 2.0f, 0.4f, 0.3f, 1.5f, 0.6f,
+            2.5f, 0.12f, 0.25f, 0.1f, 0.04f, 0.07f, 0.7f, -1.0f,
+            kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, kUnset,
+            kUnset,
+        } },
+        { -0.7f, 0.7f, { // dusty lullaby
+            0.05f, 1200.0f, 0.08f, 0.7f, 0.0f, 0.3f, 0.45f, 0.03f,
+            0.5f, 0.0f, 2.0f, 1.0f, 0.6f, 1.2f, 3.0f, 0.65f,
+            5.0f, 0.05f, 0.3f, 0.2f, 0.06f, 0.1f, 0.8f, -1.0f,
+            6.0f, 5.0f, 2.0f, 3.0f, kUnset, kUnset, kUnset, kUnset,
+            kUnset,
+        } },
+        { 0.0f, 0.7f, { // worn amber
+            0.25f, 2800.0f, 0.18f, 0.6f, 0.1f, 0.25f, 0.35f, 0.05f,
+            1.2f, 0.1f, 4.0f, 3.0f, 0.7f, 0.8f, 2.5f, 0.6f,
+            4.5f, 0.1f, 0.3f, 0.2f, 0.08f, 0.12f, 0.8f, -2.0f,
+            4.0f, 5.0f, 2.0f, 3.0f, kUnset, kUnset, kUnset, kUnset,
+            kUnset,
+        } },
+        { 0.7f, 0.7f, { // golden decay
+            0.4f, 4500.0f, 0.25f, 0.55f, 0.15f, 0.2f, 0.25f, 0.06f,
+            2.0f, 0.2f, 8.0f, 3.0f, 0.8f, 0.6f, 2.0f, 0.55f,
+            4.0f, 0.1f, 0.28f, 0.18f, 0.07f, 0.15f, 0.76f, -2.0f,
+            3.0f, 4.0f, 2.0f, 2.0f, kUnset, kUnset, kUnset, kUnset,
+            kUnset,
+        } },
+        // Wander
+        { -0.7f, -0.7f, { // steady saw
+            0.15f, 4000.0f, 0.25f, 0.9f, 0.0f, 0.0f, 0.15f, 0.02f,
+            0.3f, 0.15f, 5.0f, 1.0f, 0.4f, 0.4f, 1.5f, 0.65f,
+            2.5f, 0.03f, 0.1f, 0.08f, 0.03f, 0.04f, 0.55f, 0.0f,
+            kUnset, kUnset, kUnset, kUnset, 150.0f, 0.0f, kUnset, kUnset,
+            kUnset,
+        } },
+        { 0.0f, -0.7f, { // pulse drift
+            0.45f, 5500.0f, 0.3f, 0.85f, 0.1f, 0.0f, 0.1f, 0.03f,
+            2.0f, 0.35f, 10.0f, 2.0f, 0.55f, 0.3f, 1.2f, 0.55f,
+            2.0f, 0.08f, 0.15f, 0.1f, 0.04f, 0.06f, 0.6f, 0.0f,
+            kUnset, kUnset, kUnset, kUnset, 200.0f, 0.0f, kUnset, kUnset,
+            kUnset,
+        } },
+        { 0.7f, -0.7f, { // bright motion
+            0.7f, 8000.0f, 0.35f, 0.75f, 0.2f, 0.0f, 0.05f, 0.04f,
+            4.0f, 0.45f, 15.0f, 2.0f, 0.65f, 0.2f, 1.0f, 0.5f,
+            1.5f, 0.12f, 0.2f, 0.12f, 0.05f, 0.07f, 0.65f, -1.0f,
+            kUnset, kUnset, kUnset, kUnset, 250.0f, 0.0f, kUnset, kUnset,
+            kUnset,
+        } },
+        { -0.7f, 0.0f, { // slow chorus
+            0.2f, 3000.0f, 0.2f, 0.8f, 0.05f, 0.1f, 0.25f, 0.03f,
+            0.5f, 0.2f, 8.0f, 3.0f, 0.6f, 0.6f, 2.0f, 0.6f,
+            3.5f, 0.05f, 0.2f, 0.15f, 0.05f, 0.06f, 0.65f, 0.0f,
+            kUnset, kUnset, kUnset, kUnset, 200.0f, 0.0f, kUnset, kUnset,
+            kUnset,
+        } },
+        { 0.7f, 0.0f, { // swirl
+            0.6f, 7000.0f, 0.35f, 0.65f, 0.25f, 0.05f, 0.1f, 0.05f,
+            5.0f, 0.5f, 20.0f, 3.0f, 0.75f, 0.2f, 1.0f, 0.45f,
+            2.0f, 0.12f, 0.3f, 0.18f, 0.07f, 0.08f, 0.75f, -1.0f,
+            kUnset, kUnset, kUnset, kUnset, 350.0f, 0.0f, kUnset, kUnset,
+            kUnset,
+        } },
+        { -0.7f, 0.7f, { // deep wander
+            0.1f, 1800.0f, 0.15f, 0.7f, 0.0f, 0.2f, 0.4f, 0.04f,
+            0.3f, 0.1f, 6.0f, 3.0f, 0.85f, 1.0f, 3.0f, 0.55f,
+            5.0f, 0.06f, 0.3f, 0.2f, 0.08f, 0.1f, 0.8f, -1.0f,
+            5.0f, 4.0f, 1.0f, 2.0f, 300.0f, 0.0f, kUnset, kUnset,
+            kUnset,
+        } },
+        { 0.0f, 0.7f, { // detuned haze
+            0.35f, 3500.0f, 0.3f, 0.6f, 0.15f, 0.15f, 0.3f, 0.06f,
+            1.5f, 0.3f, 12.0f, 3.0f, 0.9f, 0.7f, 2.5f, 0.5f,
+            4.5f, 0.08f, 0.27f, 0.16f, 0.06f, 0.12f, 0.74f, -2.0f,
+            4.0f, 3.0f, 1.0f, 2.0f, 350.0f, 0.0f, kUnset, kUnset,
+            kUnset,
+        } },
+        { 0.7f, 0.7f, { // bright decay
+            0.55f, 6000.0f, 0.4f, 0.55f, 0.2f, 0.1f, 0.15f, 0.08f,
+            3.5f, 0.4f, 18.0f, 3.0f, 0.95f, 0.4f, 2.0f, 0.4f,
+            3.5f, 0.08f, 0.26f, 0.16f, 0.06f, 0.15f, 0.72f, -2.0f,
+            kUnset, kUnset, kUnset, kUnset, 400.0f, 0.0f, kUnset, kUnset,
+            kUnset,
+        } },
+        // Close
+        { -0.7f, -0.7f, { // bare whisper
+            0.0f, 1500.0f, 0.05f, 0.6f, 0.0f, 0.0f, 0.5f, 0.0f,
+            0.4f, 0.0f, 1.0f, 0.0f, 0.1f, 0.06f, 0.6f, 0.3f,
+            1.2f, 0.0f, 0.05f, 0.02f, 0.01f, 0.02f, 0.35f, -3.0f,
+            kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, 1.0f, kUnset,
+            kUnset,
+        } },
+        { 0.0f, -0.7f, { // lo-fi keys
+            0.2f, 2500.0f, 0.1f, 0.5f, 0.0f, 0.0f, 0.35f, 0.01f,
+            0.8f, 0.0f, 2.0f, 0.0f, 0.15f, 0.03f, 0.8f, 0.25f,
+            1.0f, 0.02f, 0.08f, 0.03f, 0.01f, 0.03f, 0.4f, -2.0f,
+            kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, 1.0f, kUnset,
+            kUnset,
+        } },
+        { 0.7f, -0.7f, { // thin signal
+            0.5f, 4000.0f, 0.12f, 0.45f, 0.15f, 0.0f, 0.1f, 0.02f,
+            1.5f, 0.08f, 3.0f, 0.0f, 0.2f, 0.01f, 0.5f, 0.2f,
+            0.8f, 0.04f, 0.1f, 0.04f, 0.02f, 0.04f, 0.45f, -2.0f,
+            kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, 0.0f, kUnset,
+            kUnset,
+        } },
+        { -0.7f, 0.0f, { // intimate pad
+            0.05f, 1200.0f, 0.08f, 0.55f, 0.0f, 0.15f, 0.45f, 0.01f,
+            0.3f, 0.0f, 1.5f, 1.0f, 0.2f, 1.0f, 2.0f, 0.5f,
+            3.0f, 0.01f, 0.12f, 0.06f, 0.02f, 0.05f, 0.5f, -2.0f,
+            3.0f, 4.0f, 0.0f, 1.0f, kUnset, kUnset, 1.0f, kUnset,
+            kUnset,
+        } },
+        { 0.7f, 0.0f, { // bright hush
+            0.4f, 3500.0f, 0.15f, 0.4f, 0.1f, 0.0f, 0.15f, 0.02f,
+            2.0f, 0.1f, 4.0f, 1.0f, 0.25f, 0.02f, 0.5f, 0.2f,
+            0.6f, 0.05f, 0.12f, 0.05f, 0.02f, 0.04f, 0.5f, -3.0f,
+            kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, 0.0f, kUnset,
+            kUnset,
+        } },
+        { -0.7f, 0.7f, { // worn tape
+            0.0f, 900.0f, 0.06f, 0.5f, 0.0f, 0.2f, 0.5f, 0.02f,
+            0.2f, 0.0f, 1.0f, 1.0f, 0.4f, 1.5f, 3.0f, 0.45f,
+            5.0f, 0.02f, 0.25f, 0.15f, 0.04f, 0.08f, 0.7f, -2.0f,
+            4.0f, 3.0f, 0.0f, 1.0f, kUnset, kUnset, 1.0f, kUnset,
+            kUnset,
+        } },
+        { 0.0f, 0.7f, { // cassette hymn
+            0.15f, 1800.0f, 0.1f, 0.4f, 0.0f, 0.25f, 0.4f, 0.03f,
+            0.5f, 0.0f, 2.0f, 1.0f, 0.5f, 1.0f, 2.5f, 0.5f,
+            5.0f, 0.04f, 0.3f, 0.2f, 0.06f, 0.1f, 0.75f, -2.0f,
+            4.0f, 4.0f, 1.0f, 2.0f, kUnset, kUnset, 1.0f, kUnset,
+            kUnset,
+        } },
+        { 0.7f, 0.7f, { // fading signal
+            0.35f, 2500.0f, 0.12f, 0.35f, 0.1f, 0.1f, 0.2f, 0.05f,
+            1.2f, 0.08f, 4.0f, 1.0f, 0.55f, 0.5f, 1.5f, 0.35f,
+            3.0f, 0.06f, 0.3f, 0.2f, 0.06f, 0.1f, 0.75f, -3.0f,
+            kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, 0.0f, kUnset,
+            kUnset,
+        } },
+        // Flicker
+        { -0.7f, -0.7f, { // clean toy
+            0.5f, 8000.0f, 0.1f, 0.2f, 0.75f, 0.0f, 0.0f, 0.0f,
+            4.0f, 0.0f, 0.0f, 0.0f, 0.1f, 0.003f, 0.3f, 0.15f,
+            0.2f, 0.02f, 0.08f, 0.02f, 0.01f, 0.02f, 0.4f, 0.0f,
+            kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, 0.3f,
+            0.3f,
+        } },
+        { 0.0f, -0.7f, { // fm bell
+            0.6f, 12000.0f, 0.15f, 0.15f, 0.8f, 0.0f, 0.0f, 0.01f,
+            5.0f, 0.0f, 2.0f, 0.0f, 0.12f, 0.001f, 0.8f, 0.0f,
+            0.6f, 0.05f, 0.1f, 0.03f, 0.01f, 0.03f, 0.45f, 0.0f,
+            kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, 0.6f,
+            0.5f,
+        } },
+        { 0.7f, -0.7f, { // sharp lead
+            0.85f, 10000.0f, 0.4f, 0.8f, 0.1f, 0.0f, 0.3f, 0.0f,
+            6.0f, 0.3f, 5.0f, 0.0f, 0.15f, 0.005f, 0.4f, 0.6f,
+            0.3f, 0.12f, 0.08f, 0.02f, 0.01f, 0.02f, 0.35f, 1.0f,
+            kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, kUnset,
+            kUnset,
+        } },
+        { -0.7f, 0.0f, { // muted pluck
+            0.3f, 3500.0f, 0.12f, 0.3f, 0.6f, 0.0f, 0.1f, 0.01f,
+            3.0f, 0.0f, 1.0f, 1.0f, 0.2f, 0.002f, 0.5f, 0.1f,
+            0.4f, 0.04f, 0.15f, 0.05f, 0.02f, 0.04f, 0.5f, 0.0f,
+            kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, 0.4f,
+            0.4f,
+        } },
+        { 0.7f, 0.0f, { // bright fm
+            0.75f, 14000.0f, 0.2f, 0.1f, 0.85f, 0.0f, 0.0f, 0.02f,
+            7.0f, 0.0f, 3.0f, 1.0f, 0.2f, 0.001f, 0.6f, 0.25f,
+            0.5f, 0.1f, 0.15f, 0.04f, 0.02f, 0.04f, 0.5f, 0.0f,
+            kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, 0.7f,
+            0.6f,
+        } },
+        { -0.7f, 0.7f, { // dusty toy
+            0.4f, 2500.0f, 0.1f, 0.2f, 0.65f, 0.1f, 0.15f, 0.03f,
+            2.0f, 0.0f, 3.0f, 1.0f, 0.45f, 0.01f, 0.5f, 0.15f,
+            0.5f, 0.06f, 0.3f, 0.12f, 0.04f, 0.08f, 0.65f, -1.0f,
+            kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, 0.5f,
+            0.4f,
+        } },
+        { 0.0f, 0.7f, { // worn bell
+            0.55f, 5000.0f, 0.18f, 0.15f, 0.7f, 0.05f, 0.05f, 0.04f,
+            3.5f, 0.0f, 5.0f, 1.0f, 0.5f, 0.002f, 1.0f, 0.0f,
+            0.8f, 0.08f, 0.3f, 0.12f, 0.05f, 0.08f, 0.7f, -1.0f,
+            kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, 0.6f,
+            0.5f,
+        } },
+        { 0.7f, 0.7f, { // glitched lead
+            0.8f, 7000.0f, 0.35f, 0.5f, 0.35f, 0.0f, 0.2f, 0.05f,
+            8.0f, 0.3f, 8.0f, 2.0f, 0.6f, 0.003f, 0.3f, 0.5f,
+            0.3f, 0.12f, 0.3f, 0.15f, 0.06f, 0.1f, 0.7f, -1.0f,
+            kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, kUnset, 0.8f,
+            0.7f,
+        } },
+        // Anchor
+        { -0.7f, -0.7f, { // deep organ
+            0.0f, 1000.0f, 0.2f, 0.3f, 0.0f, 0.8f, 0.6f, 0.0f,
+            0.5f, 0.0f, 1.0f, 1.0f, 0.25f, 0.1f, 1.0f, 0.85f,
+            2.0f, 0.1f, 0.2f, 0.08f, 0.03f, 0.05f, 0.6f, -1.0f,
+            8.0f, 6.0f, 2.0f, 4.0f, kUnset, kUnset, 1.0f, kUnset,
+            kUnset,
+        } },
+        { 0.0f, -0.7f, { // full organ
+            0.0f, 2500.0f, 0.15f, 0.1f, 0.0f, 0.9f, 0.3f, 0.0f,
+            0.8f, 0.0f, 0.0f, 2.0f, 0.3f, 0.01f, 0.5f, 0.9f,
+            1.5f, 0.08f, 0.25f, 0.1f, 0.04f, 0.06f, 0.65f, -1.0f,
+            7.0f, 8.0f, 5.0f, 6.0f, kUnset, kUnset, 0.0f, kUnset,
+            kUnset,
+        } },
+        { 0.7f, -0.7f, { // bright foundation
+            0.3f, 5000.0f, 0.25f, 0.5f, 0.0f, 0.6f, 0.4f, 0.01f,
+            1.5f, 0.1f, 2.0f, 2.0f, 0.3f, 0.05f, 0.8f, 0.8f,
+            1.5f, 0.12f, 0.2f, 0.08f, 0.03f, 0.05f, 0.6f, 0.0f,
+            6.0f, 7.0f, 4.0f, 5.0f, kUnset, kUnset, 0.0f, kUnset,
+            kUnset,
+        } },
+        { -0.7f, 0.0f, { // sub drone
+            0.0f, 600.0f, 0.3f, 0.5f, 0.0f, 0.7f, 0.7f, 0.0f,
+            0.2f, 0.0f, 0.5f, 1.0f, 0.4f, 0.3f, 1.5f, 0.9f,
+            3.0f, 0.12f, 0.3f, 0.12f, 0.04f, 0.06f, 0.7f, -1.0f,
+            8.0f, 5.0f, 1.0f, 3.0f, kUnset, kUnset, 1.0f, kUnset,
+            kUnset,
+        } },
+        { 0.7f, 0.0f, { // gritty organ
+            0.2f, 4000.0f, 0.2f, 0.3f, 0.05f, 0.75f, 0.3f, 0.02f,
+            1.0f, 0.0f, 1.0f, 2.0f, 0.45f, 0.01f, 0.5f, 0.9f,
+            1.0f, 0.12f, 0.3f, 0.12f, 0.05f, 0.08f, 0.7f, -1.0f,
+            7.0f, 8.0f, 5.0f, 6.0f, kUnset, kUnset, 0.0f, kUnset,
+            kUnset,
+        } },
+        { -0.7f, 0.7f, { // worn floor
+            0.0f, 800.0f, 0.15f, 0.4f, 0.0f, 0.7f, 0.65f, 0.02f,
+            0.3f, 0.0f, 1.0f, 1.0f, 0.6f, 0.5f, 2.0f, 0.8f,
+            4.0f, 0.12f, 0.3f, 0.2f, 0.07f, 0.1f, 0.8f, -2.0f,
+            8.0f, 6.0f, 2.0f, 4.0f, kUnset, kUnset, 1.0f, kUnset,
+            kUnset,
+        } },
+        { 0.0f, 0.7f, { // aged mass
+            0.1f, 1500.0f, 0.2f, 0.2f, 0.0f, 0.85f, 0.5f, 0.03f,
+            0.5f, 0.0f, 1.0f, 2.0f, 0.7f, 0.2f, 1.5f, 0.85f,
+            3.5f, 0.08f, 0.27f, 0.16f, 0.06f, 0.12f, 0.74f, -2.0f,
+            8.0f, 7.0f, 4.0f, 5.0f, kUnset, kUnset, 1.0f, kUnset,
+            kUnset,
+        } },
+        { 0.7f, 0.7f, { // heavy print
+            0.25f, 3000.0f, 0.25f, 0.35f, 0.05f, 0.7f, 0.4f, 0.05f,
+            1.0f, 0.05f, 2.0f, 3.0f, 0.8f, 0.1f, 1.0f, 0.85f,
+            3.0f, 0.08f, 0.26f, 0.16f, 0.06f, 0.15f, 0.74f, -3.0f,
+            7.0f, 8.0f, 5.0f, 6.0f, kUnset, kUnset, 0.0f, kUnset,
+            kUnset,
+        } },
+    }};
+
+    static constexpr std::array<Surface, 5> kSurfaces {{
+        { "Settle", 0.32f, 0, 8 },
+        { "Wander", 0.35f, 8, 8 },
+        { "Close", 0.3f, 16, 8 },
+        { "Flicker", 0.3f, 24, 8 },
+        { "Anchor", 0.35f, 32, 8 },
+    }};
+};
+
+} // namespace threadbare::waver
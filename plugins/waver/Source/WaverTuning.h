@@ -12,7 +12,7 @@ struct RateDependent
     double sampleRate = 44100.0;
     double sampleRateInverse = 1.0 / 44100.0;
 
-    // Ornstein-Uhlenbeck (44.1 kHz baseline in spec).
+    // Ornstein-Uhlenbeck step at the host rate (44.1 kHz baseline in spec).
     float ouAlpha = 0.9991f;
     float ouBeta = 0.042f;
 
@@ -49,19 +49,40 @@ inline constexpr float kArpSwingMin = 0.0f;
 inline constexpr float kArpSwingMax = 0.35f;
 inline constexpr std::uint32_t kArpMaxHeldNotes = 16;
 
+// Drift and the voice LFO advance at a fixed control rate (44.1 kHz / 16)
+// and are interpolated per sample, so the OU step is host-rate independent.
+inline constexpr double kModulationControlRateHz = 44100.0 / 16.0;
+
+// Minimum spacing between puck morph evaluations on the audio thread.
+inline constexpr double kMorphIntervalSeconds = 0.005;
+
 inline constexpr float kPuckXToRateExp = 1.5f;
 inline constexpr float kPuckYToGateExp = 1.15f;
 
+struct OuCoefficients
+{
+    float alpha = 0.9991f;
+    float beta = 0.042f;
+};
+
+// OU coefficients for one step spanning `referenceSteps` steps of the 44.1 kHz
+// baseline: alpha^n mean reversion, sqrt(n) noise injection.
+inline OuCoefficients ouCoefficients(double referenceSteps) noexcept
+{
+    return { static_cast<float>(std::pow(0.9991, referenceSteps)),
+             static_cast<float>(0.042 * std::sqrt(referenceSteps)) };
+}
+
 inline RateDependent recalculate(double sampleRate) noexcept
 {
     RateDependent r;
     r.sampleRate = std::max(1.0, sampleRate);
     r.sampleRateInverse = 1.0 / r.sampleRate;
 
-    // Scale OU dynamics relative to 44.1k baseline.
-    const double srRatio = r.sampleRate / 44100.0;
-    r.ouAlpha = static_cast<float>(std::pow(0.9991, srRatio));
-    r.ouBeta = static_cast<float>(0.042 * std::sqrt(srRatio));
+    // Per-host-sample OU step: one host sample spans 44.1k / sr baseline steps.
+    const auto ou = ouCoefficients(44100.0 / r.sampleRate);
+    r.ouAlpha = ou.alpha;
+    r.ouBeta = ou.beta;
 
     const auto onePoleFromHz = [sr = r.sampleRate](double hz) {
         return static_cast<float>(std::exp((-2.0 * std::numbers::pi * hz) / sr));
@@ -0,0 +1,72 @@
+#include "BackgroundWorker.h"
+
+#include <algorithm>
+
+namespace threadbare::core
+{
+
+BackgroundWorker::Runner::Runner(BackgroundWorker& ownerIn)
+    : juce::Thread("Threadbare background worker"), owner(ownerIn)
+{
+}
+
+void BackgroundWorker::Runner::run()
+{
+    while (!threadShouldExit())
+    {
+        const auto seen = owner.signal.current();
+        owner.runJobs();
+
+        for (int polls = 0; polls < kPollsBeforeParking && owner.signal.current() == seen; ++polls)
+        {
+            if (threadShouldExit())
+                return;
+            sleep(kPollIntervalMs);
+        }
+
+        if (threadShouldExit())
+            break;
+
+        if (owner.signal.current() == seen)
+            owner.signal.waitPast(seen);
+    }
+}
+
+BackgroundWorker::BackgroundWorker()
+    : runner(*this)
+{
+    runner.startThread(juce::Thread::Priority::low);
+}
+
+BackgroundWorker::~BackgroundWorker()
+{
+    runner.signalThreadShouldExit();
+    signal.notify();
+    runner.stopThread(2000);
+}
+
+void BackgroundWorker::add(Job& job)
+{
+    {
+        const juce::ScopedLock sl(lock);
+        jobs.push_back(&job);
+    }
+
+    // Picks up anything the job queued before it was registered.
+    signal.notify();
+}
+
+void BackgroundWorker::remove(Job& job)
+{
+    const juce::ScopedLock sl(lock);
+    std::erase(jobs, &job);
+}
+
+void BackgroundWorker::runJobs()
+{
+    const juce::ScopedLock sl(lock);
+    for (auto* job : jobs)
+        job->runJob();
+}
+
+} // namespace threadbare::core
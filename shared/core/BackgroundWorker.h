@@ -0,0 +1,67 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <vector>
+
+#include "WorkSignal.h"
+
+namespace threadbare::core
+{
+
+/**
+ * BackgroundWorker: one low-priority thread for audio-side housekeeping.
+ *
+ * Held through juce::SharedResourcePointer, so every Threadbare instance in
+ * a host shares the same thread. Processors register Jobs on the message
+ * thread and hand their DSP the signal; the DSP calls notify() when it has
+ * work queued and the thread runs every job once. After a run it polls the
+ * signal for a short while, so work queued every block (drawbars following
+ * a sweep) never costs the audio thread a wake-up syscall, then parks, so an
+ * idle session costs no wake-ups.
+ */
+class BackgroundWorker
+{
+public:
+    struct Job
+    {
+        virtual ~Job() = default;
+
+        /** Worker thread. Should return quickly when there is nothing to do. */
+        virtual void runJob() = 0;
+    };
+
+    BackgroundWorker();
+    ~BackgroundWorker();
+
+    /** Message thread. remove() returns only once the job is not running. */
+    void add(Job& job);
+    void remove(Job& job);
+
+    WorkSignal& getSignal() noexcept { return signal; }
+
+private:
+    class Runner : public juce::Thread
+    {
+    public:
+        explicit Runner(BackgroundWorker& ownerIn);
+        void run() override;
+
+    private:
+        BackgroundWorker& owner;
+    };
+
+    // ~200 ms of polling at 5 ms before the thread parks on the signal.
+    static constexpr int kPollIntervalMs = 5;
+    static constexpr int kPollsBeforeParking = 40;
+
+    void runJobs();
+
+    juce::CriticalSection lock;
+    std::vector<Job*> jobs;
+    WorkSignal signal;
+    Runner runner;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BackgroundWorker)
+};
+
+} // namespace threadbare::core
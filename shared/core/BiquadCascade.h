@@ -0,0 +1,138 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+
+namespace threadbare::core
+{
+
+/**
+ * Normalised biquad coefficients (a0 == 1), RBJ cookbook designs.
+ */
+struct BiquadCoefficients
+{
+    float b0 = 1.0f, b1 = 0.0f, b2 = 0.0f;
+    float a1 = 0.0f, a2 = 0.0f;
+
+    static BiquadCoefficients lowpass(double sampleRate, double cutoffHz, double q) noexcept
+    {
+        const double w0 = 2.0 * std::numbers::pi * cutoffHz / sampleRate;
+        const double cosW0 = std::cos(w0);
+        const double alpha = std::sin(w0) / (2.0 * q);
+        const double a0 = 1.0 + alpha;
+        const double b0 = ((1.0 - cosW0) * 0.5) / a0;
+        return { static_cast<float>(b0), static_cast<float>((1.0 - cosW0) / a0), static_cast<float>(b0),
+                 static_cast<float>((-2.0 * cosW0) / a0), static_cast<float>((1.0 - alpha) / a0) };
+    }
+
+    static BiquadCoefficients highpass(double sampleRate, double cutoffHz, double q) noexcept
+    {
+        const double w0 = 2.0 * std::numbers::pi * cutoffHz / sampleRate;
+        const double cosW0 = std::cos(w0);
+        const double alpha = std::sin(w0) / (2.0 * q);
+        const double a0 = 1.0 + alpha;
+        const double b0 = ((1.0 + cosW0) * 0.5) / a0;
+        return { static_cast<float>(b0), static_cast<float>(-(1.0 + cosW0) / a0), static_cast<float>(b0),
+                 static_cast<float>((-2.0 * cosW0) / a0), static_cast<float>((1.0 - alpha) / a0) };
+    }
+
+    // Bilinear (TPT) one-pole lowpass expressed as a first-order section.
+    static BiquadCoefficients onePoleLowpass(double sampleRate, double cutoffHz) noexcept
+    {
+        const double g = std::tan(std::numbers::pi * cutoffHz / sampleRate);
+        const double c = g / (1.0 + g);
+        return { static_cast<float>(c), 0.0f, 0.0f, static_cast<float>(c - 1.0), 0.0f };
+    }
+};
+
+/**
+ * BiquadCascade: Sections transposed-direct-form-II biquads in series, run
+ * over Channels independent lanes (e.g. a stereo pair).
+ *
+ * Coefficients and state are stored lane-major per section, so the inner
+ * channel loop is a straight vertical operation the compiler maps onto one
+ * SIMD register per coefficient. All lanes share one design.
+ */
+template <std::size_t Channels, std::size_t Sections>
+class BiquadCascade
+{
+public:
+    using Frame = std::array<float, Channels>;
+
+    void setSection(std::size_t section, const BiquadCoefficients& c) noexcept
+    {
+        auto& s = sections[section];
+        s.b0.fill(c.b0);
+        s.b1.fill(c.b1);
+        s.b2.fill(c.b2);
+        s.a1.fill(c.a1);
+        s.a2.fill(c.a2);
+    }
+
+    void setAllSections(const BiquadCoefficients& c) noexcept
+    {
+        for (std::size_t i = 0; i < Sections; ++i)
+            setSection(i, c);
+    }
+
+    void reset() noexcept
+    {
+        for (auto& s : sections)
+        {
+            s.s1.fill(0.0f);
+            s.s2.fill(0.0f);
+        }
+    }
+
+    void processFrame(Frame& frame) noexcept
+    {
+        for (auto& s : sections)
+        {
+            for (std::size_t ch = 0; ch < Channels; ++ch)
+            {
+                const float in = frame[ch];
+                const float out = s.b0[ch] * in + s.s1[ch];
+                s.s1[ch] = s.b1[ch] * in - s.a1[ch] * out + s.s2[ch];
+                s.s2[ch] = s.b2[ch] * in - s.a2[ch] * out;
+                frame[ch] = out;
+            }
+        }
+    }
+
+    float processSample(float input) noexcept
+        requires (Channels == 1)
+    {
+        Frame frame { input };
+        processFrame(frame);
+        return frame[0];
+    }
+
+    // In-place block processing; channels[ch] points at numSamples floats.
+    void process(const std::array<float*, Channels>& channels, int numSamples) noexcept
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            Frame frame;
+            for (std::size_t ch = 0; ch < Channels; ++ch)
+                frame[ch] = channels[ch][i];
+
+            processFrame(frame);
+
+            for (std::size_t ch = 0; ch < Channels; ++ch)
+                channels[ch][i] = frame[ch];
+        }
+    }
+
+private:
+    struct Section
+    {
+        alignas(16) Frame b0 {}, b1 {}, b2 {}, a1 {}, a2 {};
+        alignas(16) Frame s1 {}, s2 {};
+    };
+
+    std::array<Section, Sections> sections{};
+};
+
+} // namespace threadbare::core
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+
+namespace threadbare::core
+{
+
+/**
+ * DeadlineSnapshot: copy of the DeadlineMonitor counters for UI/support use.
+ *
+ * Load is processing time over the block's real-time duration (1.0 = the
+ * block took as long as it plays for). histogram[i] counts blocks with load
+ * in [i, i + 1) * kBinWidth; the last bin also takes everything above.
+ */
+struct DeadlineSnapshot
+{
+    static constexpr int kNumBins = 20;
+    static constexpr float kBinWidth = 0.1f;
+
+    std::array<std::uint32_t, kNumBins> histogram {};
+    std::uint64_t blocks = 0;
+    std::uint64_t overruns = 0;
+    float lastLoad = 0.0f;
+    float averageLoad = 0.0f;   // ~1 s exponential average
+    float maxLoad = 0.0f;
+    juce::int64 lastOverrunMs = 0; // juce::Time::currentTimeMillis(), 0 = never
+};
+
+/**
+ * DeadlineMonitor: measures every processBlock against its real-time budget.
+ *
+ * The audio thread writes relaxed atomics and never blocks; readers take a
+ * snapshot from any thread. reset() only raises a flag, which the audio
+ * thread acts on at the start of its next block, so there is one writer.
+ *
+ * It also keeps a load pressure for quality governors: this instance's own
+ * load, smoothed with a fast rise and a slow fall, and pushed straight to
+ * the deadline by a real overrun. It only looks at how long each block
+ * took, never at when callbacks arrive, so hosts that split a period into
+ * sub-blocks or render ahead in bursts after idle gaps do not read as load.
+ */
+class DeadlineMonitor
+{
+public:
+    static constexpr int kNumBins = DeadlineSnapshot::kNumBins;
+
+    void reset() noexcept { resetRequested.store(true, std::memory_order_relaxed); }
+
+    /** Audio thread: ticks from juce::Time::getHighResolutionTicks(). */
+    void record(juce::int64 startTicks, juce::int64 endTicks, int numSamples, double sampleRate) noexcept
+    {
+        if (numSamples <= 0 || sampleRate <= 0.0)
+            return;
+
+        if (resetRequested.exchange(false, std::memory_order_relaxed))
+            clear();
+
+        const double blockSeconds = static_cast<double>(numSamples) / sampleRate;
+        const double elapsedSeconds = juce::Time::highResolutionTicksToSeconds(endTicks - startTicks);
+        const auto load = static_cast<float>(elapsedSeconds / blockSeconds);
+
+        // One-second time constant regardless of block size.
+        const auto averageCoeff = static_cast<float>(1.0 - std::exp(-blockSeconds));
+        const float average = averageLoad.load(std::memory_order_relaxed);
+        averageLoad.store(average + averageCoeff * (load - average), std::memory_order_relaxed);
+
+        lastLoad.store(load, std::memory_order_relaxed);
+        updatePressure(load, blockSeconds);
+        if (load > maxLoad.load(std::memory_order_relaxed))
+            maxLoad.store(load, std::memory_order_relaxed);
+
+        const int bin = std::clamp(static_cast<int>(load / DeadlineSnapshot::kBinWidth), 0, kNumBins - 1);
+        histogram[static_cast<std::size_t>(bin)].fetch_add(1, std::memory_order_relaxed);
+        blocks.fetch_add(1, std::memory_order_relaxed);
+
+        if (load >= 1.0f)
+        {
+            overruns.fetch_add(1, std::memory_order_relaxed);
+            lastOverrunMs.store(juce::Time::currentTimeMillis(), std::memory_order_relaxed);
+        }
+    }
+
+    /** Load of the most recent block; cheap enough to poll every block. */
+    float getLastLoad() const noexcept { return lastLoad.load(std::memory_order_relaxed); }
+
+    /** Smoothed own load for a quality governor; 1.0 after an overrun. */
+    float getPressure() const noexcept { return pressure.load(std::memory_order_relaxed); }
+
+    DeadlineSnapshot getSnapshot() const noexcept
+    {
+        DeadlineSnapshot snapshot;
+        for (std::size_t i = 0; i < histogram.size(); ++i)
+            snapshot.histogram[i] = histogram[i].load(std::memory_order_relaxed);
+        snapshot.blocks = blocks.load(std::memory_order_relaxed);
+        snapshot.overruns = overruns.load(std::memory_order_relaxed);
+        snapshot.lastLoad = lastLoad.load(std::memory_order_relaxed);
+        snapshot.averageLoad = averageLoad.load(std::memory_order_relaxed);
+        snapshot.maxLoad = maxLoad.load(std::memory_order_relaxed);
+        snapshot.lastOverrunMs = lastOverrunMs.load(std::memory_order_relaxed);
+        return snapshot;
+    }
+
+    /**
+     * RAII timer for one block; wraps the subclass render call.
+     * Offline renders have no deadline, so pass measure = false for them and
+     * the block is neither timed nor counted.
+     */
+    class ScopedBlock
+    {
+    public:
+        ScopedBlock(DeadlineMonitor& monitorToUse, int numSamplesInBlock, double sampleRateToUse,
+                    bool measure = true) noexcept
+            : monitor(monitorToUse),
+              numSamples(measure ? numSamplesInBlock : 0),
+              sampleRate(sampleRateToUse),
+              start(measure ? juce::Time::getHighResolutionTicks() : 0)
+        {
+        }
+
+        ~ScopedBlock() noexcept
+        {
+            if (numSamples > 0)
+                monitor.record(start, juce::Time::getHighResolutionTicks(), numSamples, sampleRate);
+        }
+
+        ScopedBlock(const ScopedBlock&) = delete;
+        ScopedBlock& operator=(const ScopedBlock&) = delete;
+
+    private:
+        DeadlineMonitor& monitor;
+        int numSamples = 0;
+        double sampleRate = 0.0;
+        juce::int64 start = 0;
+    };
+
+private:
+    // Rise within ~50 ms so a governor can act before dropouts; fall over ~1 s
+    // so it does not pump.
+    static constexpr double kPressureAttackSeconds = 0.05;
+    static constexpr double kPressureReleaseSeconds = 1.0;
+
+    void updatePressure(float load, double blockSeconds) noexcept
+    {
+        const float smoothed = pressure.load(std::memory_order_relaxed);
+        if (load >= 1.0f)
+        {
+            pressure.store(std::max(smoothed, 1.0f), std::memory_order_relaxed);
+            return;
+        }
+
+        // Weighted by block duration, so short sub-blocks count for little.
+        const double timeConstant = load > smoothed ? kPressureAttackSeconds : kPressureReleaseSeconds;
+        const auto coeff = static_cast<float>(1.0 - std::exp(-blockSeconds / timeConstant));
+        pressure.store(smoothed + coeff * (load - smoothed), std::memory_order_relaxed);
+    }
+
+    void clear() noexcept
+    {
+        for (auto& bin : histogram)
+            bin.store(0, std::memory_order_relaxed);
+        blocks.store(0, std::memory_order_relaxed);
+        overruns.store(0, std::memory_order_relaxed);
+        lastLoad.store(0.0f, std::memory_order_relaxed);
+        averageLoad.store(0.0f, std::memory_order_relaxed);
+        maxLoad.store(0.0f, std::memory_order_relaxed);
+        lastOverrunMs.store(0, std::memory_order_relaxed);
+        pressure.store(0.0f, std::memory_order_relaxed);
+    }
+
+    std::array<std::atomic<std::uint32_t>, kNumBins> histogram {};
+    std::atomic<std::uint64_t> blocks { 0 };
+    std::atomic<std::uint64_t> overruns { 0 };
+    std::atomic<float> lastLoad { 0.0f };
+    std::atomic<float> averageLoad { 0.0f };
+    std::atomic<float> maxLoad { 0.0f };
+    std::atomic<juce::int64> lastOverrunMs { 0 };
+    std::atomic<bool> resetRequested { false };
+    std::atomic<float> pressure { 0.0f };
+};
+
+} // namespace threadbare::core
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace threadbare::core
+{
+
+/**
+ * Shared noise for Threadbare DSP.
+ *
+ * Every generator runs the same 32-bit LCG, so a stream is fully defined by
+ * its seed. Plugins derive seeds from their DeterminismState; reseeding with
+ * the same value replays the same noise.
+ */
+constexpr std::uint32_t nextLcg(std::uint32_t state) noexcept
+{
+    return state * 1664525u + 1013904223u;
+}
+
+// Top 24 bits of an LCG state as [0, 1].
+constexpr float lcgToUnipolar(std::uint32_t state) noexcept
+{
+    return static_cast<float>((state >> 8) & 0x00FFFFFFu) / static_cast<float>(0x00FFFFFFu);
+}
+
+constexpr float lcgToBipolar(std::uint32_t state) noexcept
+{
+    return lcgToUnipolar(state) * 2.0f - 1.0f;
+}
+
+// Paul Kellet's 3-band pink filter (economy version).
+struct PinkFilter
+{
+    float b0 = 0.0f, b1 = 0.0f, b2 = 0.0f;
+
+    void reset() noexcept { b0 = b1 = b2 = 0.0f; }
+
+    float process(float white) noexcept
+    {
+        b0 = 0.99765f * b0 + white * 0.0990460f;
+        b1 = 0.96300f * b1 + white * 0.2965164f;
+        b2 = 0.57000f * b2 + white * 1.0526913f;
+        return (b0 + b1 + b2 + white * 0.1848f) * 0.22f;
+    }
+};
+
+/**
+ * NoiseGenerator: single seeded stream for scalar consumers (chorus jitter,
+ * flutter, noise floor, drift, sample & hold).
+ */
+class NoiseGenerator
+{
+public:
+    constexpr explicit NoiseGenerator(std::uint32_t seedValue = 1u) noexcept
+        : seed(seedValue), state(seedValue) {}
+
+    void setSeed(std::uint32_t seedValue) noexcept { seed = seedValue; state = seedValue; }
+    void reset() noexcept { state = seed; }
+    std::uint32_t getState() const noexcept { return state; }
+
+    float nextUnipolar() noexcept { state = nextLcg(state); return lcgToUnipolar(state); }
+    float nextBipolar() noexcept { state = nextLcg(state); return lcgToBipolar(state); }
+
+private:
+    std::uint32_t seed;
+    std::uint32_t state;
+};
+
+/**
+ * NoiseLanes: white and pink noise for several decorrelated lanes (one per
+ * voice), generated a block at a time. Lanes are laid out frame-major so the
+ * per-sample lane loop compiles to SIMD; callers skip generate() entirely
+ * while the noise level is zero.
+ */
+class NoiseLanes
+{
+public:
+    static constexpr int kLanes = 8;
+    static constexpr int kBlockSize = 64;
+
+    void prepare(std::uint32_t seed) noexcept
+    {
+        // Spread the base seed across lanes with a golden-ratio stride.
+        for (std::size_t lane = 0; lane < kLanes; ++lane)
+            laneSeeds[lane] = nextLcg(seed + static_cast<std::uint32_t>(lane) * 0x9E3779B9u);
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        states = laneSeeds;
+        pinkB0.fill(0.0f);
+        pinkB1.fill(0.0f);
+        pinkB2.fill(0.0f);
+        white.fill(0.0f);
+        pink.fill(0.0f);
+    }
+
+    // Fills numSamples (<= kBlockSize) frames of white noise, plus pink when
+    // withPink is set. Pink filter state holds while it is not requested.
+    void generate(int numSamples, bool withPink) noexcept
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            float* whiteFrame = white.data() + i * kLanes;
+            for (std::size_t lane = 0; lane < kLanes; ++lane)
+            {
+                states[lane] = nextLcg(states[lane]);
+                whiteFrame[lane] = lcgToBipolar(states[lane]);
+            }
+
+            if (!withPink)
+                continue;
+
+            float* pinkFrame = pink.data() + i * kLanes;
+            for (std::size_t lane = 0; lane < kLanes; ++lane)
+            {
+                const float w = whiteFrame[lane];
+                pinkB0[lane] = 0.99765f * pinkB0[lane] + w * 0.0990460f;
+                pinkB1[lane] = 0.96300f * pinkB1[lane] + w * 0.2965164f;
+                pinkB2[lane] = 0.57000f * pinkB2[lane] + w * 1.0526913f;
+                pinkFrame[lane] = (pinkB0[lane] + pinkB1[lane] + pinkB2[lane] + w * 0.1848f) * 0.22f;
+            }
+        }
+    }
+
+    float getWhite(int index, int lane) const noexcept { return white[static_cast<std::size_t>(index * kLanes + lane)]; }
+    float getPink(int index, int lane) const noexcept { return pink[static_cast<std::size_t>(index * kLanes + lane)]; }
+
+private:
+    using LaneState = std::array<std::uint32_t, kLanes>;
+    using LaneFloat = std::array<float, kLanes>;
+
+    alignas(32) LaneState laneSeeds{};
+    alignas(32) LaneState states{};
+    alignas(32) LaneFloat pinkB0{};
+    alignas(32) LaneFloat pinkB1{};
+    alignas(32) LaneFloat pinkB2{};
+    alignas(32) std::array<float, kLanes * kBlockSize> white{};
+    alignas(32) std::array<float, kLanes * kBlockSize> pink{};
+};
+
+} // namespace threadbare::core
@@ -3,6 +3,16 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <array>
 
+#include "DeadlineMonitor.h"
+#include "RealtimeChecker.h"
+#include "TraceSession.h"
+
+// Defined to 1 only by the bench targets that compile the plugin processors
+// directly: no editor (so no WebView bridge) and no createPluginFilter().
+#ifndef THREADBARE_HEADLESS
+ #define THREADBARE_HEADLESS 0
+#endif
+
 namespace threadbare::core
 {
 
@@ -90,10 +100,12 @@ private:
  * - APVTS ownership and parameter access
  * - State persistence (getStateInformation/setStateInformation)
  * - Visual state queue for UI updates
+ * - Deadline monitoring of every block against its real-time duration
+ * - A trace ring (shared TraceSession) for Chrome trace export
  * 
  * Subclasses must implement:
  * - prepareToPlay, releaseResources, reset
- * - processBlock
+ * - processAudio (called from processBlock inside the deadline timer)
  * - createEditor, getName
  * - createParameterLayout (static)
  */
@@ -107,15 +119,41 @@ public:
         : juce::AudioProcessor(buses),
           apvts(*this, nullptr, "Params", std::move(layout))
     {
+       #ifdef JucePlugin_Name
+        traceSession->add(trace, JucePlugin_Name);
+       #else
+        traceSession->add(trace, "Threadbare");
+       #endif
     }
 
-    ~ProcessorBase() override = default;
+    ~ProcessorBase() override { traceSession->remove(trace); }
 
     //==========================================================================
     // APVTS Access
     juce::AudioProcessorValueTreeState& getValueTreeState() noexcept { return apvts; }
     const juce::AudioProcessorValueTreeState& getValueTreeState() const noexcept { return apvts; }
 
+    //==========================================================================
+    // Audio callback: times the subclass render against the block duration
+    // (realtime playback only; offline bounces run faster or slower at will)
+    void processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi) final
+    {
+        const DeadlineMonitor::ScopedBlock timer(deadlineMonitor, buffer.getNumSamples(), getSampleRate(),
+                                                 !isNonRealtime());
+        const rtcheck::ScopedRealtime realtime;
+        const TraceBuffer::Scope traced(trace, "processBlock");
+        processAudio(buffer, midi);
+    }
+
+    /** Lock-free copy of the deadline counters; safe from any thread. */
+    DeadlineSnapshot getDeadlineSnapshot() const noexcept { return deadlineMonitor.getSnapshot(); }
+
+    /** Clears the counters at the start of the next block. */
+    void resetDeadlineStats() noexcept { deadlineMonitor.reset(); }
+
+    /** Session shared by every Threadbare instance in the process. */
+    TraceSession& getTraceSession() noexcept { return *traceSession; }
+
     //==========================================================================
     // State Persistence (default implementation using APVTS)
     void getStateInformation(juce::MemoryBlock& destData) override
@@ -155,6 +193,13 @@ public:
     }
 
 protected:
+    //==========================================================================
+    // Subclass render callback (audio thread)
+    virtual void processAudio(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi) = 0;
+
+    /** Smoothed own load for a quality governor (see DeadlineMonitor; 1.0 = the deadline). */
+    float getLoadPressure() const noexcept { return deadlineMonitor.getPressure(); }
+
     //==========================================================================
     // Hooks for state persistence customization
     virtual void onSaveState(juce::ValueTree& /*state*/) {}
@@ -163,7 +208,13 @@ protected:
 
     juce::AudioProcessorValueTreeState apvts;
 
+    // Audio thread only; records nothing until the session starts recording.
+    TraceBuffer trace;
+
 private:
+    DeadlineMonitor deadlineMonitor;
+    juce::SharedResourcePointer<TraceSession> traceSession;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ProcessorBase)
 };
 
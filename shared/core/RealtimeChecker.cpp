@@ -0,0 +1,333 @@
+// Interposers for the opt-in real-time safety checker (see RealtimeChecker.h).
+//
+// Linked only into executables built with -DTHREADBARE_RT_CHECK=ON (the
+// benchmarks and golden renderer). Definitions here take precedence over
+// libc's for the whole process, so every call pays one thread_local test;
+// only calls made inside a ScopedRealtime are reported. Allocation forwards
+// to glibc's __libc_* entry points, everything else to the next definition
+// found with dlsym(RTLD_NEXT).
+
+#include "RealtimeChecker.h"
+
+#if THREADBARE_RT_CHECK && defined(__linux__)
+
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <new>
+
+extern "C"
+{
+void* __libc_malloc(std::size_t size);
+void* __libc_calloc(std::size_t count, std::size_t size);
+void* __libc_realloc(void* ptr, std::size_t size);
+void* __libc_memalign(std::size_t alignment, std::size_t size);
+void __libc_free(void* ptr);
+}
+
+namespace
+{
+
+// initial-exec: the default TLS model may allocate on first access from a
+// new thread, which would re-enter malloc.
+__attribute__((tls_model("initial-exec"))) thread_local int realtimeDepth = 0;
+__attribute__((tls_model("initial-exec"))) thread_local bool reporting = false;
+
+constexpr std::size_t kMaxSites = 1024;
+constexpr int kMaxFrames = 32;
+constexpr int kSiteFrames = 8;   // frames above the interposer that identify a site
+
+std::atomic<std::uint64_t> siteHashes[kMaxSites] {};
+std::atomic<std::size_t> violations { 0 };
+std::atomic<std::size_t> sites { 0 };
+
+void writeText(const char* text) noexcept
+{
+    // Raw syscall: keeps the report out of our own write() interposer.
+    [[maybe_unused]] const auto written = ::syscall(SYS_write, STDERR_FILENO, text, std::strlen(text));
+}
+
+std::uint64_t hashFrames(void* const* frames, int count) noexcept
+{
+    std::uint64_t hash = 1469598103934665603ull;   // FNV-1a
+    for (int i = 0; i < count; ++i)
+    {
+        hash ^= static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(frames[i]));
+        hash *= 1099511628211ull;
+    }
+    return hash == 0 ? 1 : hash;
+}
+
+// Lock-free open-addressing set; true the first time a hash is seen. When
+// the table is full new sites are still counted, just not printed.
+bool firstSighting(std::uint64_t hash) noexcept
+{
+    for (std::size_t probe = 0; probe < kMaxSites; ++probe)
+    {
+        auto& slot = siteHashes[(hash + probe) % kMaxSites];
+        auto current = slot.load(std::memory_order_acquire);
+        if (current == 0 && slot.compare_exchange_strong(current, hash, std::memory_order_acq_rel))
+        {
+            sites.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        if (current == hash)
+            return false;
+    }
+    return false;
+}
+
+void report(const char* what) noexcept
+{
+    if (realtimeDepth == 0 || reporting)
+        return;
+
+    reporting = true;
+    violations.fetch_add(1, std::memory_order_relaxed);
+
+    // frames[0] is report(), frames[1] the interposer.
+    void* frames[kMaxFrames];
+    const int count = ::backtrace(frames, kMaxFrames);
+    const int siteFrames = std::min(count - 2, kSiteFrames);
+
+    if (siteFrames > 0 && firstSighting(hashFrames(frames + 2, siteFrames)))
+    {
+        writeText("[rtcheck] ");
+        writeText(what);
+        writeText(" on a real-time thread\n");
+        ::backtrace_symbols_fd(frames + 1, count - 1, STDERR_FILENO);
+    }
+
+    reporting = false;
+}
+
+// Resolved lazily without a function-local static guard, which could itself
+// block; racing threads simply store the same pointer.
+void* nextSymbol(std::atomic<void*>& cache, const char* name) noexcept
+{
+    auto* fn = cache.load(std::memory_order_relaxed);
+    if (fn == nullptr)
+    {
+        fn = ::dlsym(RTLD_NEXT, name);
+        cache.store(fn, std::memory_order_relaxed);
+    }
+    return fn;
+}
+
+#define THREADBARE_RT_NEXT(name) \
+    static std::atomic<void*> next_##name { nullptr }; \
+    const auto real_##name = reinterpret_cast<decltype(&::name)>(nextSymbol(next_##name, #name))
+
+struct Startup
+{
+    Startup() noexcept
+    {
+        // backtrace() loads libgcc on first use; do that before any audio.
+        void* frame = nullptr;
+        ::backtrace(&frame, 1);
+    }
+
+    ~Startup()
+    {
+        const auto total = violations.load();
+        if (total == 0)
+            return;
+
+        char summary[128];
+        std::snprintf(summary, sizeof(summary), "[rtcheck] %zu real-time violation(s) at %zu site(s)\n",
+                      total, sites.load());
+        writeText(summary);
+    }
+};
+
+const Startup startup;
+
+void* allocate(std::size_t size, const char* what) noexcept
+{
+    report(what);
+    return __libc_malloc(size == 0 ? 1 : size);
+}
+
+void release(void* ptr, const char* what) noexcept
+{
+    if (ptr != nullptr)
+        report(what);
+    __libc_free(ptr);
+}
+
+} // namespace
+
+namespace threadbare::core::rtcheck
+{
+
+void enter() noexcept { ++realtimeDepth; }
+void exit() noexcept { --realtimeDepth; }
+
+std::size_t violationCount() noexcept { return violations.load(std::memory_order_relaxed); }
+std::size_t siteCount() noexcept { return sites.load(std::memory_order_relaxed); }
+
+} // namespace threadbare::core::rtcheck
+
+//==============================================================================
+// Allocation
+
+extern "C"
+{
+
+void* malloc(std::size_t size) noexcept
+{
+    report("malloc");
+    return __libc_malloc(size);
+}
+
+void* calloc(std::size_t count, std::size_t size) noexcept
+{
+    report("calloc");
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, std::size_t size) noexcept
+{
+    report("realloc");
+    return __libc_realloc(ptr, size);
+}
+
+void free(void* ptr) noexcept
+{
+    if (ptr != nullptr)
+        report("free");
+    __libc_free(ptr);
+}
+
+void* aligned_alloc(std::size_t alignment, std::size_t size) noexcept
+{
+    report("aligned_alloc");
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** result, std::size_t alignment, std::size_t size) noexcept
+{
+    report("posix_memalign");
+    if (alignment % sizeof(void*) != 0 || (alignment & (alignment - 1)) != 0)
+        return EINVAL;
+    *result = __libc_memalign(alignment, size);
+    return *result != nullptr ? 0 : ENOMEM;
+}
+
+} // extern "C"
+
+void* operator new(std::size_t size)
+{
+    if (auto* ptr = allocate(size, "operator new"))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    if (auto* ptr = allocate(size, "operator new[]"))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return allocate(size, "operator new"); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return allocate(size, "operator new[]"); }
+
+void operator delete(void* ptr) noexcept { release(ptr, "operator delete"); }
+void operator delete[](void* ptr) noexcept { release(ptr, "operator delete[]"); }
+void operator delete(void* ptr, std::size_t) noexcept { release(ptr, "operator delete"); }
+void operator delete[](void* ptr, std::size_t) noexcept { release(ptr, "operator delete[]"); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { release(ptr, "operator delete"); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { release(ptr, "operator delete[]"); }
+
+//==============================================================================
+// Locks, waits and blocking I/O
+
+extern "C"
+{
+
+int pthread_mutex_lock(pthread_mutex_t* mutex) noexcept
+{
+    report("pthread_mutex_lock");
+    THREADBARE_RT_NEXT(pthread_mutex_lock);
+    return real_pthread_mutex_lock(mutex);
+}
+
+int pthread_cond_wait(pthread_cond_t* cond, pthread_mutex_t* mutex)
+{
+    report("pthread_cond_wait");
+    THREADBARE_RT_NEXT(pthread_cond_wait);
+    return real_pthread_cond_wait(cond, mutex);
+}
+
+int pthread_cond_timedwait(pthread_cond_t* cond, pthread_mutex_t* mutex, const struct timespec* abstime)
+{
+    report("pthread_cond_timedwait");
+    THREADBARE_RT_NEXT(pthread_cond_timedwait);
+    return real_pthread_cond_timedwait(cond, mutex, abstime);
+}
+
+int sem_wait(sem_t* sem)
+{
+    report("sem_wait");
+    THREADBARE_RT_NEXT(sem_wait);
+    return real_sem_wait(sem);
+}
+
+int nanosleep(const struct timespec* duration, struct timespec* remaining)
+{
+    report("nanosleep");
+    THREADBARE_RT_NEXT(nanosleep);
+    return real_nanosleep(duration, remaining);
+}
+
+int usleep(useconds_t micros)
+{
+    report("usleep");
+    THREADBARE_RT_NEXT(usleep);
+    return real_usleep(micros);
+}
+
+ssize_t read(int fd, void* buffer, std::size_t count)
+{
+    report("read");
+    THREADBARE_RT_NEXT(read);
+    return real_read(fd, buffer, count);
+}
+
+ssize_t write(int fd, const void* buffer, std::size_t count)
+{
+    report("write");
+    THREADBARE_RT_NEXT(write);
+    return real_write(fd, buffer, count);
+}
+
+std::FILE* fopen(const char* path, const char* mode)
+{
+    report("fopen");
+    THREADBARE_RT_NEXT(fopen);
+    return real_fopen(path, mode);
+}
+
+int fsync(int fd)
+{
+    report("fsync");
+    THREADBARE_RT_NEXT(fsync);
+    return real_fsync(fd);
+}
+
+} // extern "C"
+
+#endif // THREADBARE_RT_CHECK && __linux__
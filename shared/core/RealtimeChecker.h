@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+
+// Defined to 1 (via the threadbare_rtcheck target) only in builds configured
+// with -DTHREADBARE_RT_CHECK=ON; everything below is then backed by
+// RealtimeChecker.cpp. Otherwise the scope is an empty inline.
+#ifndef THREADBARE_RT_CHECK
+ #define THREADBARE_RT_CHECK 0
+#endif
+
+namespace threadbare::core::rtcheck
+{
+
+/**
+ * Opt-in real-time safety checker (Linux, debug/bench builds).
+ *
+ * While a thread is inside a ScopedRealtime, RealtimeChecker.cpp flags
+ * malloc/free (and new/delete), mutex and condition waits, sleeps and file
+ * I/O made on that thread. Each offending call site is reported once to
+ * stderr with its stack; later hits from the same site only count.
+ */
+#if THREADBARE_RT_CHECK
+void enter() noexcept;
+void exit() noexcept;
+
+/** Total flagged calls / distinct call sites since start-up. */
+std::size_t violationCount() noexcept;
+std::size_t siteCount() noexcept;
+
+inline constexpr bool kEnabled = true;
+#else
+inline void enter() noexcept {}
+inline void exit() noexcept {}
+inline std::size_t violationCount() noexcept { return 0; }
+inline std::size_t siteCount() noexcept { return 0; }
+
+inline constexpr bool kEnabled = false;
+#endif
+
+/** Marks the current thread as real-time for the scope's lifetime (nests). */
+class ScopedRealtime
+{
+public:
+    ScopedRealtime() noexcept { enter(); }
+    ~ScopedRealtime() noexcept { exit(); }
+
+    ScopedRealtime(const ScopedRealtime&) = delete;
+    ScopedRealtime& operator=(const ScopedRealtime&) = delete;
+};
+
+} // namespace threadbare::core::rtcheck
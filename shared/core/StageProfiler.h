@@ -0,0 +1,220 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_IX86)
+ #include <intrin.h>
+ #define THREADBARE_STAGE_CLOCK_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+ #include <x86intrin.h>
+ #define THREADBARE_STAGE_CLOCK_TSC 1
+#else
+ #define THREADBARE_STAGE_CLOCK_TSC 0
+#endif
+
+// Per-stage DSP timers. Off by default; configure with
+// -DTHREADBARE_STAGE_PROFILING=ON to compile them in (the CMake option sets
+// this to 1 on every target that links threadbare_core_dsp).
+#ifndef THREADBARE_STAGE_PROFILING
+ #define THREADBARE_STAGE_PROFILING 0
+#endif
+
+namespace threadbare::core
+{
+
+/**
+ * StageClock: cheapest monotonic tick source on the platform. The TSC on
+ * x86 (invariant on every CPU we ship to), steady_clock nanoseconds
+ * elsewhere.
+ */
+struct StageClock
+{
+    static std::uint64_t now() noexcept
+    {
+       #if THREADBARE_STAGE_CLOCK_TSC
+        return static_cast<std::uint64_t>(__rdtsc());
+       #else
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+       #endif
+    }
+
+    /**
+     * Ticks per microsecond. On x86 the first call spins for about a
+     * millisecond against steady_clock, so call it from prepare().
+     */
+    static double ticksPerMicrosecond()
+    {
+       #if THREADBARE_STAGE_CLOCK_TSC
+        static const double rate = []
+        {
+            using Clock = std::chrono::steady_clock;
+            const auto wallStart = Clock::now();
+            const auto tickStart = now();
+            while (Clock::now() - wallStart < std::chrono::milliseconds(1)) {}
+            const auto wallEnd = Clock::now();
+            const auto tickEnd = now();
+            const auto micros = std::chrono::duration<double, std::micro>(wallEnd - wallStart).count();
+            return static_cast<double>(tickEnd - tickStart) / micros;
+        }();
+        return rate;
+       #else
+        return 1000.0;
+       #endif
+    }
+};
+
+/**
+ * StageProfile: one block's stage breakdown in microseconds, sized for a
+ * StateT so it can ride the StateQueue. totalMicros covers the whole
+ * process() call; the difference to the stage sum is block-rate setup.
+ */
+template <std::size_t NumStages>
+struct StageProfile
+{
+    std::array<float, NumStages> stageMicros {};
+    float totalMicros = 0.0f;
+    float budgetMicros = 0.0f;
+
+    // UI side: fold an older block in so a frame shows the worst block it
+    // drained rather than the newest. The budget stays this block's.
+    void mergeMax(const StageProfile& older) noexcept
+    {
+        for (std::size_t i = 0; i < NumStages; ++i)
+            stageMicros[i] = std::max(stageMicros[i], older.stageMicros[i]);
+        totalMicros = std::max(totalMicros, older.totalMicros);
+    }
+};
+
+/**
+ * StageProfiler: accumulates ticks per Stage over one block. Stage is an
+ * enum class ending in `count`.
+ *
+ * Block-rate stages use Scope. Per-sample loops use Laps, which charges the
+ * time since the previous mark to a stage and is only armed on every
+ * kSampleStride-th sample; endBlock scales those stages back up to the whole
+ * block. With THREADBARE_STAGE_PROFILING off every member is an empty inline
+ * call and the clock is never read.
+ */
+template <typename Stage>
+class StageProfiler
+{
+public:
+    static constexpr bool kEnabled = THREADBARE_STAGE_PROFILING != 0;
+    static constexpr std::size_t kNumStages = static_cast<std::size_t>(Stage::count);
+    static constexpr std::size_t kSampleStride = 16;
+
+    using Profile = StageProfile<kNumStages>;
+
+    void prepare([[maybe_unused]] double sampleRate)
+    {
+        if constexpr (kEnabled)
+        {
+            microsPerTick = 1.0 / StageClock::ticksPerMicrosecond();
+            microsPerSample = 1.0e6 / sampleRate;
+        }
+    }
+
+    void beginBlock() noexcept
+    {
+        if constexpr (kEnabled)
+        {
+            ticks.fill(0);
+            sampledTicks.fill(0);
+            sampledCount = 0;
+            blockStart = StageClock::now();
+        }
+    }
+
+    void endBlock([[maybe_unused]] std::size_t numSamples, [[maybe_unused]] Profile& out) const noexcept
+    {
+        if constexpr (kEnabled)
+        {
+            const auto blockTicks = StageClock::now() - blockStart;
+            const double sampledScale = sampledCount > 0
+                ? static_cast<double>(numSamples) / static_cast<double>(sampledCount)
+                : 0.0;
+            for (std::size_t i = 0; i < kNumStages; ++i)
+            {
+                const double total = static_cast<double>(ticks[i]) + static_cast<double>(sampledTicks[i]) * sampledScale;
+                out.stageMicros[i] = static_cast<float>(total * microsPerTick);
+            }
+            out.totalMicros = static_cast<float>(static_cast<double>(blockTicks) * microsPerTick);
+            out.budgetMicros = static_cast<float>(static_cast<double>(numSamples) * microsPerSample);
+        }
+    }
+
+    class Scope
+    {
+    public:
+        Scope([[maybe_unused]] StageProfiler& profilerToUse, [[maybe_unused]] Stage stageToTime) noexcept
+        {
+            if constexpr (kEnabled)
+            {
+                profiler = &profilerToUse;
+                stage = stageToTime;
+                start = StageClock::now();
+            }
+        }
+
+        ~Scope() noexcept
+        {
+            if constexpr (kEnabled)
+                profiler->ticks[static_cast<std::size_t>(stage)] += StageClock::now() - start;
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        StageProfiler* profiler = nullptr;
+        Stage stage {};
+        std::uint64_t start = 0;
+    };
+
+    class Laps
+    {
+    public:
+        Laps([[maybe_unused]] StageProfiler& profilerToUse, [[maybe_unused]] std::size_t sampleIndex) noexcept
+        {
+            if constexpr (kEnabled)
+            {
+                if (sampleIndex % kSampleStride != 0)
+                    return;
+                profiler = &profilerToUse;
+                ++profiler->sampledCount;
+                last = StageClock::now();
+            }
+        }
+
+        void mark([[maybe_unused]] Stage stage) noexcept
+        {
+            if constexpr (kEnabled)
+            {
+                if (profiler == nullptr)
+                    return;
+                const auto tick = StageClock::now();
+                profiler->sampledTicks[static_cast<std::size_t>(stage)] += tick - last;
+                last = tick;
+            }
+        }
+
+    private:
+        StageProfiler* profiler = nullptr;
+        std::uint64_t last = 0;
+    };
+
+private:
+    std::array<std::uint64_t, kNumStages> ticks {};
+    std::array<std::uint64_t, kNumStages> sampledTicks {};
+    std::size_t sampledCount = 0;
+    std::uint64_t blockStart = 0;
+    double microsPerTick = 0.0;
+    double microsPerSample = 0.0;
+};
+
+} // namespace threadbare::core
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace threadbare::core
+{
+
+enum class TraceEventType : std::uint8_t
+{
+    begin,      // Chrome "B"
+    end,        // Chrome "E"
+    spanBegin,  // Chrome async "b"; may outlive the block that opened it
+    spanEnd,    // Chrome async "e"
+    instant,    // Chrome "i"
+    counter     // Chrome "C", value carries the sample
+};
+
+struct TraceEvent
+{
+    std::int64_t timeNs = 0;          // steady_clock, shared by every instance
+    const char* name = nullptr;       // string literal; never freed
+    float value = 0.0f;
+    TraceEventType type = TraceEventType::instant;
+};
+
+/**
+ * TraceBuffer: per-instance flight recorder for audio-thread activity.
+ *
+ * One writer (the audio thread) appends into a fixed ring that overwrites the
+ * oldest events, so the last few seconds are always available; any other
+ * thread can take a consistent snapshot without stopping it. Storage is only
+ * allocated by allocate() on a non-audio thread, and nothing is recorded
+ * until setRecording(true) has been called after that.
+ *
+ * Names must be string literals (or otherwise outlive the buffer): only the
+ * pointer is stored.
+ */
+class TraceBuffer
+{
+public:
+    static constexpr std::size_t kDefaultCapacity = 1u << 15;
+
+    /** Non-audio thread. Idempotent; storage is kept once allocated. */
+    void allocate(std::size_t capacity = kDefaultCapacity)
+    {
+        if (slots != nullptr)
+            return;
+
+        capacity = std::bit_ceil(std::max<std::size_t>(capacity, 2));
+        slots = std::make_unique<Slot[]>(capacity);
+        mask = capacity - 1;
+        writeIndex.store(0, std::memory_order_relaxed);
+        allocated.store(true, std::memory_order_release);
+    }
+
+    /** Recording starts only once storage exists. */
+    void setRecording(bool shouldRecord) noexcept
+    {
+        recording.store(shouldRecord && allocated.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    bool isRecording() const noexcept { return recording.load(std::memory_order_relaxed); }
+
+    //==========================================================================
+    // Audio thread
+
+    void begin(const char* name) noexcept { push(name, TraceEventType::begin, 0.0f); }
+    void end(const char* name) noexcept { push(name, TraceEventType::end, 0.0f); }
+    void beginSpan(const char* name) noexcept { push(name, TraceEventType::spanBegin, 0.0f); }
+    void endSpan(const char* name) noexcept { push(name, TraceEventType::spanEnd, 0.0f); }
+    void instant(const char* name, float value = 0.0f) noexcept { push(name, TraceEventType::instant, value); }
+    void counter(const char* name, float value) noexcept { push(name, TraceEventType::counter, value); }
+
+    /** RAII begin/end pair. */
+    class Scope
+    {
+    public:
+        Scope(TraceBuffer& bufferToUse, const char* scopeName) noexcept
+            : buffer(bufferToUse), name(scopeName)
+        {
+            buffer.begin(name);
+        }
+
+        ~Scope() noexcept { buffer.end(name); }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        TraceBuffer& buffer;
+        const char* name;
+    };
+
+    //==========================================================================
+    // Any thread
+
+    /** Copies the events still in the ring, oldest first. */
+    std::vector<TraceEvent> snapshot() const
+    {
+        std::vector<TraceEvent> events;
+        if (!allocated.load(std::memory_order_acquire))
+            return events;
+
+        const std::uint64_t capacity = mask + 1;
+        const auto endIndex = writeIndex.load(std::memory_order_acquire);
+        const auto beginIndex = endIndex > capacity ? endIndex - capacity : 0;
+
+        events.reserve(static_cast<std::size_t>(endIndex - beginIndex));
+        for (auto i = beginIndex; i < endIndex; ++i)
+            events.push_back(slots[i & mask].load());
+
+        // Slots the writer reached while we copied (plus the one it may be
+        // halfway through) are dropped from the front.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const auto afterIndex = writeIndex.load(std::memory_order_relaxed);
+        const auto firstValid = afterIndex >= capacity ? afterIndex - capacity + 1 : 0;
+        if (firstValid > beginIndex)
+        {
+            const auto stale = std::min<std::uint64_t>(firstValid - beginIndex, events.size());
+            events.erase(events.begin(), events.begin() + static_cast<std::ptrdiff_t>(stale));
+        }
+        return events;
+    }
+
+    static std::int64_t now() noexcept
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+private:
+    // Fields are relaxed atomics so a concurrent snapshot is race-free; the
+    // write index (and the fence in push) orders them against it.
+    struct Slot
+    {
+        std::atomic<std::int64_t> timeNs { 0 };
+        std::atomic<const char*> name { nullptr };
+        std::atomic<std::uint64_t> payload { 0 };   // value bits | type << 32
+
+        TraceEvent load() const noexcept
+        {
+            const auto packed = payload.load(std::memory_order_relaxed);
+            TraceEvent event;
+            event.timeNs = timeNs.load(std::memory_order_relaxed);
+            event.name = name.load(std::memory_order_relaxed);
+            event.value = std::bit_cast<float>(static_cast<std::uint32_t>(packed));
+            event.type = static_cast<TraceEventType>(packed >> 32);
+            return event;
+        }
+    };
+
+    void push(const char* name, TraceEventType type, float value) noexcept
+    {
+        if (!recording.load(std::memory_order_acquire))
+            return;
+
+        const auto index = writeIndex.load(std::memory_order_relaxed);
+        auto& slot = slots[index & mask];
+
+        // Pairs with the acquire fence in snapshot(): a reader that sees any
+        // of these stores also sees the index that makes the slot stale.
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.timeNs.store(now(), std::memory_order_relaxed);
+        slot.name.store(name, std::memory_order_relaxed);
+        slot.payload.store(static_cast<std::uint64_t>(std::bit_cast<std::uint32_t>(value))
+                               | (static_cast<std::uint64_t>(type) << 32),
+                           std::memory_order_relaxed);
+
+        writeIndex.store(index + 1, std::memory_order_release);
+    }
+
+    std::unique_ptr<Slot[]> slots;
+    std::uint64_t mask = 0;
+    std::atomic<std::uint64_t> writeIndex { 0 };
+    std::atomic<bool> allocated { false };
+    std::atomic<bool> recording { false };
+};
+
+} // namespace threadbare::core
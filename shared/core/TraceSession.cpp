@@ -0,0 +1,203 @@
+#include "TraceSession.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace threadbare::core
+{
+
+TraceSession::Writer::Writer(TraceSession& ownerIn)
+    : juce::Thread("Threadbare trace writer"), owner(ownerIn)
+{
+}
+
+void TraceSession::Writer::run()
+{
+    while (!threadShouldExit())
+    {
+        wait(-1);
+        owner.writePending();
+    }
+}
+
+TraceSession::TraceSession()
+    : writer(*this)
+{
+    writer.startThread(juce::Thread::Priority::low);
+}
+
+TraceSession::~TraceSession()
+{
+    writer.signalThreadShouldExit();
+    writer.notify();
+    writer.stopThread(2000);
+}
+
+void TraceSession::add(TraceBuffer& buffer, const juce::String& label)
+{
+    const juce::ScopedLock sl(lock);
+    const int id = nextId++;
+    entries.push_back({ &buffer, label + " #" + juce::String(id), id });
+
+    if (recording)
+    {
+        buffer.allocate();
+        buffer.setRecording(true);
+    }
+}
+
+void TraceSession::remove(TraceBuffer& buffer)
+{
+    const juce::ScopedLock sl(lock);
+    std::erase_if(entries, [&buffer](const Entry& entry) { return entry.buffer == &buffer; });
+}
+
+void TraceSession::setRecording(bool shouldRecord)
+{
+    const juce::ScopedLock sl(lock);
+    recording = shouldRecord;
+
+    for (auto& entry : entries)
+    {
+        if (shouldRecord)
+            entry.buffer->allocate();
+        entry.buffer->setRecording(shouldRecord);
+    }
+}
+
+bool TraceSession::isRecording() const
+{
+    const juce::ScopedLock sl(lock);
+    return recording;
+}
+
+juce::File TraceSession::exportTrace()
+{
+    const auto stem = "threadbare-trace-" + juce::Time::getCurrentTime().formatted("%Y%m%d-%H%M%S");
+    const auto file = getDefaultDirectory().getNonexistentChildFile(stem, ".json", false);
+    {
+        const juce::ScopedLock sl(lock);
+        pendingFiles.add(file);
+    }
+    writer.notify();
+    return file;
+}
+
+juce::File TraceSession::getDefaultDirectory()
+{
+    return juce::File::getSpecialLocation(juce::File::userDocumentsDirectory)
+        .getChildFile("Threadbare")
+        .getChildFile("Traces");
+}
+
+void TraceSession::writePending()
+{
+    for (;;)
+    {
+        juce::File file;
+        std::vector<Entry> snapshotEntries;
+        std::vector<std::vector<TraceEvent>> snapshotEvents;
+
+        // Copy the rings under the lock so no instance can unregister (and
+        // free its buffer) mid-copy; the audio threads keep writing meanwhile.
+        {
+            const juce::ScopedLock sl(lock);
+            if (pendingFiles.isEmpty())
+                return;
+
+            file = pendingFiles.removeAndReturn(0);
+            snapshotEntries = entries;
+            snapshotEvents.reserve(entries.size());
+            for (const auto& entry : entries)
+                snapshotEvents.push_back(entry.buffer->snapshot());
+        }
+
+        if (!writeChromeTrace(file, snapshotEntries, snapshotEvents))
+        {
+            DBG("TraceSession: could not write " << file.getFullPathName());
+        }
+    }
+}
+
+bool TraceSession::writeChromeTrace(const juce::File& file, const std::vector<Entry>& entries,
+                                    const std::vector<std::vector<TraceEvent>>& events)
+{
+    if (!file.getParentDirectory().createDirectory())
+        return false;
+
+    juce::FileOutputStream out(file);
+    if (!out.openedOk())
+        return false;
+
+    // Times are written relative to the earliest event, in microseconds.
+    std::int64_t originNs = std::numeric_limits<std::int64_t>::max();
+    for (const auto& ring : events)
+        if (!ring.empty())
+            originNs = std::min(originNs, ring.front().timeNs);
+    if (originNs == std::numeric_limits<std::int64_t>::max())
+        originNs = 0;
+
+    bool first = true;
+    const auto writeEvent = [&out, &first](const juce::String& json)
+    {
+        out << (first ? "\n" : ",\n") << json;
+        first = false;
+    };
+
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+    for (std::size_t i = 0; i < entries.size(); ++i)
+    {
+        const auto pid = juce::String(entries[i].id);
+        writeEvent("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" + pid
+                   + ",\"args\":{\"name\":" + juce::JSON::toString(juce::var(entries[i].label)) + "}}");
+        writeEvent("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" + pid
+                   + ",\"tid\":1,\"args\":{\"name\":\"audio\"}}");
+
+        // The ring may start mid-scope; drop ends whose begin was overwritten.
+        int depth = 0;
+        for (const auto& event : events[i])
+        {
+            if (event.name == nullptr)
+                continue;
+
+            const auto ts = juce::String(static_cast<double>(event.timeNs - originNs) * 1.0e-3, 3);
+            const auto head = "{\"name\":" + juce::JSON::toString(juce::var(juce::String(event.name)))
+                            + ",\"pid\":" + pid + ",\"tid\":1,\"ts\":" + ts;
+            const auto value = juce::String(std::isfinite(event.value) ? event.value : 0.0f);
+
+            switch (event.type)
+            {
+                case TraceEventType::begin:
+                    ++depth;
+                    writeEvent(head + ",\"ph\":\"B\"}");
+                    break;
+                case TraceEventType::end:
+                    if (depth == 0)
+                        break;
+                    --depth;
+                    writeEvent(head + ",\"ph\":\"E\"}");
+                    break;
+                case TraceEventType::spanBegin:
+                    writeEvent(head + ",\"ph\":\"b\",\"cat\":\"state\",\"id\":1}");
+                    break;
+                case TraceEventType::spanEnd:
+                    writeEvent(head + ",\"ph\":\"e\",\"cat\":\"state\",\"id\":1}");
+                    break;
+                case TraceEventType::instant:
+                    writeEvent(head + ",\"ph\":\"i\",\"s\":\"t\",\"args\":{\"value\":" + value + "}}");
+                    break;
+                case TraceEventType::counter:
+                    writeEvent(head + ",\"ph\":\"C\",\"args\":{\"value\":" + value + "}}");
+                    break;
+            }
+        }
+    }
+
+    out << "\n]}\n";
+    out.flush();
+    return out.getStatus().wasOk();
+}
+
+} // namespace threadbare::core
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <vector>
+
+#include "TraceBuffer.h"
+
+namespace threadbare::core
+{
+
+/**
+ * TraceSession: process-wide registry of TraceBuffers and their exporter.
+ *
+ * Held through juce::SharedResourcePointer by every ProcessorBase, so all
+ * plugin instances in a host share one session. Recording is switched on and
+ * off for every instance at once. exportTrace() hands the job to a background
+ * thread that writes all rings into a single Chrome trace JSON file (loadable
+ * in Perfetto or chrome://tracing), one process track per instance on a
+ * common clock.
+ */
+class TraceSession
+{
+public:
+    TraceSession();
+    ~TraceSession();
+
+    /** Message thread. The label names the instance's track, e.g. "Waver". */
+    void add(TraceBuffer& buffer, const juce::String& label);
+    void remove(TraceBuffer& buffer);
+
+    /** Allocates rings on first use; instances added later follow suit. */
+    void setRecording(bool shouldRecord);
+    bool isRecording() const;
+
+    /**
+     * Queues a write of every registered ring and returns the file it will
+     * go to (under getDefaultDirectory()). Returns immediately.
+     */
+    juce::File exportTrace();
+
+    static juce::File getDefaultDirectory();
+
+private:
+    struct Entry
+    {
+        TraceBuffer* buffer = nullptr;
+        juce::String label;
+        int id = 0;
+    };
+
+    class Writer : public juce::Thread
+    {
+    public:
+        explicit Writer(TraceSession& ownerIn);
+        void run() override;
+
+    private:
+        TraceSession& owner;
+    };
+
+    void writePending();
+    static bool writeChromeTrace(const juce::File& file, const std::vector<Entry>& entries,
+                                 const std::vector<std::vector<TraceEvent>>& events);
+
+    mutable juce::CriticalSection lock;
+    std::vector<Entry> entries;
+    juce::Array<juce::File> pendingFiles;
+    int nextId = 1;
+    bool recording = false;
+    Writer writer;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TraceSession)
+};
+
+} // namespace threadbare::core
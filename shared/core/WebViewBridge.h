@@ -1,11 +1,15 @@
 #pragma once
 
 #include <juce_gui_extra/juce_gui_extra.h>
+#include <array>
 #include <functional>
 #include <optional>
 #include <string>
 #include <map>
 
+#include "DeadlineMonitor.h"
+#include "StageProfiler.h"
+
 namespace threadbare::core
 {
 
@@ -84,6 +88,57 @@ public:
      */
     static juce::String toResourceName(const juce::String& path);
 
+    /**
+     * Serialise a stage profile for the UI dev overlay:
+     * { stages: [{ name, micros }...], totalMicros, budgetMicros }, in stage order.
+     */
+    template <std::size_t NumStages>
+    static juce::var stageProfileToVar(const std::array<const char*, NumStages>& names,
+                                       const StageProfile<NumStages>& profile)
+    {
+        juce::Array<juce::var> stages;
+        for (std::size_t i = 0; i < NumStages; ++i)
+        {
+            auto* stage = new juce::DynamicObject();
+            stage->setProperty("name", names[i]);
+            stage->setProperty("micros", profile.stageMicros[i]);
+            stages.add(juce::var(stage));
+        }
+
+        auto* obj = new juce::DynamicObject();
+        obj->setProperty("stages", stages);
+        obj->setProperty("totalMicros", profile.totalMicros);
+        obj->setProperty("budgetMicros", profile.budgetMicros);
+        return juce::var(obj);
+    }
+
+    /**
+     * Serialise deadline counters for the UI:
+     * { load, averageLoad, maxLoad, blocks, overruns, lastOverrunAgoSeconds
+     *   (-1 = never), binWidth, histogram: [counts...] }.
+     */
+    static juce::var deadlineSnapshotToVar(const DeadlineSnapshot& snapshot)
+    {
+        juce::Array<juce::var> histogram;
+        for (const auto count : snapshot.histogram)
+            histogram.add(static_cast<juce::int64>(count));
+
+        const double agoSeconds = snapshot.lastOverrunMs > 0
+            ? static_cast<double>(juce::Time::currentTimeMillis() - snapshot.lastOverrunMs) / 1000.0
+            : -1.0;
+
+        auto* obj = new juce::DynamicObject();
+        obj->setProperty("load", snapshot.lastLoad);
+        obj->setProperty("averageLoad", snapshot.averageLoad);
+        obj->setProperty("maxLoad", snapshot.maxLoad);
+        obj->setProperty("blocks", static_cast<juce::int64>(snapshot.blocks));
+        obj->setProperty("overruns", static_cast<juce::int64>(snapshot.overruns));
+        obj->setProperty("lastOverrunAgoSeconds", agoSeconds);
+        obj->setProperty("binWidth", DeadlineSnapshot::kBinWidth);
+        obj->setProperty("histogram", histogram);
+        return juce::var(obj);
+    }
+
 private:
 #if JUCE_WINDOWS
     static juce::File getWindowsUserDataFolder(const juce::String& appName);
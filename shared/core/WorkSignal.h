@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace threadbare::core
+{
+
+/**
+ * WorkSignal: wakes a background worker without taking a lock.
+ *
+ * notify() bumps an epoch, so the audio thread can hand off work (e.g. a
+ * wavetable rebuild) the moment it is requested. It only makes the wake-up
+ * syscall when the worker is parked in waitPast(); a worker that is running
+ * or polling sees the new epoch on its own. A worker reads current() before
+ * it looks for work and then waits past that value, so a notify() that lands
+ * in between is never lost.
+ */
+class WorkSignal
+{
+public:
+    /** Any thread, including the audio thread. */
+    void notify() noexcept
+    {
+        epoch.fetch_add(1, std::memory_order_seq_cst);
+        // Pairs with waitPast(): either the worker sees the new epoch before
+        // it blocks, or this sees it parked. Only one notifier pays the wake.
+        if (parked.load(std::memory_order_seq_cst) && parked.exchange(false, std::memory_order_seq_cst))
+            epoch.notify_one();
+    }
+
+    std::uint32_t current() const noexcept { return epoch.load(std::memory_order_acquire); }
+
+    /** Worker thread: blocks until notify() moves the epoch past seen. */
+    void waitPast(std::uint32_t seen) noexcept
+    {
+        parked.store(true, std::memory_order_seq_cst);
+        if (epoch.load(std::memory_order_seq_cst) == seen)
+            epoch.wait(seen, std::memory_order_acquire);
+        parked.store(false, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<std::uint32_t> epoch { 0 };
+    std::atomic<bool> parked { false };
+};
+
+} // namespace threadbare::core
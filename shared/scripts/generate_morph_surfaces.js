@@ -0,0 +1,218 @@
+#!/usr/bin/env node
+/**
+ * generate_morph_surfaces.js
+ *
+ * Compiles the puck morph surfaces (RBF landmark tables) from the frontend's
+ * preset-surfaces.js into a C++ header, so the processor can evaluate the
+ * morph natively on the audio thread.
+ *
+ * Usage:
+ *   node generate_morph_surfaces.js <preset-surfaces.js> <output.h> <plugin>
+ *
+ * Example:
+ *   node generate_morph_surfaces.js \
+ *     plugins/waver/Source/UI/frontend/src/preset-surfaces.js \
+ *     plugins/waver/Source/WaverMorphSurfaces.h \
+ *     waver
+ */
+
+const fs = require('fs');
+const path = require('path');
+const { pathToFileURL } = require('url');
+
+// =============================================================================
+// Argument Parsing
+// =============================================================================
+const args = process.argv.slice(2);
+
+if (args.length < 3) {
+    console.error('Usage: node generate_morph_surfaces.js <preset-surfaces.js> <output.h> <plugin>');
+    process.exit(1);
+}
+
+const [inputPath, outputCppPath, plugin] = args;
+
+// =============================================================================
+// Perceptual scales
+// =============================================================================
+// Parameters interpolated in log space (Hz and seconds share a 1e-6 floor,
+// milliseconds use 1e-3). Choice parameters snap to the nearest landmark.
+const LOG_PARAMS = new Set(['filterCutoff', 'lfoRate', 'envAttack', 'envDecay', 'envRelease']);
+const LOG_MS_PARAMS = new Set(['portaTime']);
+const CHOICE_PARAMS = new Set(['filterMode', 'lfoShape', 'chorusMode', 'portaMode', 'humFreq', 'dcoSubOctave']);
+
+function scaleFor(id) {
+    if (LOG_PARAMS.has(id)) return 'log';
+    if (LOG_MS_PARAMS.has(id)) return 'logMs';
+    if (CHOICE_PARAMS.has(id)) return 'choice';
+    return 'linear';
+}
+
+// =============================================================================
+// Generate C++ Header
+// =============================================================================
+function generateCppHeader(surfaces) {
+    const className = `${capitalize(plugin)}MorphSurfaces`;
+
+    // Parameter order: first appearance across all surfaces.
+    const paramIds = [];
+    for (const surface of surfaces) {
+        for (const landmark of surface.landmarks) {
+            for (const id of Object.keys(landmark.params || {})) {
+                if (!paramIds.includes(id)) paramIds.push(id);
+            }
+        }
+    }
+
+    const maxLandmarks = Math.max(...surfaces.map((surface) => surface.landmarks.length));
+
+    const lines = [
+        '// =============================================================================',
+        '// AUTO-GENERATED FILE - DO NOT EDIT MANUALLY',
+        `// Generated from: ${path.basename(inputPath)}`,
+        `// Generated at: ${new Date().toISOString()}`,
+        '// =============================================================================',
+        '#pragma once',
+        '',
+        '#include <array>',
+        '#include <cstddef>',
+        '#include <cstdint>',
+        '#include <limits>',
+        '#include <string_view>',
+        '',
+        `namespace threadbare::${plugin}`,
+        '{',
+        '',
+        `struct ${className}`,
+        '{',
+        '    enum class Scale : std::uint8_t',
+        '    {',
+        '        linear,',
+        '        log,',
+        '        logMs,',
+        '        choice',
+        '    };',
+        '',
+        `    static constexpr std::size_t kNumParams = ${paramIds.length};`,
+        `    static constexpr std::size_t kMaxLandmarksPerSurface = ${maxLandmarks};`,
+        '',
+        '    // Marks a parameter a landmark does not set.',
+        '    static constexpr float kUnset = std::numeric_limits<float>::quiet_NaN();',
+        '',
+        '    static constexpr std::array<const char*, kNumParams> kParamIds {',
+    ];
+    for (const id of paramIds) {
+        lines.push(`        "${id}",`);
+    }
+    lines.push('    };');
+    lines.push('');
+    lines.push('    static constexpr std::array<Scale, kNumParams> kParamScales {');
+    for (const id of paramIds) {
+        lines.push(`        Scale::${scaleFor(id)}, // ${id}`);
+    }
+    lines.push('    };');
+    lines.push('');
+    lines.push('    static constexpr int indexOf(std::string_view id) noexcept');
+    lines.push('    {');
+    lines.push('        for (std::size_t i = 0; i < kNumParams; ++i)');
+    lines.push('        {');
+    lines.push('            if (id == kParamIds[i])');
+    lines.push('                return static_cast<int>(i);');
+    lines.push('        }');
+    lines.push('        return -1;');
+    lines.push('    }');
+    lines.push('');
+    lines.push('    // Raw parameter values, in kParamIds order.');
+    lines.push('    struct Landmark');
+    lines.push('    {');
+    lines.push('        float x = 0.0f;');
+    lines.push('        float y = 0.0f;');
+    lines.push('        std::array<float, kNumParams> values {};');
+    lines.push('    };');
+    lines.push('');
+    lines.push('    struct Surface');
+    lines.push('    {');
+    lines.push('        const char* name = "";');
+    lines.push('        float sigma = 0.32f;');
+    lines.push('        std::size_t firstLandmark = 0;');
+    lines.push('        std::size_t numLandmarks = 0;');
+    lines.push('    };');
+    lines.push('');
+
+    const totalLandmarks = surfaces.reduce((sum, surface) => sum + surface.landmarks.length, 0);
+    lines.push(`    static constexpr std::array<Landmark, ${totalLandmarks}> kLandmarks {{`);
+    for (const surface of surfaces) {
+        lines.push(`        // ${surface.name}`);
+        for (const landmark of surface.landmarks) {
+            const values = paramIds.map((id) => {
+                const value = landmark.params ? landmark.params[id] : undefined;
+                return value === undefined ? 'kUnset' : `${formatFloat(value)}f`;
+            });
+            const label = landmark.label ? ` // ${landmark.label}` : '';
+            lines.push(`        { ${formatFloat(landmark.x)}f, ${formatFloat(landmark.y)}f, {${label}`);
+            for (let i = 0; i < values.length; i += 8) {
+                lines.push(`            ${values.slice(i, i + 8).join(', ')},`);
+            }
+            lines.push('        } },');
+        }
+    }
+    lines.push('    }};');
+    lines.push('');
+
+    lines.push(`    static constexpr std::array<Surface, ${surfaces.length}> kSurfaces {{`);
+    let first = 0;
+    for (const surface of surfaces) {
+        const sigma = surface.sigma !== undefined ? surface.sigma : 0.32;
+        lines.push(`        { "${escapeString(surface.name)}", ${formatFloat(sigma)}f, ${first}, ${surface.landmarks.length} },`);
+        first += surface.landmarks.length;
+    }
+    lines.push('    }};');
+    lines.push('};');
+    lines.push('');
+    lines.push(`} // namespace threadbare::${plugin}`);
+    lines.push('');
+
+    return lines.join('\n');
+}
+
+// =============================================================================
+// Utility Functions
+// =============================================================================
+function capitalize(str) {
+    return str.charAt(0).toUpperCase() + str.slice(1);
+}
+
+function formatFloat(num) {
+    const str = String(num);
+    if (!str.includes('.') && !str.includes('e')) {
+        return str + '.0';
+    }
+    return str;
+}
+
+function escapeString(str) {
+    return String(str).replace(/\\/g, '\\\\').replace(/"/g, '\\"');
+}
+
+// =============================================================================
+// Read Surfaces and Write Output
+// =============================================================================
+import(pathToFileURL(path.resolve(inputPath)).href)
+    .then((module) => {
+        const surfaces = module.FACTORY_SURFACES;
+        if (!Array.isArray(surfaces) || surfaces.length === 0) {
+            console.error(`Invalid surfaces module: ${inputPath} exports no FACTORY_SURFACES`);
+            process.exit(1);
+        }
+
+        const dir = path.dirname(outputCppPath);
+        if (!fs.existsSync(dir)) {
+            fs.mkdirSync(dir, { recursive: true });
+        }
+        fs.writeFileSync(outputCppPath, generateCppHeader(surfaces));
+        console.log(`Generated: ${outputCppPath}`);
+    })
+    .catch((err) => {
+        console.error(`Error generating morph surfaces: ${err.message}`);
+        process.exit(1);
+    });
@@ -64,6 +64,9 @@ function generateCppHeader(plugin, params) {
         '#pragma once',
         '',
         '#include <juce_audio_processors/juce_audio_processors.h>',
+        '#include <array>',
+        '#include <atomic>',
+        '#include <cstddef>',
         '#include <memory>',
         '#include <vector>',
         '',
@@ -80,7 +83,16 @@ function generateCppHeader(plugin, params) {
     
     for (const param of params) {
         if (param.type === 'bool') {
-            lines.push(`        params.push_back(std::make_unique<juce::AudioParameterBool>("${param.id}", "${param.name}", ${param.default ? 'true' : 'false'}));`);
+            if (param.automatable === false) {
+                // Non-automatable bools need the versioned ParameterID + attributes overload.
+                lines.push(`        params.push_back(std::make_unique<juce::AudioParameterBool>(`);
+                lines.push(`            juce::ParameterID{ "${param.id}", 1 },`);
+                lines.push(`            "${param.name}",`);
+                lines.push(`            ${param.default ? 'true' : 'false'},`);
+                lines.push(`            juce::AudioParameterBoolAttributes().withAutomatable(false)));`);
+            } else {
+                lines.push(`        params.push_back(std::make_unique<juce::AudioParameterBool>("${param.id}", "${param.name}", ${param.default ? 'true' : 'false'}));`);
+            }
         } else if (param.type === 'float') {
             if (param.skewCentre !== undefined) {
                 // Parameter with skew
@@ -139,6 +151,59 @@ function generateCppHeader(plugin, params) {
         }
     }
     lines.push('    };');
+    lines.push('');
+
+    // Generate index enum and typed cache of raw value pointers
+    lines.push('    // Parameter indices in definition order');
+    lines.push('    enum class Index : int');
+    lines.push('    {');
+    for (const param of params) {
+        lines.push(`        ${param.id},`);
+    }
+    lines.push('    };');
+    lines.push('');
+    lines.push(`    static constexpr std::size_t kNumParams = ${params.length};`);
+    lines.push('');
+    lines.push('    static constexpr std::array<const char*, kNumParams> kIdsByIndex {');
+    for (const param of params) {
+        lines.push(`        "${param.id}",`);
+    }
+    lines.push('    };');
+    lines.push('');
+    lines.push('    // Raw value pointers resolved once against the APVTS; reads on the audio');
+    lines.push('    // thread are relaxed atomic loads with no string-keyed lookup.');
+    lines.push('    class ParamCache');
+    lines.push('    {');
+    lines.push('    public:');
+    lines.push('        explicit ParamCache(juce::AudioProcessorValueTreeState& apvts)');
+    lines.push('        {');
+    lines.push('            for (std::size_t i = 0; i < kNumParams; ++i)');
+    lines.push('            {');
+    lines.push('                values[i] = apvts.getRawParameterValue(kIdsByIndex[i]);');
+    lines.push('                jassert(values[i] != nullptr);');
+    lines.push('            }');
+    lines.push('        }');
+    lines.push('');
+    lines.push('        float get(Index index) const noexcept');
+    lines.push('        {');
+    lines.push('            return values[static_cast<std::size_t>(index)]->load(std::memory_order_relaxed);');
+    lines.push('        }');
+    lines.push('');
+    lines.push('        std::atomic<float>* raw(Index index) const noexcept { return values[static_cast<std::size_t>(index)]; }');
+    lines.push('');
+    for (const param of params) {
+        if (param.type === 'bool') {
+            lines.push(`        bool ${param.id}() const noexcept { return get(Index::${param.id}) > 0.5f; }`);
+        } else if (param.type === 'choice') {
+            lines.push(`        int ${param.id}() const noexcept { return static_cast<int>(get(Index::${param.id})); }`);
+        } else {
+            lines.push(`        float ${param.id}() const noexcept { return get(Index::${param.id}); }`);
+        }
+    }
+    lines.push('');
+    lines.push('    private:');
+    lines.push('        std::array<std::atomic<float>*, kNumParams> values {};');
+    lines.push('    };');
     lines.push('};');
     lines.push('');
     lines.push(`} // namespace threadbare::${plugin}`);
@@ -0,0 +1,247 @@
+// =============================================================================
+// DEV OVERLAY - Shared UI component
+// Hidden DSP timing readout; toggle with Ctrl/Cmd+Shift+P. Every build sends
+// `deadline` (block load vs. real time); only builds configured with
+// THREADBARE_STAGE_PROFILING also send the per-stage `stageProfile`. The trace
+// row records audio-thread activity of every instance for Chrome/Perfetto.
+// =============================================================================
+
+const PEAK_HOLD_MS = 2000
+
+// Plugins with a CPU governor add { level, sparkleVoices, linearInterpolation }
+function describeGovernor(governor) {
+  const level = governor.level || 0
+  if (level <= 0) return 'off'
+  const parts = [`${(level * 100).toFixed(0)}%`]
+  if (governor.sparkleVoices != null) parts.push(`${governor.sparkleVoices} sparkle`)
+  if (governor.linearInterpolation) parts.push('linear')
+  return parts.join(' / ')
+}
+
+/**
+ * Per-stage timing overlay.
+ *
+ * Each update carries the worst block the editor drained since its last frame
+ * ({ stages: [{ name, micros }], totalMicros, budgetMicros }). Rows show that
+ * value, a peak held for PEAK_HOLD_MS, and a bar against the block budget.
+ *
+ * The deadline header shows load now / average / max, the overrun count and
+ * age, the CPU governor level where the plugin has one, and a load histogram.
+ * Clicking it calls onResetDeadline.
+ * onTraceRecording(bool) and onTraceExport() return promises from the backend
+ * (recording state, written file path).
+ */
+export class DevOverlay {
+  constructor({
+    root = document.body,
+    onResetDeadline = null,
+    onTraceRecording = null,
+    onTraceExport = null,
+  } = {}) {
+    this.root = root
+    this.onResetDeadline = onResetDeadline
+    this.onTraceRecording = onTraceRecording
+    this.onTraceExport = onTraceExport
+    this.element = null
+    this.deadline = null
+    this.rows = new Map()
+    this.totalRow = null
+    this.visible = false
+    this.peaks = new Map()
+
+    this.onKeydown = this.onKeydown.bind(this)
+    document.addEventListener('keydown', this.onKeydown, true)
+  }
+
+  onKeydown(event) {
+    const modifier = event.ctrlKey || event.metaKey
+    if (!modifier || !event.shiftKey || event.code !== 'KeyP') return
+    event.preventDefault()
+    this.setVisible(!this.visible)
+  }
+
+  setVisible(visible) {
+    this.visible = visible
+    if (visible && !this.element) this.build()
+    if (this.element) this.element.hidden = !visible
+  }
+
+  build() {
+    this.element = document.createElement('div')
+    this.element.className = 'tb-dev-overlay'
+    this.element.hidden = true
+
+    this.deadline = this.makeDeadline()
+    if (this.onTraceRecording && this.onTraceExport) this.makeTraceControls()
+
+    const note = document.createElement('div')
+    note.className = 'tb-dev-overlay-note'
+    note.textContent = 'No stage profile (build with THREADBARE_STAGE_PROFILING=ON)'
+    this.element.appendChild(note)
+    this.note = note
+
+    this.root.appendChild(this.element)
+  }
+
+  makeDeadline() {
+    const header = document.createElement('div')
+    header.className = 'tb-dev-overlay-deadline'
+    header.title = 'Click to reset'
+    header.addEventListener('click', () => this.onResetDeadline?.())
+
+    const summary = document.createElement('div')
+    summary.className = 'tb-dev-overlay-summary'
+    summary.textContent = 'Waiting for audio…'
+
+    const histogram = document.createElement('div')
+    histogram.className = 'tb-dev-overlay-histogram'
+
+    header.append(summary, histogram)
+    this.element.appendChild(header)
+    return { header, summary, histogram, bins: [] }
+  }
+
+  makeTraceControls() {
+    const row = document.createElement('div')
+    row.className = 'tb-dev-overlay-trace'
+
+    const record = document.createElement('button')
+    record.type = 'button'
+    record.textContent = 'Record trace'
+
+    const save = document.createElement('button')
+    save.type = 'button'
+    save.textContent = 'Save trace'
+
+    const status = document.createElement('span')
+    status.className = 'tb-dev-overlay-trace-status'
+
+    let recording = false
+    const setRecording = (value) => {
+      recording = Boolean(value)
+      record.textContent = recording ? 'Stop trace' : 'Record trace'
+      row.classList.toggle('recording', recording)
+    }
+
+    record.addEventListener('click', async () => {
+      try {
+        setRecording(await this.onTraceRecording(!recording))
+      } catch (error) {
+        status.textContent = 'trace unavailable'
+      }
+    })
+    save.addEventListener('click', async () => {
+      try {
+        status.textContent = `→ ${await this.onTraceExport()}`
+      } catch (error) {
+        status.textContent = 'export failed'
+      }
+    })
+
+    row.append(record, save, status)
+    this.element.appendChild(row)
+  }
+
+  updateDeadline(deadline) {
+    if (!this.visible || !this.deadline || !deadline) return
+
+    const percent = (load) => `${((load || 0) * 100).toFixed(0)}%`
+    const ago = deadline.lastOverrunAgoSeconds
+    const last = ago == null || ago < 0 ? 'never' : `${ago.toFixed(1)} s ago`
+    this.deadline.summary.textContent =
+      `load ${percent(deadline.load)} · avg ${percent(deadline.averageLoad)} · ` +
+      `max ${percent(deadline.maxLoad)} · overruns ${deadline.overruns ?? 0} (last ${last})` +
+      (deadline.governor ? ` · governor ${describeGovernor(deadline.governor)}` : '')
+    this.deadline.header.classList.toggle('over-budget', (deadline.overruns ?? 0) > 0)
+
+    const counts = Array.isArray(deadline.histogram) ? deadline.histogram : []
+    const { histogram, bins } = this.deadline
+    while (bins.length < counts.length) {
+      const bin = document.createElement('span')
+      bin.className = 'tb-dev-overlay-bin'
+      histogram.appendChild(bin)
+      bins.push(bin)
+    }
+
+    // Log scale so rare slow blocks stay visible next to the common case
+    const peak = Math.log1p(Math.max(1, ...counts))
+    const width = deadline.binWidth || 0.1
+    counts.forEach((count, i) => {
+      bins[i].style.height = `${((Math.log1p(count) / peak) * 100).toFixed(1)}%`
+      bins[i].classList.toggle('over-budget', (i + 1) * width > 1)
+      bins[i].title = `${percent(i * width)}–${percent((i + 1) * width)}: ${count}`
+    })
+  }
+
+  makeRow(label) {
+    const row = document.createElement('div')
+    row.className = 'tb-dev-overlay-row'
+
+    const name = document.createElement('span')
+    name.className = 'tb-dev-overlay-name'
+    name.textContent = label
+
+    const bar = document.createElement('span')
+    bar.className = 'tb-dev-overlay-bar'
+    const fill = document.createElement('span')
+    fill.className = 'tb-dev-overlay-fill'
+    const peak = document.createElement('span')
+    peak.className = 'tb-dev-overlay-peak'
+    bar.append(fill, peak)
+
+    const value = document.createElement('span')
+    value.className = 'tb-dev-overlay-value'
+
+    row.append(name, bar, value)
+    this.element.appendChild(row)
+    return { row, fill, peak, value }
+  }
+
+  holdPeak(key, micros, now) {
+    const held = this.peaks.get(key)
+    if (!held || micros >= held.micros || now - held.at > PEAK_HOLD_MS) {
+      this.peaks.set(key, { micros, at: now })
+      return micros
+    }
+    return held.micros
+  }
+
+  renderRow(row, micros, peakMicros, budget) {
+    const share = budget > 0 ? micros / budget : 0
+    const peakShare = budget > 0 ? peakMicros / budget : 0
+    row.fill.style.width = `${Math.min(100, share * 100).toFixed(1)}%`
+    row.peak.style.left = `${Math.min(100, peakShare * 100).toFixed(1)}%`
+    row.row.classList.toggle('over-budget', peakShare >= 1)
+    row.value.textContent = `${micros.toFixed(1)} / ${peakMicros.toFixed(1)} µs`
+  }
+
+  update(profile) {
+    if (!this.visible || !profile || !Array.isArray(profile.stages)) return
+    if (this.note) {
+      this.note.remove()
+      this.note = null
+    }
+
+    const now = performance.now()
+    const budget = profile.budgetMicros || 0
+
+    for (const { name, micros } of profile.stages) {
+      if (!this.rows.has(name)) this.rows.set(name, this.makeRow(name))
+      this.renderRow(this.rows.get(name), micros, this.holdPeak(name, micros, now), budget)
+    }
+
+    if (!this.totalRow) this.totalRow = this.makeRow('total')
+    this.element.appendChild(this.totalRow.row)
+    const total = profile.totalMicros || 0
+    this.renderRow(this.totalRow, total, this.holdPeak('total', total, now), budget)
+    this.totalRow.value.textContent += ` (budget ${budget.toFixed(0)})`
+  }
+
+  dispose() {
+    document.removeEventListener('keydown', this.onKeydown, true)
+    this.element?.remove()
+    this.element = null
+    this.deadline = null
+    this.rows.clear()
+  }
+}
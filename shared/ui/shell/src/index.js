@@ -11,9 +11,10 @@
 import { Controls } from './controls.js'
 import { Presets } from './presets.js'
 import { ElasticSlider } from './elastic-slider.js'
+import { DevOverlay } from './dev-overlay.js'
 
 // Re-export components for direct use if needed
-export { Controls, Presets, ElasticSlider }
+export { Controls, Presets, ElasticSlider, DevOverlay }
 
 /**
  * Apply theme tokens as CSS variables on :root
@@ -77,6 +78,7 @@ export function initShell(options = {}) {
   let viz = null
   let controls = null
   let presets = null
+  let devOverlay = null
   let uiState = null
   let currentState = {}
 
@@ -109,6 +111,13 @@ export function initShell(options = {}) {
     getNativeFn,
   })
 
+  // Hidden DSP timing overlay (Ctrl/Cmd+Shift+P)
+  devOverlay = new DevOverlay({
+    onResetDeadline: () => getNativeFn('resetDeadlineStats')?.(),
+    onTraceRecording: (on) => getNativeFn('setTraceRecording')?.(on),
+    onTraceExport: () => getNativeFn('exportTrace')?.(),
+  })
+
   // UI state for freeze/resize handling
   uiState = {
     frozen: false,
@@ -178,6 +187,14 @@ export function initShell(options = {}) {
 
     if (typeof parsed !== 'object') return
 
+    // Timing data goes to the dev overlay only, not into UI state
+    if (parsed.stageProfile || parsed.deadline) {
+      if (parsed.deadline) devOverlay?.updateDeadline(parsed.deadline)
+      if (parsed.stageProfile) devOverlay?.update(parsed.stageProfile)
+      const { stageProfile, deadline, ...withoutTimings } = parsed
+      parsed = withoutTimings
+    }
+
     // Skip puckX/puckY updates while user is dragging to prevent flicker
     if (controls?.isDragging) {
       const { puckX, puckY, ...rest } = parsed
@@ -212,6 +229,8 @@ export function initShell(options = {}) {
       window.removeEventListener('resize', resizeCanvas)
       document.removeEventListener('keydown', onKeydown, true)
       viz?.dispose?.()
+      devOverlay?.dispose()
+      devOverlay = null
       viz = null
       controls = null
       presets = null